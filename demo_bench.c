@@ -0,0 +1,252 @@
+/*
+ * Filename: demo_bench.c
+ * THE CENSUS OF NIGHTS
+ * 千夜普查
+ *
+ * 全特效基准扫描：依次切换 EffectTab 中的每个特效，预热后计时 N 帧，
+ * 每个特效输出一行 CSV，用于在不同固件版本之间比对性能回归。
+ * 声明了负载档位 (bench_loads) 的特效在每个档位各预热、计时一次，每档一行 (load 列)。
+ *
+ * 用法 (msh / 主机运行器): demo_bench [frames=120] [warmup=10] [novsync=0]
+ */
+
+#include "demo_bench.h"
+#include "demo_perf.h"
+#include <rtthread.h>
+#include <string.h>
+
+extern struct effect_ops *__start_EffectTab[];
+extern struct effect_ops *__stop_EffectTab[];
+
+#define BENCH_LOADS_MAX 8 /* 每个特效最多测量的负载档位 */
+
+/* 一个特效 (一个负载档位) 的测量结果 (时间单位 us，内存单位 Bytes) */
+struct bench_row
+{
+    int      index;
+    int      load; /* 负载档位，0 表示特效未声明 */
+    uint32_t frames;
+    uint32_t frame_mean;
+    uint32_t frame_p99;
+    uint32_t cpu_mean;   /* COMPUTE */
+    uint32_t cache_mean; /* CACHE */
+    uint32_t ge_mean;    /* GE_SUBMIT + GE_SYNC */
+    uint32_t vsync_mean; /* 等待空闲帧缓冲 */
+    uint32_t init_us;
+    uint32_t deinit_us;
+    long     heap_peak; /* 相对 init 前的增量峰值 */
+    long     cma_peak;  /* 同上，-1 表示不可用 */
+};
+
+static struct
+{
+    volatile int active;
+    int          frames;
+    int          warmup;
+    int          restore_idx; /* 结束后切回的特效 */
+    int          index;       /* 当前测量的特效 */
+    int          frame_no;
+    int          finishing; /* 最后一个特效已测完，等待其 deinit */
+    rt_sem_t     done;
+
+    struct bench_row row;
+    struct bench_row rows[BENCH_LOADS_MAX]; /* 已测完的档位 */
+    int              nrows;
+    int              load_idx;
+    int              row_pending; /* 等待 deinit 耗时后输出 */
+
+    long heap_base;
+    long cma_base;
+} g_bench;
+
+static rt_size_t bench_heap_used(void)
+{
+    rt_size_t total, used, max_used;
+    rt_memory_info(&total, &used, &max_used);
+    return used;
+}
+
+/* 采样内存峰值 (在 init 之后与每帧调用) */
+static void bench_sample_mem(void)
+{
+    long heap = (long)bench_heap_used() - demo_prewarm_heap(g_bench.index) - g_bench.heap_base;
+    if (heap > g_bench.row.heap_peak)
+        g_bench.row.heap_peak = heap;
+
+    long cma = demo_cma_used();
+    if (cma >= 0 && g_bench.cma_base >= 0 && cma - g_bench.cma_base > g_bench.row.cma_peak)
+        g_bench.row.cma_peak = cma - g_bench.cma_base;
+}
+
+static uint32_t bench_phase_mean(enum demo_phase phase, uint32_t frames)
+{
+    const struct demo_phase_hist *hist = demo_perf_phase_hist(phase);
+    return frames ? (uint32_t)(hist->sum_us / frames) : 0;
+}
+
+static void bench_print_row(const struct bench_row *r)
+{
+    rt_kprintf("%d,\"%s\",%u,%u,%u,%u,%u,%u,%u,%u,%u,%ld,%ld,%d\n", r->index, __start_EffectTab[r->index]->name,
+               r->frames, r->frame_mean, r->frame_p99, r->cpu_mean, r->cache_mean, r->ge_mean, r->vsync_mean, r->init_us,
+               r->deinit_us, r->heap_peak / 1024, r->cma_peak < 0 ? -1 : r->cma_peak / 1024, r->load);
+}
+
+/* 当前特效的下一个负载档位 (0 表示没有) */
+static int bench_next_load(void)
+{
+    const int *loads = __start_EffectTab[g_bench.index]->bench_loads;
+    if (!loads || !__start_EffectTab[g_bench.index]->set_load || !loads[g_bench.load_idx])
+        return 0;
+    if (g_bench.load_idx + 1 >= BENCH_LOADS_MAX)
+        return 0;
+    return loads[g_bench.load_idx + 1];
+}
+
+/* 当前特效测量完毕：汇总直方图，并请求切换到下一个 */
+static void bench_finish_effect(void)
+{
+    struct demo_phase_stat frame;
+    demo_perf_phase_stat(demo_perf_phase_hist(DEMO_PHASE_FRAME), &frame);
+
+    struct bench_row *r = &g_bench.row;
+    r->frames     = frame.count;
+    r->frame_mean = frame.mean;
+    r->frame_p99  = frame.p99;
+    r->cpu_mean   = bench_phase_mean(DEMO_PHASE_COMPUTE, frame.count);
+    r->cache_mean = bench_phase_mean(DEMO_PHASE_CACHE, frame.count);
+    r->ge_mean    = bench_phase_mean(DEMO_PHASE_GE_SUBMIT, frame.count) + bench_phase_mean(DEMO_PHASE_GE_SYNC, frame.count);
+    r->vsync_mean = bench_phase_mean(DEMO_PHASE_VSYNC, frame.count);
+    g_bench.rows[g_bench.nrows++] = *r;
+
+    /* 同一特效的下一个负载档位：重新预热并计时，init 耗时与内存峰值沿用 */
+    int load = bench_next_load();
+    if (load)
+    {
+        g_bench.load_idx++;
+        g_bench.frame_no = 0;
+        r->load          = load;
+        demo_effect_set_load(load);
+        return;
+    }
+    g_bench.row_pending = 1;
+
+    int count = __stop_EffectTab - __start_EffectTab;
+    if (g_bench.index + 1 < count)
+    {
+        demo_jump_effect(g_bench.index + 1);
+    }
+    else
+    {
+        g_bench.finishing = 1;
+        demo_jump_effect(g_bench.restore_idx);
+    }
+}
+
+void demo_bench_on_stop(uint32_t deinit_us)
+{
+    if (!g_bench.active)
+        return;
+
+    if (g_bench.row_pending)
+    {
+        for (int i = 0; i < g_bench.nrows; i++)
+        {
+            g_bench.rows[i].deinit_us = deinit_us;
+            bench_print_row(&g_bench.rows[i]);
+        }
+        g_bench.row_pending = 0;
+    }
+
+    if (g_bench.finishing)
+    {
+        g_bench.active = 0;
+        demo_set_vsync(1);
+        rt_sem_release(g_bench.done);
+        return;
+    }
+
+    /*
+     * 旧特效已释放，以此刻 (新特效 prewarm_claim 之前) 的内存用量作为基线。
+     * 预备资源全部扣除，采样时再只扣除其它特效的，新特效自己的 prepare 无论由谁执行都计入其名下。
+     */
+    g_bench.heap_base = (long)bench_heap_used() - demo_prewarm_heap(-1);
+    g_bench.cma_base  = demo_cma_used();
+}
+
+void demo_bench_on_start(int index, uint32_t init_us)
+{
+    if (!g_bench.active)
+        return;
+
+    memset(&g_bench.row, 0, sizeof(g_bench.row));
+    g_bench.row.index    = index;
+    g_bench.row.init_us  = init_us;
+    g_bench.row.cma_peak = g_bench.cma_base < 0 ? -1 : 0;
+    g_bench.index        = index;
+    g_bench.frame_no     = 0;
+    g_bench.nrows        = 0;
+    g_bench.load_idx     = 0;
+    bench_sample_mem();
+
+    /* 声明了负载档位的特效从第一档开始 */
+    const struct effect_ops *op = __start_EffectTab[index];
+    if (op->bench_loads && op->set_load && op->bench_loads[0])
+    {
+        g_bench.row.load = op->bench_loads[0];
+        demo_effect_set_load(op->bench_loads[0]);
+    }
+}
+
+void demo_bench_on_frame(void)
+{
+    if (!g_bench.active || g_bench.row_pending)
+        return;
+
+    bench_sample_mem();
+    g_bench.frame_no++;
+
+    /* 预热结束：清空直方图，从下一帧开始计时 */
+    if (g_bench.frame_no == g_bench.warmup)
+        demo_perf_effect_begin(g_bench.index, __start_EffectTab[g_bench.index]->name);
+    else if (g_bench.frame_no == g_bench.warmup + g_bench.frames)
+        bench_finish_effect();
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_bench(int argc, char **argv)
+{
+    if (g_bench.active)
+    {
+        rt_kprintf("demo_bench: already running.\n");
+        return -1;
+    }
+    if (__stop_EffectTab - __start_EffectTab <= 0)
+        return -1;
+
+    if (!g_bench.done)
+    {
+        g_bench.done = rt_sem_create("ge_bench", 0, RT_IPC_FLAG_FIFO);
+        if (!g_bench.done)
+            return -1;
+    }
+
+    g_bench.frames      = (argc > 1) ? MAX(1, atoi(argv[1])) : 120;
+    g_bench.warmup      = (argc > 2) ? MAX(1, atoi(argv[2])) : 10;
+    int novsync         = (argc > 3) ? atoi(argv[3]) : 0;
+    g_bench.restore_idx = demo_current_effect();
+    g_bench.finishing   = 0;
+    g_bench.row_pending = 0;
+
+    rt_kprintf("id,name,frames,frame_mean_us,frame_p99_us,cpu_us,cache_us,ge_us,vsync_us,init_us,deinit_us,"
+               "heap_peak_kb,cma_peak_kb,load\n");
+
+    demo_set_vsync(!novsync);
+    g_bench.active = 1;
+    demo_jump_effect(0);
+
+    /* 阻塞 shell 直到扫描完成，主机运行器据此在结束后退出 */
+    rt_sem_take(g_bench.done, RT_WAITING_FOREVER);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_bench, demo_bench, Benchmark all effects as CSV : [frames] [warmup] [novsync]);
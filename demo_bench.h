@@ -0,0 +1,34 @@
+/*
+ * Filename: demo_bench.h
+ * THE CENSUS OF NIGHTS
+ * 千夜普查
+ */
+
+#ifndef _DEMO_BENCH_H_
+#define _DEMO_BENCH_H_
+
+#include "demo_engine.h"
+
+/*
+ * 渲染线程钩子 (由 demo_entry.c 调用，基准测试未运行时立即返回)
+ * on_stop:  旧特效 deinit 完成后调用，deinit_us 为其耗时
+ * on_start: 新特效 init 完成后调用，init_us 为其耗时
+ * on_frame: 每帧 demo_perf_frame_end 之后调用
+ */
+void demo_bench_on_stop(uint32_t deinit_us);
+void demo_bench_on_start(int index, uint32_t init_us);
+void demo_bench_on_frame(void);
+
+/*
+ * CMA 当前用量 (Bytes)，不可用时返回 -1。
+ * SDK 未提供统一的查询接口，由 demo_pool.c 以池中借出中的字节提供 (帧缓冲与 OSD 等常驻缓冲不计入)。
+ */
+long demo_cma_used(void);
+
+/*
+ * 预备线程为特效持有的堆内存 (Bytes)，exclude 所属的部分不计入 (-1 表示全部计入)。
+ * 由 demo_entry.c 提供：基准测试据此扣除相邻特效的预备内存，把 prepare 的开销记在所属特效名下。
+ */
+long demo_prewarm_heap(int exclude);
+
+#endif /* _DEMO_BENCH_H_ */
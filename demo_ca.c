@@ -0,0 +1,810 @@
+/*
+ * Filename: demo_ca.c
+ * THE LOOM OF GENERATIONS
+ * 世代织机
+ *
+ * 位切片布局 (小端)：第 y 行第 k 个位平面占 words 个寄存器字，细胞 x 位于字 x / BITS 的第 x % BITS 位；
+ * 左邻整体左移一位并补入前一字的最高位，右邻同理，行首行尾环绕到行的另一端。
+ *
+ * 每字的更新 (s 为当前状态的各位平面)：
+ *   n   = s + 1 (逐平面行波进位)，等于 states 的细胞回绕为 0
+ *   x_d = 邻居 d 处于 n (循环) / 邻居 d 为活细胞 (世代)          每个邻居 1 位
+ *   cnt = Σ x_d                                                 全加器树，4 邻 9 次、8 邻 26 次运算
+ *   adv = 查表 (cnt 落在 birth / survive 中)                     循环规则阈值为 1 时直接 OR 各 x_d
+ *   s'  = s ^ (adv & (s ^ n))                                   前进者取 n，其余不变
+ * 世代规则里 "前进" 同样是 s -> s + 1：空格诞生 (0 -> 1)、活细胞衰亡 (1 -> 2 或回绕 0)、余烬继续衰亡。
+ *
+ * 位平面数与邻域在每代开始时分派到专门展开的版本，内层没有按平面 / 邻居的循环。
+ */
+
+#include "demo_ca.h"
+#include "demo_math.h"
+#include "demo_perf.h"
+#include "demo_swar.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 寄存器字与 demo_swar 一致：RV64 / 64 位主机 64 个细胞，其余 32 个 */
+typedef demo_pxw_t ca_word_t;
+
+#define CA_BITS ((int)sizeof(ca_word_t) * 8)
+#define CA_TOP  (CA_BITS - 1)
+#define CA_ONES (~(ca_word_t)0)
+
+/* 按平面数 / 邻域展开的内层函数须内联进各分派点，常量参数才能消去循环 */
+#define CA_INLINE static inline __attribute__((always_inline))
+
+static const struct demo_ca *g_ca_active; /* 最近一次 init 的实例 (供 demo_ca 指令查看) */
+
+/* --- 初始化 --- */
+
+int demo_ca_init(struct demo_ca *ca, int width, int height, const struct demo_ca_rule *rule)
+{
+    rt_memset(ca, 0, sizeof(*ca));
+    if (width <= 0 || width % DEMO_CA_ALIGN || height <= 0 || rule->states < 2 ||
+        rule->states > DEMO_CA_MAX_STATES || (rule->neigh != DEMO_CA_VON_NEUMANN && rule->neigh != DEMO_CA_MOORE))
+    {
+        LOG_E("CA: unsupported grid %d x %d or rule (%d states, %d neighbours)", width, height, rule->states,
+              rule->neigh);
+        return -1;
+    }
+
+    ca->width  = width;
+    ca->height = height;
+    ca->words  = width / CA_BITS;
+    ca->planes = 32 - __builtin_clz((unsigned int)rule->states - 1);
+    ca->rule   = *rule;
+
+    size_t size = (size_t)height * ca->planes * ca->words * sizeof(ca_word_t);
+    ca->buf[0]  = rt_malloc(size);
+    ca->buf[1]  = rt_malloc(size);
+    if (!ca->buf[0] || !ca->buf[1])
+    {
+        LOG_E("CA: alloc failed (%d x %d, %d planes)", width, height, ca->planes);
+        demo_ca_deinit(ca);
+        return -1;
+    }
+
+    demo_ca_clear(ca);
+    g_ca_active = ca;
+    return 0;
+}
+
+void demo_ca_deinit(struct demo_ca *ca)
+{
+    if (ca->buf[0])
+        rt_free(ca->buf[0]);
+    if (ca->buf[1])
+        rt_free(ca->buf[1]);
+    if (g_ca_active == ca)
+        g_ca_active = NULL;
+    rt_memset(ca, 0, sizeof(*ca));
+}
+
+static inline size_t ca_pitch(const struct demo_ca *ca)
+{
+    return (size_t)ca->planes * ca->words; /* 每行的寄存器字数 */
+}
+
+void demo_ca_clear(struct demo_ca *ca)
+{
+    size_t size = ca->height * ca_pitch(ca) * sizeof(ca_word_t);
+    memset(ca->buf[0], 0, size);
+    memset(ca->buf[1], 0, size);
+    ca->cur = 0;
+    rt_memset(&ca->stats, 0, sizeof(ca->stats));
+}
+
+void demo_ca_randomize(struct demo_ca *ca, struct demo_rand *rng)
+{
+    /* 状态数为 2 的幂时各位平面直接取随机字，否则逐格取值 (仅在 init 时调用) */
+    if ((ca->rule.states & (ca->rule.states - 1)) == 0)
+    {
+        demo_rand_fill(rng, ca->buf[ca->cur], ca->height * ca_pitch(ca) * sizeof(ca_word_t));
+        return;
+    }
+    for (int y = 0; y < ca->height; y++)
+        for (int x = 0; x < ca->width; x++)
+            demo_ca_set(ca, x, y, (int)demo_rand_range(rng, ca->rule.states));
+}
+
+/* --- 单格读写 --- */
+
+int demo_ca_get(const struct demo_ca *ca, int x, int y)
+{
+    x = ((x % ca->width) + ca->width) % ca->width;
+    y = ((y % ca->height) + ca->height) % ca->height;
+
+    const ca_word_t *p = (const ca_word_t *)ca->buf[ca->cur] + y * ca_pitch(ca) + x / CA_BITS;
+    int              s = 0;
+
+    for (int k = 0; k < ca->planes; k++)
+        s |= (int)((p[k * ca->words] >> (x % CA_BITS)) & 1) << k;
+    return s;
+}
+
+void demo_ca_set(struct demo_ca *ca, int x, int y, int state)
+{
+    x = ((x % ca->width) + ca->width) % ca->width;
+    y = ((y % ca->height) + ca->height) % ca->height;
+
+    ca_word_t *p   = (ca_word_t *)ca->buf[ca->cur] + y * ca_pitch(ca) + x / CA_BITS;
+    ca_word_t  bit = (ca_word_t)1 << (x % CA_BITS);
+
+    for (int k = 0; k < ca->planes; k++)
+        p[k * ca->words] = ((state >> k) & 1) ? (p[k * ca->words] | bit) : (p[k * ca->words] & ~bit);
+}
+
+/* --- 位切片运算 --- */
+
+/* 各细胞的状态是否等于常量 v */
+CA_INLINE ca_word_t ca_eq(const ca_word_t *s, int planes, int v)
+{
+    ca_word_t eq = CA_ONES;
+    for (int k = 0; k < planes; k++)
+        eq &= ((v >> k) & 1) ? s[k] : ~s[k];
+    return eq;
+}
+
+/* 两组状态逐格相等 */
+CA_INLINE ca_word_t ca_same(const ca_word_t *a, const ca_word_t *b, int planes)
+{
+    ca_word_t d = 0;
+    for (int k = 0; k < planes; k++)
+        d |= a[k] ^ b[k];
+    return ~d;
+}
+
+/* 全加器：返回和位，进位写入 *co */
+CA_INLINE ca_word_t ca_fa(ca_word_t a, ca_word_t b, ca_word_t c, ca_word_t *co)
+{
+    ca_word_t t = a ^ b;
+    *co         = (a & b) | (t & c);
+    return t ^ c;
+}
+
+/* 邻居计数：x[0 .. nb-1] 各 1 位，结果写入 c[0] (最低位) 起的 3 (4 邻) 或 4 (8 邻) 个位平面 */
+CA_INLINE void ca_count(const ca_word_t *x, int nb, ca_word_t *c)
+{
+    if (nb == DEMO_CA_VON_NEUMANN)
+    {
+        ca_word_t k0, s = ca_fa(x[0], x[1], x[2], &k0);
+        c[0] = s ^ x[3];
+        s &= x[3];
+        c[1] = k0 ^ s;
+        c[2] = k0 & s;
+        return;
+    }
+
+    ca_word_t k0, k1, k2, k3, d0, d1;
+    ca_word_t s0 = ca_fa(x[0], x[1], x[2], &k0);
+    ca_word_t s1 = ca_fa(x[3], x[4], x[5], &k1);
+    ca_word_t s2 = x[6] ^ x[7];
+    k2           = x[6] & x[7];
+    c[0]         = ca_fa(s0, s1, s2, &k3);
+    ca_word_t t  = ca_fa(k0, k1, k2, &d0);
+    c[1]         = t ^ k3;
+    d1           = t & k3;
+    c[2]         = d0 ^ d1;
+    c[3]         = d0 & d1;
+}
+
+/* 计数落在 table (第 n 位 = 计数 n) 中的细胞 */
+static inline ca_word_t ca_table(const ca_word_t *c, int bits, uint32_t table)
+{
+    ca_word_t hit = 0;
+    for (; table; table &= table - 1)
+        hit |= ca_eq(c, bits, __builtin_ctz(table));
+    return hit;
+}
+
+/* --- 推进一代 --- */
+
+/* 一行：up / mid / dn 为源行 (各含 planes 个位平面)，结果写入 out */
+CA_INLINE void ca_step_row(const struct demo_ca *ca, const ca_word_t *up, const ca_word_t *mid, const ca_word_t *dn,
+                           ca_word_t *out, const int planes, const int nb)
+{
+    const int      words   = ca->words;
+    const int      states  = ca->rule.states;
+    const int      cyclic  = ca->rule.type == DEMO_CA_CYCLIC;
+    const int      cbits   = nb == DEMO_CA_MOORE ? 4 : 3;
+    const uint32_t limit   = (2u << nb) - 1;
+    const uint32_t birth   = ca->rule.birth & limit;
+    const uint32_t survive = ca->rule.survive & limit;
+    const int      any     = cyclic && birth == (limit & ~1u); /* 至少一个邻居即前进：不必计数 */
+
+    for (int i = 0; i < words; i++)
+    {
+        const int il = i ? i - 1 : words - 1;
+        const int ir = i + 1 < words ? i + 1 : 0;
+        ca_word_t s[DEMO_CA_MAX_PLANES], n[DEMO_CA_MAX_PLANES], c[4], x[8];
+        ca_word_t v[8][DEMO_CA_MAX_PLANES]; /* 各邻居移到本格位置后的状态 */
+
+        for (int k = 0; k < planes; k++)
+        {
+            const ca_word_t *u = up + k * words, *m = mid + k * words, *d = dn + k * words;
+
+            s[k]    = m[i];
+            v[0][k] = u[i];
+            v[1][k] = d[i];
+            v[2][k] = (m[i] << 1) | (m[il] >> CA_TOP);
+            v[3][k] = (m[i] >> 1) | (m[ir] << CA_TOP);
+            if (nb == DEMO_CA_MOORE)
+            {
+                v[4][k] = (u[i] << 1) | (u[il] >> CA_TOP);
+                v[5][k] = (u[i] >> 1) | (u[ir] << CA_TOP);
+                v[6][k] = (d[i] << 1) | (d[il] >> CA_TOP);
+                v[7][k] = (d[i] >> 1) | (d[ir] << CA_TOP);
+            }
+        }
+
+        /* 后继状态 */
+        ca_word_t carry = CA_ONES;
+        for (int k = 0; k < planes; k++)
+        {
+            n[k] = s[k] ^ carry;
+            carry &= s[k];
+        }
+        if (states != 1 << planes)
+        {
+            ca_word_t w = ca_eq(n, planes, states);
+            for (int k = 0; k < planes; k++)
+                n[k] &= ~w;
+        }
+
+        ca_word_t adv;
+        if (cyclic)
+        {
+            for (int d = 0; d < nb; d++)
+                x[d] = ca_same(v[d], n, planes);
+            if (any)
+            {
+                adv = 0;
+                for (int d = 0; d < nb; d++)
+                    adv |= x[d];
+            }
+            else
+            {
+                ca_count(x, nb, c);
+                adv = ca_table(c, cbits, birth);
+            }
+        }
+        else
+        {
+            for (int d = 0; d < nb; d++)
+                x[d] = ca_eq(v[d], planes, 1);
+            ca_count(x, nb, c);
+
+            ca_word_t dead  = ca_eq(s, planes, 0);
+            ca_word_t alive = ca_eq(s, planes, 1);
+            adv = (dead & ca_table(c, cbits, birth)) | (alive & ~ca_table(c, cbits, survive)) | ~(dead | alive);
+        }
+
+        for (int k = 0; k < planes; k++)
+            out[k * words + i] = s[k] ^ (adv & (s[k] ^ n[k]));
+    }
+}
+
+CA_INLINE void ca_step_rows(const struct demo_ca *ca, const ca_word_t *src, ca_word_t *dst, const int planes,
+                            const int nb)
+{
+    const size_t pitch = ca_pitch(ca);
+    const int    h     = ca->height;
+
+    for (int y = 0; y < h; y++)
+    {
+        const ca_word_t *up = src + (y ? y - 1 : h - 1) * pitch;
+        const ca_word_t *dn = src + (y + 1 < h ? y + 1 : 0) * pitch;
+        ca_step_row(ca, up, src + y * pitch, dn, dst + y * pitch, planes, nb);
+    }
+}
+
+void demo_ca_step(struct demo_ca *ca)
+{
+    uint64_t         t0  = demo_perf_now_us();
+    const ca_word_t *src = (const ca_word_t *)ca->buf[ca->cur];
+    ca_word_t       *dst = (ca_word_t *)ca->buf[ca->cur ^ 1];
+
+#define CA_STEP_CASE(p)                                                                                                \
+    case p:                                                                                                            \
+        if (ca->rule.neigh == DEMO_CA_MOORE)                                                                           \
+            ca_step_rows(ca, src, dst, p, DEMO_CA_MOORE);                                                              \
+        else                                                                                                           \
+            ca_step_rows(ca, src, dst, p, DEMO_CA_VON_NEUMANN);                                                        \
+        break;
+
+    switch (ca->planes)
+    {
+        CA_STEP_CASE(1)
+        CA_STEP_CASE(2)
+        CA_STEP_CASE(3)
+        CA_STEP_CASE(4)
+    }
+#undef CA_STEP_CASE
+
+    ca->cur ^= 1;
+    ca->stats.steps++;
+    ca->stats.step_us = (uint32_t)(demo_perf_now_us() - t0);
+}
+
+/* --- 突变 --- */
+
+uint32_t demo_ca_mutate(struct demo_ca *ca, struct demo_rand *rng, uint32_t p16)
+{
+    ca_word_t *buf   = (ca_word_t *)ca->buf[ca->cur];
+    size_t     pitch = ca_pitch(ca);
+    uint32_t   count = 0;
+
+    if (p16 == 0)
+        return ca->stats.mutated = 0;
+
+    /*
+     * 两级取样，与逐位独立取样同分布：每字先用一次 next 判定是否含突变 (概率 q = 1 - (1 - p)^BITS)，
+     * 命中时按条件分布取最低的突变位 j，j 以上各位再由 demo_rand_mask16 独立生成。
+     * p 很小时绝大多数字只花一次 next，不必为每字生成完整掩码。
+     */
+    uint32_t cdf[CA_BITS]; /* P(最低突变位 <= j | 字中有突变)，定点 2^32 */
+    float    keep = 1.0f - (float)MIN(p16, 65536u) / 65536.0f;
+    float    none = 1.0f;
+
+    for (int j = 0; j < CA_BITS; j++)
+        none *= keep;
+    float    q    = 1.0f - none;
+    uint32_t qthr = q >= 1.0f ? 0xFFFFFFFFu : (uint32_t)(q * 4294967296.0f);
+
+    none = 1.0f;
+    for (int j = 0; j < CA_BITS; j++)
+    {
+        none *= keep;
+        float c = (1.0f - none) / q;
+        cdf[j]  = c >= 1.0f ? 0xFFFFFFFFu : (uint32_t)(c * 4294967296.0f);
+    }
+    cdf[CA_BITS - 1] = 0xFFFFFFFFu;
+
+    for (int y = 0; y < ca->height; y++)
+    {
+        ca_word_t *row = buf + y * pitch;
+        for (int i = 0; i < ca->words; i++)
+        {
+            if (demo_rand_next(rng) > qthr)
+                continue;
+
+            uint32_t u = demo_rand_next(rng);
+            int      j = 0;
+            while (u > cdf[j])
+                j++;
+
+            ca_word_t m = 0;
+            for (int h = 0; h < CA_BITS; h += 32)
+                m |= (ca_word_t)demo_rand_mask16(rng, p16) << h;
+            m = ((ca_word_t)1 << j) | (m & (CA_ONES << j << 1));
+
+            /* 只对命中的细胞逐个取新状态 */
+            for (; m; m &= m - 1)
+            {
+                ca_word_t bit   = m & -m;
+                int       state = (int)demo_rand_range(rng, ca->rule.states);
+                for (int k = 0; k < ca->planes; k++)
+                {
+                    ca_word_t *p = row + k * ca->words + i;
+                    *p           = ((state >> k) & 1) ? (*p | bit) : (*p & ~bit);
+                }
+                count++;
+            }
+        }
+    }
+
+    ca->stats.mutated = count;
+    return count;
+}
+
+/* --- 着色 --- */
+
+/* 每 4 个细胞一次：相邻两个位平面的半字节拼成 8 位下标查 lut，两组相加即 4 个索引字节 */
+CA_INLINE void ca_render_rows(const struct demo_ca *ca, uint8_t *dst, int stride, const int planes)
+{
+    const ca_word_t *src   = (const ca_word_t *)ca->buf[ca->cur];
+    const size_t     pitch = ca_pitch(ca);
+    const uint32_t  *lo    = ca->lut[0];
+    const uint32_t  *hi    = ca->lut[1];
+
+    for (int y = 0; y < ca->height; y++, dst += stride)
+    {
+        const ca_word_t *row = src + y * pitch;
+        uint32_t        *d   = (uint32_t *)dst;
+
+        for (int i = 0; i < ca->words; i++)
+        {
+            ca_word_t p[DEMO_CA_MAX_PLANES];
+            for (int k = 0; k < planes; k++)
+                p[k] = row[k * ca->words + i];
+
+            for (int j = 0; j < CA_BITS; j += 4)
+            {
+                uint32_t ix = (uint32_t)p[0] & 15;
+                if (planes > 1)
+                    ix |= ((uint32_t)p[1] & 15) << 4;
+                uint32_t v = lo[ix];
+                if (planes > 2)
+                {
+                    ix = (uint32_t)p[2] & 15;
+                    if (planes > 3)
+                        ix |= ((uint32_t)p[3] & 15) << 4;
+                    v += hi[ix];
+                }
+                for (int k = 0; k < planes; k++)
+                    p[k] >>= 4;
+                *d++ = v;
+            }
+        }
+    }
+}
+
+void demo_ca_render(struct demo_ca *ca, uint8_t *dst, int stride, int scale)
+{
+    uint64_t t0 = demo_perf_now_us();
+
+    /*
+     * lut[g][v]：v 的低 / 高半字节为位平面 2g / 2g+1 上 4 个细胞的位 (第 j 位为细胞 j)，
+     * 值为它们对 4 个索引字节的贡献。各字节之和即 state * scale，不超过 255，不会进位到相邻字节。
+     */
+    if (ca->lut_scale != scale)
+    {
+        for (int v = 0; v < 256; v++)
+        {
+            for (int g = 0; g < 2; g++)
+            {
+                uint32_t sum = 0;
+                for (int h = 0; h < 2; h++)
+                {
+                    int      n = (v >> (4 * h)) & 15;
+                    uint32_t e = (n & 1) | ((n & 2) << 7) | ((n & 4) << 14) | ((uint32_t)(n & 8) << 21);
+                    sum += e * (uint32_t)(scale << (2 * g + h));
+                }
+                ca->lut[g][v] = sum;
+            }
+        }
+        ca->lut_scale = scale;
+    }
+
+    switch (ca->planes)
+    {
+    case 1:
+        ca_render_rows(ca, dst, stride, 1);
+        break;
+    case 2:
+        ca_render_rows(ca, dst, stride, 2);
+        break;
+    case 3:
+        ca_render_rows(ca, dst, stride, 3);
+        break;
+    default:
+        ca_render_rows(ca, dst, stride, 4);
+        break;
+    }
+
+    ca->stats.render_us = (uint32_t)(demo_perf_now_us() - t0);
+}
+
+/* --- 自检：与逐格标量写法对照 --- */
+
+#define CHECK_W      128 /* 两个 64 位字 / 四个 32 位字，覆盖字间进位与行首尾环绕 */
+#define CHECK_H      13
+#define CHECK_STRIDE (CHECK_W + 8)
+#define CHECK_STEPS  40
+#define CHECK_P16    4096 /* 每 8 代按 1/16 的概率突变一次 */
+#define CHECK_ROUNDS 400  /* 稀疏突变的取样轮数 */
+#define CHECK_SPARSE 64   /* 稀疏突变概率 (1/1024) */
+
+static const struct demo_ca_rule g_check_rules[] = {
+    DEMO_CA_RULE_CYCLIC(16, DEMO_CA_VON_NEUMANN, 1), /* 0018 */
+    DEMO_CA_RULE_CYCLIC(14, DEMO_CA_MOORE, 1),
+    DEMO_CA_RULE_CYCLIC(5, DEMO_CA_MOORE, 3),
+    DEMO_CA_RULE_CYCLIC(3, DEMO_CA_VON_NEUMANN, 2),
+    DEMO_CA_RULE_LIFE,
+    DEMO_CA_RULE_BRIAN,
+    {DEMO_CA_GENERATIONS, DEMO_CA_MOORE, 4, 1 << 2, (1 << 3) | (1 << 4) | (1 << 5)}, /* Star Wars */
+    {DEMO_CA_GENERATIONS, DEMO_CA_VON_NEUMANN, 9, 1 | (1 << 3), 0x7},               /* 含 B0 */
+};
+
+static void ca_ref_step(const struct demo_ca_rule *r, const uint8_t *src, uint8_t *dst)
+{
+    static const int dx[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+    static const int dy[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+
+    for (int y = 0; y < CHECK_H; y++)
+    {
+        for (int x = 0; x < CHECK_W; x++)
+        {
+            int s    = src[y * CHECK_W + x];
+            int next = (s + 1) % r->states;
+            int cnt  = 0;
+
+            for (int d = 0; d < r->neigh; d++)
+            {
+                int v = src[((y + dy[d] + CHECK_H) % CHECK_H) * CHECK_W + (x + dx[d] + CHECK_W) % CHECK_W];
+                cnt += (r->type == DEMO_CA_CYCLIC) ? v == next : v == 1;
+            }
+
+            int adv;
+            if (r->type == DEMO_CA_CYCLIC || s == 0)
+                adv = (r->birth >> cnt) & 1;
+            else if (s == 1)
+                adv = !((r->survive >> cnt) & 1);
+            else
+                adv = 1;
+            dst[y * CHECK_W + x] = (uint8_t)(adv ? next : s);
+        }
+    }
+}
+
+static int ca_check_rule(const struct demo_ca_rule *r, uint32_t *mutated)
+{
+    static uint8_t   ref[2][CHECK_W * CHECK_H];
+    static uint8_t   out[CHECK_STRIDE * CHECK_H] __attribute__((aligned(4)));
+    struct demo_ca   ca;
+    struct demo_rand rng;
+    int              cur = 0;
+
+    if (demo_ca_init(&ca, CHECK_W, CHECK_H, r) < 0)
+        return -1;
+    demo_rand_seed(&rng, r->states * 16 + r->neigh);
+    demo_ca_randomize(&ca, &rng);
+
+    for (int i = 0; i < CHECK_W * CHECK_H; i++)
+    {
+        ref[0][i] = (uint8_t)demo_ca_get(&ca, i % CHECK_W, i / CHECK_W);
+        if (ref[0][i] >= r->states)
+        {
+            rt_kprintf("randomize produced state %d\n", ref[0][i]);
+            demo_ca_deinit(&ca);
+            return -1;
+        }
+    }
+
+    for (int step = 0; step < CHECK_STEPS; step++)
+    {
+        demo_ca_step(&ca);
+        ca_ref_step(r, ref[cur], ref[cur ^ 1]);
+        cur ^= 1;
+
+        /* 突变：实际改变的细胞不多于改写数、状态不越界，结果同步回参考网格 */
+        if (step % 8 == 7)
+        {
+            uint32_t n = demo_ca_mutate(&ca, &rng, CHECK_P16), changed = 0;
+            int      bad = 0;
+            for (int i = 0; i < CHECK_W * CHECK_H; i++)
+            {
+                int s = demo_ca_get(&ca, i % CHECK_W, i / CHECK_W);
+                changed += s != ref[cur][i];
+                bad |= s >= r->states;
+                ref[cur][i] = (uint8_t)s;
+            }
+            *mutated += n;
+            if (changed > n || bad)
+            {
+                rt_kprintf("rule %d/%d/%d, mutate: %u changed of %u rewritten%s\n", r->type, r->neigh, r->states,
+                           changed, n, bad ? ", state out of range" : "");
+                demo_ca_deinit(&ca);
+                return -1;
+            }
+            continue;
+        }
+
+        for (int i = 0; i < CHECK_W * CHECK_H; i++)
+        {
+            int s = demo_ca_get(&ca, i % CHECK_W, i / CHECK_W);
+            if (s != ref[cur][i])
+            {
+                rt_kprintf("rule %d/%d/%d, step %d, cell (%d, %d): %d, expected %d\n", r->type, r->neigh, r->states,
+                           step, i % CHECK_W, i / CHECK_W, s, ref[cur][i]);
+                demo_ca_deinit(&ca);
+                return -1;
+            }
+        }
+    }
+
+    int scale = 255 / (r->states - 1);
+    memset(out, 0xA5, sizeof(out));
+    demo_ca_render(&ca, out, CHECK_STRIDE, scale);
+    for (int i = 0; i < CHECK_W * CHECK_H; i++)
+    {
+        int y = i / CHECK_W, x = i % CHECK_W;
+        if (out[y * CHECK_STRIDE + x] != ref[cur][i] * scale || out[y * CHECK_STRIDE + CHECK_W] != 0xA5)
+        {
+            rt_kprintf("rule %d/%d/%d, render (%d, %d): %d, expected %d\n", r->type, r->neigh, r->states, x, y,
+                       out[y * CHECK_STRIDE + x], ref[cur][i] * scale);
+            demo_ca_deinit(&ca);
+            return -1;
+        }
+    }
+
+    demo_ca_deinit(&ca);
+    return 0;
+}
+
+/* 稀疏突变：从全 0 出发，改写数符合期望，且命中位在字内各四分之一段大致均匀 (检验条件分布取样) */
+static int ca_check_sparse(void)
+{
+    static const struct demo_ca_rule rule = DEMO_CA_RULE_CYCLIC(16, DEMO_CA_VON_NEUMANN, 1);
+    struct demo_ca                   ca;
+    struct demo_rand                 rng;
+    uint32_t                         total = 0, changed = 0;
+    int                              hist[4] = {0};
+    int                              ret     = 0;
+
+    if (demo_ca_init(&ca, CHECK_W, CHECK_H, &rule) < 0)
+        return -1;
+    demo_rand_seed(&rng, 5);
+
+    for (int round = 0; round < CHECK_ROUNDS; round++)
+    {
+        demo_ca_clear(&ca);
+        total += demo_ca_mutate(&ca, &rng, CHECK_SPARSE);
+        for (int i = 0; i < CHECK_W * CHECK_H; i++)
+        {
+            if (demo_ca_get(&ca, i % CHECK_W, i / CHECK_W))
+            {
+                hist[(i % CHECK_W % CA_BITS) * 4 / CA_BITS]++;
+                changed++;
+            }
+        }
+    }
+
+    int expect = CHECK_ROUNDS * CHECK_W * CHECK_H * CHECK_SPARSE / 65536;
+    int tol    = 4 * (int)demo_isqrt((uint32_t)expect) + 1;
+    if (ABS((int)total - expect) > tol || changed > total)
+        ret = -1;
+    for (int k = 0; k < 4; k++)
+        if (ABS(hist[k] * 4 - (int)changed) > 4 * tol)
+            ret = -1;
+
+    rt_kprintf("sparse mutation: %u rewritten (expected %d +- %d), per quarter word %d / %d / %d / %d: %s\n", total,
+               expect, tol, hist[0], hist[1], hist[2], hist[3], ret ? "FAIL" : "ok");
+    demo_ca_deinit(&ca);
+    return ret;
+}
+
+static int ca_check(void)
+{
+    int      n       = (int)(sizeof(g_check_rules) / sizeof(g_check_rules[0]));
+    uint32_t mutated = 0;
+    int      ret     = 0;
+
+    for (int k = 0; k < n && !ret; k++)
+        ret = ca_check_rule(&g_check_rules[k], &mutated);
+
+    /* 每条规则突变 5 次，每次期望 W * H / 16 个 */
+    int expect = n * 5 * CHECK_W * CHECK_H / 16;
+    int tol    = 4 * (int)demo_isqrt((uint32_t)expect) + 1;
+    if (!ret && ABS((int)mutated - expect) > tol)
+    {
+        rt_kprintf("mutate rewrote %u cells, expected %d +- %d\n", mutated, expect, tol);
+        ret = -1;
+    }
+
+    rt_kprintf("%d rules, %d x %d, %d steps, %d-cell words: %s\n", n, CHECK_W, CHECK_H, CHECK_STEPS, CA_BITS,
+               ret ? "FAIL" : "ok");
+    if (!ret)
+        ret = ca_check_sparse();
+    return ret;
+}
+
+/* --- 基准：原 0018 的逐字节写法 (分支比较 + 逐格随机数 + RGB565 查表) vs 位切片 --- */
+
+#define BENCH_STEPS  16
+#define BENCH_STATES 16
+#define BENCH_P16    15 /* 与 0018 的突变概率相同 */
+
+static void ca_bench_size(int width, int height)
+{
+    static const struct demo_ca_rule rule = DEMO_CA_RULE_CYCLIC(BENCH_STATES, DEMO_CA_VON_NEUMANN, 1);
+
+    uint8_t         *st[2] = {(uint8_t *)rt_malloc(width * height), (uint8_t *)rt_malloc(width * height)};
+    uint16_t        *tex   = (uint16_t *)rt_malloc(width * height * 2);
+    uint8_t         *idx   = (uint8_t *)rt_malloc(width * height);
+    struct demo_ca   ca;
+    struct demo_rand rng;
+    uint16_t         pal[BENCH_STATES];
+
+    if (st[0] && st[1] && tex && idx && demo_ca_init(&ca, width, height, &rule) == 0)
+    {
+        for (int i = 0; i < BENCH_STATES; i++)
+            pal[i] = (uint16_t)(i * 0x1111);
+
+        demo_rand_seed(&rng, 1);
+        for (int i = 0; i < width * height; i++)
+            st[0][i] = (uint8_t)demo_rand_range(&rng, BENCH_STATES);
+        memcpy(st[1], st[0], width * height);
+
+        uint64_t t0 = demo_perf_now_us();
+        for (int step = 0; step < BENCH_STEPS; step++)
+        {
+            uint8_t *src = st[step & 1], *dst = st[(step & 1) ^ 1];
+            for (int y = 1; y < height - 1; y++)
+            {
+                for (int x = 1; x < width - 1; x++)
+                {
+                    int     i    = y * width + x;
+                    uint8_t next = (uint8_t)((src[i] + 1) & (BENCH_STATES - 1));
+                    if (src[i - 1] == next || src[i + 1] == next || src[i - width] == next || src[i + width] == next)
+                        dst[i] = next;
+                    else
+                        dst[i] = src[i];
+                    tex[i] = pal[dst[i]];
+
+                    uint32_t rnd = demo_rand_next(&rng);
+                    if ((rnd & 0xFFFF) > 0xFFFF - BENCH_P16)
+                        dst[i] = (uint8_t)demo_rand_scale16(rnd >> 16, BENCH_STATES);
+                }
+            }
+        }
+
+        demo_ca_randomize(&ca, &rng);
+        uint32_t step_us = 0, mutate_us = 0, render_us = 0;
+        uint64_t t1      = demo_perf_now_us();
+        for (int step = 0; step < BENCH_STEPS; step++)
+        {
+            demo_ca_step(&ca);
+            uint64_t tm = demo_perf_now_us();
+            demo_ca_mutate(&ca, &rng, BENCH_P16);
+            mutate_us += (uint32_t)(demo_perf_now_us() - tm);
+            demo_ca_render(&ca, idx, width, 255 / (BENCH_STATES - 1));
+            step_us += ca.stats.step_us;
+            render_us += ca.stats.render_us;
+        }
+        uint64_t t2 = demo_perf_now_us();
+
+        rt_kprintf("%3d x %-3d %8u %8u %8u %8u %8u\n", width, height, (uint32_t)((t1 - t0) / BENCH_STEPS),
+                   (uint32_t)((t2 - t1) / BENCH_STEPS), step_us / BENCH_STEPS, mutate_us / BENCH_STEPS,
+                   render_us / BENCH_STEPS);
+        demo_ca_deinit(&ca);
+    }
+
+    for (int i = 0; i < 2; i++)
+        if (st[i])
+            rt_free(st[i]);
+    if (tex)
+        rt_free(tex);
+    if (idx)
+        rt_free(idx);
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_ca(int argc, char **argv)
+{
+    const struct demo_ca *ca = g_ca_active;
+
+    if (argc > 1 && strcmp(argv[1], "check") == 0)
+    {
+        rt_kprintf("--- Bit-sliced automaton vs scalar ---\n");
+        int ret = ca_check();
+        rt_kprintf("%s\n", ret ? "FAIL" : "PASS");
+        return ret;
+    }
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        rt_kprintf("--- Cyclic automaton bench (us / generation, 16 states, incl. mutation and shading) ---\n");
+        rt_kprintf("%-9s %8s %8s %8s %8s %8s\n", "grid", "byte", "sliced", "step", "mutate", "render");
+        ca_bench_size(DEMO_QVGA_W, DEMO_QVGA_H);
+        ca_bench_size(DEMO_SCREEN_WIDTH, DEMO_SCREEN_HEIGHT);
+        return 0;
+    }
+
+    if (!ca || !ca->stats.steps)
+    {
+        rt_kprintf("No cellular automaton instance is active.\n");
+        return 0;
+    }
+
+    rt_kprintf("--- Cellular Automaton (%d x %d, %d-cell words, %d planes) ---\n", ca->width, ca->height, CA_BITS,
+               ca->planes);
+    rt_kprintf("rule: %s, %d states, %d neighbours, birth 0x%03x, survive 0x%03x\n",
+               ca->rule.type == DEMO_CA_CYCLIC ? "cyclic" : "generations", ca->rule.states, ca->rule.neigh,
+               ca->rule.birth, ca->rule.survive);
+    rt_kprintf("steps %u, last step %u us, render %u us, mutated %u\n", ca->stats.steps, ca->stats.step_us,
+               ca->stats.render_us, ca->stats.mutated);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_ca, demo_ca, Show cellular automaton stats [check|bench]);
@@ -0,0 +1,107 @@
+/*
+ * Filename: demo_ca.h
+ * THE LOOM OF GENERATIONS
+ * 世代织机
+ *
+ * 位切片细胞自动机：每个细胞的状态号 (2 ~ 16 个状态，1 ~ 4 位) 按位拆成若干位平面，
+ * 一个寄存器字存放同一行 32 (RV32) 或 64 (RV64 / 64 位主机) 个细胞的同一位。
+ * 邻居比较、计数与规则查表都化为整字的与或非和移位，一次更新整字的细胞，没有逐格分支。
+ *
+ * 规则分两类，均可任意组合邻域 (冯诺依曼 4 邻 / 摩尔 8 邻)：
+ *   循环 (CCA)：邻居中处于 "当前状态 + 1" 的个数满足 birth 表时前进到该状态，否则不变。
+ *   世代 (Generations)：状态 1 为活细胞，0 为空，2 ~ states-1 为逐帧衰亡的余烬；
+ *       空格按活邻居数查 birth 表诞生，活细胞查 survive 表存活 (否则开始衰亡)。
+ *       states = 2 即 Life 类规则 (B3/S23 等)，states = 3 即 Brian's Brain。
+ * 网格上下左右环绕 (环面)，没有边界行列。
+ *
+ * 突变按字成批取样：每字一次随机数判定是否含突变，命中的字才以 demo_rand_mask16 生成稀疏掩码，
+ * 再只对掩码命中的极少数细胞逐个取新状态。
+ * 着色每两个位平面查一次 256 项表，每 4 个细胞一次 32 位写出 8 位索引 (状态号 * scale)。
+ */
+
+#ifndef _DEMO_CA_H_
+#define _DEMO_CA_H_
+
+#include "demo_engine.h"
+#include "demo_rand.h"
+
+#define DEMO_CA_MAX_STATES 16
+#define DEMO_CA_MAX_PLANES 4
+#define DEMO_CA_ALIGN      64 /* 宽度须为 64 的倍数 (RV32 / RV64 通用) */
+
+enum demo_ca_type
+{
+    DEMO_CA_CYCLIC = 0,  /* 循环捕食：birth 表按 "处于后继状态的邻居数" 索引 */
+    DEMO_CA_GENERATIONS, /* 世代：birth / survive 表按活邻居数索引 */
+};
+
+enum demo_ca_neigh
+{
+    DEMO_CA_VON_NEUMANN = 4, /* 上下左右 */
+    DEMO_CA_MOORE       = 8, /* 含四个对角 */
+};
+
+struct demo_ca_rule
+{
+    uint8_t  type;    /* enum demo_ca_type */
+    uint8_t  neigh;   /* enum demo_ca_neigh */
+    uint8_t  states;  /* 2 ~ DEMO_CA_MAX_STATES */
+    uint16_t birth;   /* 第 n 位 = 有 n 个 (后继 / 活) 邻居时前进 (n = 0 ~ 8) */
+    uint16_t survive; /* 世代：第 n 位 = 活细胞有 n 个活邻居时存活；循环规则忽略 */
+};
+
+/* 常用规则：循环规则的阈值为 "至少 thr 个邻居处于后继状态" */
+#define DEMO_CA_RULE_CYCLIC(n, nb, thr) {DEMO_CA_CYCLIC, (nb), (n), (uint16_t)((0x1FF << (thr)) & 0x1FF), 0}
+#define DEMO_CA_RULE_LIFE               {DEMO_CA_GENERATIONS, DEMO_CA_MOORE, 2, 1 << 3, (1 << 2) | (1 << 3)}
+#define DEMO_CA_RULE_BRIAN              {DEMO_CA_GENERATIONS, DEMO_CA_MOORE, 3, 1 << 2, 0}
+
+struct demo_ca_stats
+{
+    uint32_t steps;     /* 已推进的步数 */
+    uint32_t mutated;   /* 最近一次 demo_ca_mutate 改写的细胞数 */
+    uint32_t step_us;   /* 最近一步的耗时 */
+    uint32_t render_us; /* 最近一次 demo_ca_render 的耗时 */
+};
+
+struct demo_ca
+{
+    int width, height; /* 细胞数，width 为 DEMO_CA_ALIGN 的倍数 */
+    int words;         /* 每行每个位平面的寄存器字数 */
+    int planes;        /* 位平面数 = ceil(log2(states)) */
+
+    struct demo_ca_rule rule;
+
+    void *buf[2]; /* 两代状态，每行依次存放各位平面；buf[cur] 为最新一代 */
+    int   cur;
+
+    uint32_t lut[2][256]; /* 着色表 (两个位平面一组)，按 lut_scale 缓存 */
+    int      lut_scale;
+
+    struct demo_ca_stats stats;
+};
+
+/* 按规则分配两代状态 (rt_malloc) 并清零；尺寸或规则不合法、分配失败返回 -1。可在预备线程中调用 */
+int  demo_ca_init(struct demo_ca *ca, int width, int height, const struct demo_ca_rule *rule);
+void demo_ca_deinit(struct demo_ca *ca);
+
+/* 全部细胞置为状态 0 / 在 [0, states) 内均匀随机 */
+void demo_ca_clear(struct demo_ca *ca);
+void demo_ca_randomize(struct demo_ca *ca, struct demo_rand *rng);
+
+/* 读写最新一代的单个细胞 (坐标环绕) */
+int  demo_ca_get(const struct demo_ca *ca, int x, int y);
+void demo_ca_set(struct demo_ca *ca, int x, int y, int state);
+
+/* 推进一代 */
+void demo_ca_step(struct demo_ca *ca);
+
+/* 每个细胞以 p16 / 65536 的概率改为 [0, states) 内的随机状态，返回改写的细胞数 */
+uint32_t demo_ca_mutate(struct demo_ca *ca, struct demo_rand *rng, uint32_t p16);
+
+/*
+ * 把最新一代写为 8 位索引：idx = state * scale，(states - 1) * scale 不得超过 255。
+ * dst 为 width x height 的索引纹理 (地址与 stride 按 4 字节对齐)。
+ */
+void demo_ca_render(struct demo_ca *ca, uint8_t *dst, int stride, int scale);
+
+#endif /* _DEMO_CA_H_ */
@@ -0,0 +1,711 @@
+/*
+ * Filename: demo_cell.c
+ * THE SURVEY OF CELLS
+ * 晶胞测绘
+ *
+ * 候选表的正确性：对网格块 R，记种子 s 到 R 的最近 / 最远距离为 dmin(s) / dmax(s)，
+ * M2 为所有 dmax 中的次小值。块内任一像素至少有两个种子在 M2 以内，故 F2 <= M2，
+ * dmin > M2 的种子不可能成为 F1 / F2。种子移动后距离的变化不超过位移 (三角不等式)，
+ * 位移不超过 margin 时 F2 <= M2 + margin，而被排除的种子仍远于 M2 + margin，
+ * 所以构建时以 M2 + 2 * margin 为门限即可在余量内复用。
+ *
+ * 逐环搜索：第 r 环 (r >= 1) 的网格块与 R 在某一轴上至少相隔 (r - 1) * TILE + 1 像素，
+ * 三种度量下距离都不小于该值；它超过门限时即可停止。区域外的种子钳入边缘网格块，
+ * 钳位只会缩短轴向间隔，下界仍然成立。
+ */
+
+#include "demo_cell.h"
+#include "demo_math.h"
+#include "demo_perf.h"
+#include "demo_rand.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const struct demo_cell *g_cell_active; /* 最近一次 init 的实例 (供 demo_cell 指令查看) */
+
+/* --- 度量 --- */
+
+/* 由轴向距离合成度量值；欧氏距离以平方表示，比较时与其余度量同序 */
+static inline uint32_t cell_dist(int metric, uint32_t dx, uint32_t dy)
+{
+    switch (metric)
+    {
+    case DEMO_CELL_EUCLIDEAN:
+        return dx * dx + dy * dy;
+    case DEMO_CELL_CHEBYSHEV:
+        return MAX(dx, dy);
+    default:
+        return dx + dy;
+    }
+}
+
+/* 度量值 -> 像素距离 */
+static inline uint32_t cell_len(int metric, uint32_t d)
+{
+    return metric == DEMO_CELL_EUCLIDEAN ? demo_isqrt(d) : d;
+}
+
+/* 像素距离 -> 度量值 */
+static inline uint32_t cell_raw(int metric, uint32_t len)
+{
+    return metric == DEMO_CELL_EUCLIDEAN ? len * len : len;
+}
+
+/* 度量值 -> 向上取整的像素距离 */
+static inline uint32_t cell_ceil_len(int metric, uint32_t d)
+{
+    uint32_t len = cell_len(metric, d);
+    return cell_raw(metric, len) < d ? len + 1 : len;
+}
+
+/* 种子到矩形 [x0, x1] x [y0, y1] 的最近 / 最远距离 (度量值) */
+static inline void cell_bounds(int metric, const struct demo_cell_site *s, int x0, int y0, int x1, int y1,
+                               uint32_t *dmin, uint32_t *dmax)
+{
+    uint32_t gx = (uint32_t)MAX(MAX(x0 - s->x, s->x - x1), 0);
+    uint32_t gy = (uint32_t)MAX(MAX(y0 - s->y, s->y - y1), 0);
+    uint32_t fx = (uint32_t)MAX(ABS(s->x - x0), ABS(s->x - x1));
+    uint32_t fy = (uint32_t)MAX(ABS(s->y - y0), ABS(s->y - y1));
+
+    *dmin = cell_dist(metric, gx, gy);
+    *dmax = cell_dist(metric, fx, fy);
+}
+
+/* 维护最远距离中的最小两个值 m[0] <= m[1] */
+static inline void cell_keep2(uint32_t *m, uint32_t d)
+{
+    if (d < m[1])
+    {
+        m[1] = MAX(d, m[0]);
+        m[0] = MIN(d, m[0]);
+    }
+}
+
+static inline int cell_clamp_tile(int v, int shift, int n)
+{
+    return CLAMP(v >> shift, 0, n - 1);
+}
+
+/* --- 初始化 --- */
+
+int demo_cell_init(struct demo_cell *c, int width, int height, int max_sites, int metric)
+{
+    rt_memset(c, 0, sizeof(*c));
+    c->width     = width;
+    c->height    = height;
+    c->max_sites = MIN(max_sites, DEMO_CELL_ALL - 1);
+    c->metric    = metric;
+    c->cand_cap  = c->max_sites * DEMO_CELL_CAND_SITE;
+
+    /* 网格按最小的网格块分配 */
+    int tiles  = ((width + (1 << DEMO_CELL_TILE_MIN) - 1) >> DEMO_CELL_TILE_MIN) *
+                ((height + (1 << DEMO_CELL_TILE_MIN) - 1) >> DEMO_CELL_TILE_MIN);
+    c->anchor  = (struct demo_cell_site *)rt_malloc(c->max_sites * sizeof(*c->anchor));
+    c->bucket  = (uint16_t *)rt_malloc(c->max_sites * sizeof(*c->bucket));
+    c->visit   = (uint16_t *)rt_malloc(c->max_sites * sizeof(*c->visit));
+    c->visit_d = (uint32_t *)rt_malloc(c->max_sites * sizeof(*c->visit_d));
+    c->start   = (uint16_t *)rt_malloc((tiles + 1) * sizeof(*c->start));
+    c->tile    = (struct demo_cell_tile *)rt_malloc(tiles * sizeof(*c->tile));
+    c->cand    = (uint16_t *)rt_malloc(c->cand_cap * sizeof(*c->cand));
+
+    if (!c->anchor || !c->bucket || !c->visit || !c->visit_d || !c->start || !c->tile || !c->cand)
+    {
+        LOG_E("Cell: alloc failed (%d x %d, %d sites)", width, height, max_sites);
+        demo_cell_deinit(c);
+        return -1;
+    }
+
+    g_cell_active = c;
+    return 0;
+}
+
+void demo_cell_deinit(struct demo_cell *c)
+{
+    void *bufs[] = {c->anchor, c->bucket, c->visit, c->visit_d, c->start, c->tile, c->cand};
+
+    for (int i = 0; i < (int)(sizeof(bufs) / sizeof(bufs[0])); i++)
+    {
+        if (bufs[i])
+            rt_free(bufs[i]);
+    }
+    if (g_cell_active == c)
+        g_cell_active = NULL;
+    rt_memset(c, 0, sizeof(*c));
+}
+
+/* --- 候选表重建 --- */
+
+/* 计数排序：按锚点所在网格块分桶 */
+static void cell_bucket(struct demo_cell *c)
+{
+    int tiles = c->tiles_x * c->tiles_y;
+
+    rt_memset(c->start, 0, (tiles + 1) * sizeof(*c->start));
+    for (int i = 0; i < c->count; i++)
+    {
+        const struct demo_cell_site *s = &c->anchor[i];
+        int t = cell_clamp_tile(s->y, c->tile_shift, c->tiles_y) * c->tiles_x + cell_clamp_tile(s->x, c->tile_shift, c->tiles_x);
+        c->start[t + 1]++;
+    }
+    for (int t = 0; t < tiles; t++)
+        c->start[t + 1] += c->start[t];
+
+    /* 逐个放入桶中，写完后 start[t] 指向下一桶的起点，整体后移一项复原 */
+    for (int i = 0; i < c->count; i++)
+    {
+        const struct demo_cell_site *s = &c->anchor[i];
+        int t = cell_clamp_tile(s->y, c->tile_shift, c->tiles_y) * c->tiles_x + cell_clamp_tile(s->x, c->tile_shift, c->tiles_x);
+        c->bucket[c->start[t]++] = (uint16_t)i;
+    }
+    for (int t = tiles; t > 0; t--)
+        c->start[t] = c->start[t - 1];
+    c->start[0] = 0;
+}
+
+/* 访问网格块 (bx, by) 中的种子：记录 dmin，并维护 dmax 的最小两个值 */
+static int cell_visit(struct demo_cell *c, int bx, int by, int x0, int y0, int x1, int y1, int n, uint32_t *m)
+{
+    int t = by * c->tiles_x + bx;
+
+    for (int k = c->start[t]; k < c->start[t + 1]; k++)
+    {
+        int      i = c->bucket[k];
+        uint32_t dmax;
+
+        cell_bounds(c->metric, &c->anchor[i], x0, y0, x1, y1, &c->visit_d[n], &dmax);
+        cell_keep2(m, dmax);
+        c->visit[n++] = (uint16_t)i;
+    }
+    return n;
+}
+
+/* 构建网格块 (tx, ty) 的候选表，写入候选池的 off 处；返回候选数，放不下时返回 DEMO_CELL_ALL */
+static int cell_build_tile(struct demo_cell *c, int tx, int ty, uint32_t off)
+{
+    int      size  = 1 << c->tile_shift;
+    int      x0    = tx * size;
+    int      y0    = ty * size;
+    int      x1    = MIN(x0 + size, c->width) - 1;
+    int      y1    = MIN(y0 + size, c->height) - 1;
+    int      rings = MAX(MAX(tx, c->tiles_x - 1 - tx), MAX(ty, c->tiles_y - 1 - ty));
+    uint32_t m[2]  = {UINT32_MAX, UINT32_MAX};
+    uint32_t limit = UINT32_MAX; /* 门限 (像素距离) */
+    int      n     = 0;
+
+    for (int r = 0; r <= rings; r++)
+    {
+        if (r > 0 && (uint32_t)((r - 1) * size + 1) > limit)
+            break;
+
+        for (int by = ty - r; by <= ty + r; by++)
+        {
+            if (by < 0 || by >= c->tiles_y)
+                continue;
+            /* 环上的行：首尾两行取整行，其余只取左右两端 */
+            int step = (by == ty - r || by == ty + r) ? 1 : MAX(2 * r, 1);
+            for (int bx = tx - r; bx <= tx + r; bx += step)
+            {
+                if (bx >= 0 && bx < c->tiles_x)
+                    n = cell_visit(c, bx, by, x0, y0, x1, y1, n, m);
+            }
+        }
+
+        /* 欧氏距离向上取整，门限只会偏大 (多留候选，结果不变) */
+        if (m[1] != UINT32_MAX)
+            limit = cell_ceil_len(c->metric, m[1]) + 2 * (uint32_t)c->margin;
+    }
+
+    uint32_t raw = limit == UINT32_MAX ? UINT32_MAX : cell_raw(c->metric, limit);
+    int      num = 0;
+
+    for (int k = 0; k < n; k++)
+    {
+        if (c->visit_d[k] > raw)
+            continue;
+        if (off + num >= (uint32_t)c->cand_cap)
+            return DEMO_CELL_ALL;
+        c->cand[off + num++] = c->visit[k];
+    }
+    return num;
+}
+
+static void cell_rebuild(struct demo_cell *c)
+{
+    uint64_t t0  = demo_perf_now_us();
+    uint32_t off = 0;
+
+    rt_memcpy(c->anchor, c->sites, c->count * sizeof(*c->anchor));
+    cell_bucket(c);
+
+    c->stats.overflow = 0;
+    for (int ty = 0; ty < c->tiles_y; ty++)
+    {
+        for (int tx = 0; tx < c->tiles_x; tx++)
+        {
+            struct demo_cell_tile *t = &c->tile[ty * c->tiles_x + tx];
+
+            t->off = off;
+            t->num = (uint16_t)cell_build_tile(c, tx, ty, off);
+            if (t->num == DEMO_CELL_ALL)
+                c->stats.overflow++;
+            else
+                off += t->num;
+        }
+    }
+
+    c->stats.rebuilds++;
+    c->stats.candidates = off;
+    c->stats.rebuild_us = (uint32_t)(demo_perf_now_us() - t0);
+}
+
+/* 按种子数选取网格块边长 (面积按 4 的幂取整)，细分块为其 1/4，余量为其 1/4 */
+static void cell_layout(struct demo_cell *c)
+{
+    uint32_t area = (uint32_t)c->width * c->height * DEMO_CELL_DENSITY;
+    int      s    = DEMO_CELL_TILE_MIN;
+
+    while (s < DEMO_CELL_TILE_MAX && ((uint32_t)2 << (2 * s)) * (uint32_t)MAX(c->count, 1) < area)
+        s++;
+
+    c->tile_shift = s;
+    c->sub_shift  = MAX(s - 2, DEMO_CELL_SUB_MIN);
+    c->tiles_x    = (c->width + (1 << s) - 1) >> s;
+    c->tiles_y    = (c->height + (1 << s) - 1) >> s;
+    c->margin     = (1 << s) >> 2;
+}
+
+void demo_cell_update(struct demo_cell *c, const struct demo_cell_site *sites, int count)
+{
+    count        = MIN(count, c->max_sites);
+    bool rebuild = count != c->count || c->stats.rebuilds == 0;
+
+    c->sites = sites;
+    c->count = count;
+    c->stats.updates++;
+
+    if (rebuild)
+        cell_layout(c);
+
+    /* 相对重建时的位移超出余量才重建 */
+    uint32_t raw = cell_raw(c->metric, (uint32_t)c->margin);
+    for (int i = 0; i < count && !rebuild; i++)
+    {
+        uint32_t dx = (uint32_t)ABS(sites[i].x - c->anchor[i].x);
+        uint32_t dy = (uint32_t)ABS(sites[i].y - c->anchor[i].y);
+        rebuild     = cell_dist(c->metric, dx, dy) > raw;
+    }
+
+    if (rebuild)
+        cell_rebuild(c);
+}
+
+/* --- 渲染 --- */
+
+#define CELL_SUB_MAX (1 << MAX(DEMO_CELL_TILE_MAX - 2, DEMO_CELL_SUB_MIN))
+
+/* 一个细分块：候选 (visit) 主序，逐个种子更新整行的 F1 / F2 */
+static inline void cell_render_block(const struct demo_cell *c, int n, int x0, int y0, int w, int h, uint8_t *dst,
+                                     int stride, int feature, int gain, const int metric)
+{
+    uint32_t f1[CELL_SUB_MAX], f2[CELL_SUB_MAX];
+    uint16_t id[CELL_SUB_MAX];
+
+    for (int y = y0; y < y0 + h; y++, dst += stride)
+    {
+        for (int j = 0; j < w; j++)
+        {
+            f1[j] = UINT32_MAX;
+            f2[j] = UINT32_MAX;
+            id[j] = 0;
+        }
+
+        for (int k = 0; k < n; k++)
+        {
+            int                          i  = c->visit[k];
+            const struct demo_cell_site *s  = &c->sites[i];
+            uint32_t                     dy = (uint32_t)ABS(y - s->y);
+
+            for (int j = 0; j < w; j++)
+            {
+                uint32_t d = cell_dist(metric, (uint32_t)ABS(x0 + j - s->x), dy);
+                if (d < f2[j])
+                {
+                    if (d < f1[j])
+                    {
+                        f2[j] = f1[j];
+                        f1[j] = d;
+                        id[j] = (uint16_t)i;
+                    }
+                    else
+                    {
+                        f2[j] = d;
+                    }
+                }
+            }
+        }
+
+        for (int j = 0; j < w; j++)
+        {
+            uint32_t a = f1[j] == UINT32_MAX ? DEMO_CELL_FAR : MIN(cell_len(metric, f1[j]), DEMO_CELL_FAR);
+            uint32_t b = f2[j] == UINT32_MAX ? DEMO_CELL_FAR : MIN(cell_len(metric, f2[j]), DEMO_CELL_FAR);
+            uint32_t v;
+
+            switch (feature)
+            {
+            case DEMO_CELL_ID:
+                dst[j] = (uint8_t)id[j];
+                continue;
+            case DEMO_CELL_F1:
+                v = a;
+                break;
+            case DEMO_CELL_F2:
+                v = b;
+                break;
+            default:
+                v = b - a;
+                break;
+            }
+            dst[j] = (uint8_t)MIN((v * (uint32_t)gain) >> 4, 255);
+        }
+    }
+}
+
+/* 细分块：以本帧的种子位置从网格块候选中筛出本块的候选 (无需余量)，写入 visit */
+static inline int cell_refine(struct demo_cell *c, const uint16_t *ids, int n, int x0, int y0, int x1, int y1,
+                              const int metric)
+{
+    uint32_t m[2] = {UINT32_MAX, UINT32_MAX};
+    uint32_t dmax;
+    int      num  = 0;
+
+    for (int k = 0; k < n; k++)
+    {
+        cell_bounds(metric, &c->sites[ids ? ids[k] : k], x0, y0, x1, y1, &c->visit_d[k], &dmax);
+        cell_keep2(m, dmax);
+    }
+    for (int k = 0; k < n; k++)
+    {
+        if (c->visit_d[k] <= m[1])
+            c->visit[num++] = ids ? ids[k] : (uint16_t)k;
+    }
+    return num;
+}
+
+/* 一个网格块：逐个细分块筛选候选并渲染，返回细分块候选数之和 */
+static inline uint32_t cell_render_tile(struct demo_cell *c, int tx, int ty, uint8_t *dst, int stride, int feature,
+                                        int gain, const int metric)
+{
+    const struct demo_cell_tile *t     = &c->tile[ty * c->tiles_x + tx];
+    const uint16_t              *ids   = t->num == DEMO_CELL_ALL ? NULL : &c->cand[t->off];
+    int                          n     = t->num == DEMO_CELL_ALL ? c->count : t->num;
+    int                          sub   = 1 << c->sub_shift;
+    int                          tx0   = tx << c->tile_shift;
+    int                          ty0   = ty << c->tile_shift;
+    int                          tx1   = MIN(tx0 + (1 << c->tile_shift), c->width);
+    int                          ty1   = MIN(ty0 + (1 << c->tile_shift), c->height);
+    uint32_t                     total = 0;
+
+    for (int y0 = ty0; y0 < ty1; y0 += sub)
+    {
+        for (int x0 = tx0; x0 < tx1; x0 += sub)
+        {
+            int w   = MIN(sub, tx1 - x0);
+            int h   = MIN(sub, ty1 - y0);
+            int num = cell_refine(c, ids, n, x0, y0, x0 + w - 1, y0 + h - 1, metric);
+
+            cell_render_block(c, num, x0, y0, w, h, dst + y0 * stride + x0, stride, feature, gain, metric);
+            total += num;
+        }
+    }
+    return total;
+}
+
+void demo_cell_render(struct demo_cell *c, uint8_t *dst, int stride, int feature, int gain)
+{
+    uint64_t t0    = demo_perf_now_us();
+    uint32_t total = 0;
+
+    for (int ty = 0; ty < c->tiles_y; ty++)
+    {
+        for (int tx = 0; tx < c->tiles_x; tx++)
+        {
+            /* 度量按常量展开，内层循环中不再分支 */
+            switch (c->metric)
+            {
+            case DEMO_CELL_EUCLIDEAN:
+                total += cell_render_tile(c, tx, ty, dst, stride, feature, gain, DEMO_CELL_EUCLIDEAN);
+                break;
+            case DEMO_CELL_CHEBYSHEV:
+                total += cell_render_tile(c, tx, ty, dst, stride, feature, gain, DEMO_CELL_CHEBYSHEV);
+                break;
+            default:
+                total += cell_render_tile(c, tx, ty, dst, stride, feature, gain, DEMO_CELL_MANHATTAN);
+                break;
+            }
+        }
+    }
+
+    c->stats.refined   = total;
+    c->stats.render_us = (uint32_t)(demo_perf_now_us() - t0);
+}
+
+int demo_cell_query(const struct demo_cell *c, int x, int y, int *f1, int *f2)
+{
+    const uint16_t *ids = NULL;
+    int             n   = c->count;
+    uint32_t        a   = UINT32_MAX;
+    uint32_t        b   = UINT32_MAX;
+    int             id  = -1;
+
+    /* 区域内取所在网格块的候选，区域外扫描全部种子 */
+    if (x >= 0 && x < c->width && y >= 0 && y < c->height && c->stats.rebuilds)
+    {
+        const struct demo_cell_tile *t = &c->tile[(y >> c->tile_shift) * c->tiles_x + (x >> c->tile_shift)];
+        if (t->num != DEMO_CELL_ALL)
+        {
+            ids = &c->cand[t->off];
+            n   = t->num;
+        }
+    }
+
+    for (int k = 0; k < n; k++)
+    {
+        int      i = ids ? ids[k] : k;
+        uint32_t d = cell_dist(c->metric, (uint32_t)ABS(x - c->sites[i].x), (uint32_t)ABS(y - c->sites[i].y));
+        if (d < a)
+        {
+            b  = a;
+            a  = d;
+            id = i;
+        }
+        else if (d < b)
+        {
+            b = d;
+        }
+    }
+
+    if (f1)
+        *f1 = a == UINT32_MAX ? DEMO_CELL_FAR : (int)MIN(cell_len(c->metric, a), DEMO_CELL_FAR);
+    if (f2)
+        *f2 = b == UINT32_MAX ? DEMO_CELL_FAR : (int)MIN(cell_len(c->metric, b), DEMO_CELL_FAR);
+    return id;
+}
+
+/* --- 自检：与逐像素扫描全部种子的参照逐位比较 --- */
+
+#define CHECK_W      100 /* 非网格块整数倍，覆盖边缘块 */
+#define CHECK_H      70
+#define CHECK_SITES  400
+#define CHECK_FRAMES 6
+#define CHECK_STEP   3
+
+static struct demo_rand g_cell_rng;
+
+static int cell_rand(int n)
+{
+    return (int)demo_rand_range(&g_cell_rng, (uint32_t)n);
+}
+
+static int check_frame(struct demo_cell *c, uint8_t *out, int feature)
+{
+    int bad = 0;
+
+    demo_cell_render(c, out, CHECK_W, feature, 16);
+    for (int y = 0; y < CHECK_H; y++)
+    {
+        for (int x = 0; x < CHECK_W; x++)
+        {
+            uint32_t a = UINT32_MAX, b = UINT32_MAX;
+            for (int i = 0; i < c->count; i++)
+            {
+                uint32_t d = cell_dist(c->metric, (uint32_t)ABS(x - c->sites[i].x), (uint32_t)ABS(y - c->sites[i].y));
+                b          = MIN(b, MAX(a, d));
+                a          = MIN(a, d);
+            }
+            a = a == UINT32_MAX ? DEMO_CELL_FAR : cell_len(c->metric, a);
+            b = b == UINT32_MAX ? DEMO_CELL_FAR : cell_len(c->metric, b);
+
+            uint32_t v = feature == DEMO_CELL_F1 ? a : feature == DEMO_CELL_F2 ? b : b - a;
+            if (out[y * CHECK_W + x] != MIN(v, 255) && bad++ < 4)
+                rt_kprintf("  (%d, %d): %u != %u\n", x, y, out[y * CHECK_W + x], MIN(v, 255));
+        }
+    }
+    return bad;
+}
+
+static int cell_check(void)
+{
+    static const int counts[] = {1, 2, 7, 60, CHECK_SITES, -CHECK_SITES}; /* 负数：全部聚在角落 */
+    struct demo_cell       c;
+    struct demo_cell_site *sites = (struct demo_cell_site *)rt_malloc(CHECK_SITES * sizeof(*sites));
+    uint8_t               *out   = (uint8_t *)rt_malloc(CHECK_W * CHECK_H);
+    int                    ret   = 0;
+
+    if (!sites || !out)
+        goto out;
+
+    demo_rand_seed(&g_cell_rng, 0);
+    for (int metric = DEMO_CELL_MANHATTAN; metric <= DEMO_CELL_CHEBYSHEV; metric++)
+    {
+        for (int k = 0; k < (int)(sizeof(counts) / sizeof(counts[0])); k++)
+        {
+            int n   = ABS(counts[k]);
+            int bad = 0;
+
+            if (demo_cell_init(&c, CHECK_W, CHECK_H, CHECK_SITES, metric) < 0)
+                goto out;
+
+            /* 一半 (或全部) 聚在角落，其余散布并越出区域边界；全部聚集时候选池溢出、退化为全扫描 */
+            for (int i = 0; i < n; i++)
+            {
+                bool cluster = i < n / 2 || counts[k] < 0;
+                sites[i].x   = (int16_t)(cluster ? cell_rand(12) : cell_rand(CHECK_W + 40) - 20);
+                sites[i].y   = (int16_t)(cluster ? cell_rand(12) : cell_rand(CHECK_H + 40) - 20);
+            }
+
+            for (int f = 0; f < CHECK_FRAMES; f++)
+            {
+                demo_cell_update(&c, sites, n);
+                bad += check_frame(&c, out, f % 3);
+
+                for (int i = 0; i < n; i++)
+                {
+                    sites[i].x += (int16_t)(cell_rand(2 * CHECK_STEP + 1) - CHECK_STEP);
+                    sites[i].y += (int16_t)(cell_rand(2 * CHECK_STEP + 1) - CHECK_STEP);
+                }
+            }
+
+            /* 单点查询，含区域外的点 */
+            for (int q = 0; q < 200; q++)
+            {
+                int x = cell_rand(CHECK_W + 20) - 10, y = cell_rand(CHECK_H + 20) - 10;
+                int f1, f2, g1 = DEMO_CELL_FAR, g2 = DEMO_CELL_FAR;
+                demo_cell_query(&c, x, y, &f1, &f2);
+                for (int i = 0; i < n; i++)
+                {
+                    int d = (int)cell_len(metric, cell_dist(metric, ABS(x - sites[i].x), ABS(y - sites[i].y)));
+                    g2    = MIN(g2, MAX(g1, d));
+                    g1    = MIN(g1, d);
+                }
+                bad += f1 != g1 || f2 != g2;
+            }
+
+            rt_kprintf("metric %d, %3d sites: rebuilds %u/%u, full-scan tiles %u: %s\n", metric, n, c.stats.rebuilds,
+                       c.stats.updates, c.stats.overflow, bad ? "FAIL" : "ok");
+            ret |= bad != 0;
+            demo_cell_deinit(&c);
+        }
+    }
+
+out:
+    if (sites)
+        rt_free(sites);
+    if (out)
+        rt_free(out);
+    return (sites && out) ? ret : -1;
+}
+
+/* 基准：QVGA、种子以 ±BENCH_STEP 反弹运动，统计 update + render 的每帧耗时 */
+#define BENCH_W      320
+#define BENCH_H      240
+#define BENCH_SITES  1024
+#define BENCH_FRAMES 64
+#define BENCH_STEP   2
+
+static void cell_bench(int metric)
+{
+    static const int counts[] = {12, 64, 256, BENCH_SITES};
+    struct demo_cell       c;
+    struct demo_cell_site *sites = (struct demo_cell_site *)rt_malloc(BENCH_SITES * sizeof(*sites));
+    int8_t                *vel   = (int8_t *)rt_malloc(BENCH_SITES * 2);
+    uint8_t               *out   = (uint8_t *)rt_malloc(BENCH_W * BENCH_H);
+
+    if (sites && vel && out && demo_cell_init(&c, BENCH_W, BENCH_H, BENCH_SITES, metric) == 0)
+    {
+        demo_rand_seed(&g_cell_rng, 1);
+        rt_kprintf("%-6s %10s %10s %10s\n", "sites", "us/frame", "rebuilds", "cand/px");
+        for (int k = 0; k < (int)(sizeof(counts) / sizeof(counts[0])); k++)
+        {
+            int n = counts[k];
+            for (int i = 0; i < n; i++)
+            {
+                sites[i].x     = (int16_t)cell_rand(BENCH_W);
+                sites[i].y     = (int16_t)cell_rand(BENCH_H);
+                vel[2 * i]     = (int8_t)(cell_rand(2 * BENCH_STEP + 1) - BENCH_STEP);
+                vel[2 * i + 1] = (int8_t)(cell_rand(2 * BENCH_STEP + 1) - BENCH_STEP);
+            }
+
+            uint32_t rebuilds = c.stats.rebuilds;
+            uint64_t t0       = demo_perf_now_us();
+            for (int f = 0; f < BENCH_FRAMES; f++)
+            {
+                for (int i = 0; i < 2 * n; i++)
+                {
+                    int16_t *p = (i & 1) ? &sites[i >> 1].y : &sites[i >> 1].x;
+                    *p += vel[i];
+                    if (*p < 0 || *p >= ((i & 1) ? BENCH_H : BENCH_W))
+                    {
+                        vel[i] = (int8_t)-vel[i];
+                        *p += vel[i];
+                    }
+                }
+                demo_cell_update(&c, sites, n);
+                demo_cell_render(&c, out, BENCH_W, DEMO_CELL_F2_F1, 16);
+            }
+            uint32_t us   = (uint32_t)((demo_perf_now_us() - t0) / BENCH_FRAMES);
+            uint32_t cand = c.stats.refined * 100 / (BENCH_W * BENCH_H >> (2 * c.sub_shift));
+            rt_kprintf("%-6d %10u %10u %7u.%02u\n", n, us, c.stats.rebuilds - rebuilds, cand / 100, cand % 100);
+        }
+        demo_cell_deinit(&c);
+    }
+
+    if (sites)
+        rt_free(sites);
+    if (vel)
+        rt_free(vel);
+    if (out)
+        rt_free(out);
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_cell(int argc, char **argv)
+{
+    static const char *metric_name[] = {"manhattan", "euclidean", "chebyshev"};
+    const struct demo_cell *c        = g_cell_active;
+
+    if (argc > 1 && strcmp(argv[1], "check") == 0)
+    {
+        rt_kprintf("--- Cellular noise vs brute force ---\n");
+        int ret = cell_check();
+        rt_kprintf("%s\n", ret ? "FAIL" : "PASS");
+        return ret;
+    }
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        int metric = argc > 2 ? CLAMP(atoi(argv[2]), 0, 2) : DEMO_CELL_MANHATTAN;
+        rt_kprintf("--- Cellular noise bench (%d x %d, metric %d) ---\n", BENCH_W, BENCH_H, metric);
+        cell_bench(metric);
+        return 0;
+    }
+
+    if (!c || !c->stats.rebuilds)
+    {
+        rt_kprintf("No cellular noise instance is active.\n");
+        return 0;
+    }
+
+    int tiles = c->tiles_x * c->tiles_y;
+    rt_kprintf("--- Cellular Noise (%d x %d, tile %d, sub-block %d, %s) ---\n", c->width, c->height, 1 << c->tile_shift,
+               1 << c->sub_shift,
+               metric_name[c->metric]);
+    rt_kprintf("sites %d/%d, margin %d px\n", c->count, c->max_sites, c->margin);
+    rt_kprintf("updates %u, rebuilds %u, last rebuild %u us, render %u us\n", c->stats.updates, c->stats.rebuilds,
+               c->stats.rebuild_us, c->stats.render_us);
+    rt_kprintf("candidates %u (%u.%02u per tile), full-scan tiles %u\n", c->stats.candidates,
+               c->stats.candidates / tiles, c->stats.candidates * 100 / tiles % 100, c->stats.overflow);
+    int subs = (c->width * c->height) >> (2 * c->sub_shift);
+    rt_kprintf("per-pixel candidates %u.%02u\n", c->stats.refined / subs, c->stats.refined * 100 / subs % 100);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_cell, demo_cell, Show cellular noise stats [check|bench [metric]]);
@@ -0,0 +1,108 @@
+/*
+ * Filename: demo_cell.h
+ * THE SURVEY OF CELLS
+ * 晶胞测绘
+ *
+ * 细胞噪声 (Voronoi / Worley)：对区域内每个像素求最近与次近种子的距离 F1 / F2。
+ * 种子按网格分桶，每个网格块在重建时由内向外逐环搜索，只保留可能成为块内
+ * 任一像素 F1 / F2 的候选种子；渲染时再按细分块逐帧筛选一次，逐像素只需比较
+ * 两三个候选。网格块边长随种子密度选取 (平均每块约 DEMO_CELL_DENSITY 个种子)，
+ * 耗时与种子总数基本无关 (均匀分布时)。
+ *
+ * 帧间相干：候选表按 "重建时的种子位置" 加运动余量 (网格块边长的 1/4) 构建，
+ * 种子相对重建时的位移不超过余量时候选表仍然精确，可跨帧复用；任一种子越界才重建。
+ * 输出与逐像素扫描全部种子的结果逐位一致 (F1 相等时 DEMO_CELL_ID 取哪个种子不作保证)。
+ */
+
+#ifndef _DEMO_CELL_H_
+#define _DEMO_CELL_H_
+
+#include "demo_engine.h"
+
+#define DEMO_CELL_TILE_MIN  3      /* 网格块边长的取值范围 (log2)：8 ~ 64 像素 */
+#define DEMO_CELL_TILE_MAX  6
+#define DEMO_CELL_SUB_MIN   2      /* 细分块不小于 4 像素 */
+#define DEMO_CELL_DENSITY   2      /* 网格块面积约为每个种子平均占有面积的 2 倍 */
+#define DEMO_CELL_CAND_SITE 16     /* 候选池按每个种子 16 项分配，放不下的块退化为扫描全部种子 */
+#define DEMO_CELL_FAR       0x7FFF /* 种子不足两个时的 F1 / F2 */
+
+enum demo_cell_metric
+{
+    DEMO_CELL_MANHATTAN = 0, /* |dx| + |dy|，棱形晶胞 */
+    DEMO_CELL_EUCLIDEAN,     /* floor(sqrt(dx^2 + dy^2))，圆弧晶胞 */
+    DEMO_CELL_CHEBYSHEV,     /* max(|dx|, |dy|)，方形晶胞 */
+};
+
+enum demo_cell_feature
+{
+    DEMO_CELL_F1 = 0, /* 到最近种子的距离 */
+    DEMO_CELL_F2,     /* 到次近种子的距离 */
+    DEMO_CELL_F2_F1,  /* F2 - F1：边界处为 0 */
+    DEMO_CELL_ID,     /* 最近种子的序号 (低 8 位)，用于平涂晶胞 */
+};
+
+struct demo_cell_site
+{
+    int16_t x, y; /* 像素坐标，可以位于区域之外 (须在 ±8192 以内) */
+};
+
+struct demo_cell_tile
+{
+    uint32_t off; /* 在候选池中的起始位置 */
+    uint16_t num; /* 候选数，DEMO_CELL_ALL 表示扫描全部种子 */
+};
+
+#define DEMO_CELL_ALL 0xFFFF
+
+struct demo_cell_stats
+{
+    uint32_t updates;    /* demo_cell_update 次数 */
+    uint32_t rebuilds;   /* 其中重建候选表的次数 */
+    uint32_t candidates; /* 最近一次重建的候选总数 */
+    uint32_t overflow;   /* 最近一次重建中退化为全扫描的块数 */
+    uint32_t refined;    /* 最近一次渲染中各细分块的候选总数 */
+    uint32_t rebuild_us; /* 最近一次重建耗时 */
+    uint32_t render_us;  /* 最近一次 demo_cell_render 耗时 */
+};
+
+struct demo_cell
+{
+    int width, height;    /* 区域尺寸 (像素) */
+    int max_sites;        /* 种子容量 (不超过 65534) */
+    int metric;           /* enum demo_cell_metric */
+    int tile_shift;       /* 当前网格块边长 (log2)，随种子数选取 */
+    int sub_shift;        /* 细分块边长 (log2) */
+    int tiles_x, tiles_y; /* 当前网格块数 */
+    int margin;           /* 当前候选表的运动余量 (像素距离) */
+
+    const struct demo_cell_site *sites;   /* 当前种子 (调用者持有) */
+    int                          count;   /* 当前种子数 */
+    struct demo_cell_site       *anchor;  /* 重建时的种子位置 */
+    uint16_t                    *bucket;  /* 按网格块排序的种子序号 */
+    uint16_t                    *start;   /* 每块在 bucket 中的起始位置 (tiles + 1 项) */
+    uint16_t                    *visit;   /* 重建 / 细分时访问到的种子 */
+    uint32_t                    *visit_d; /* 及其到当前块的最近距离 */
+    struct demo_cell_tile       *tile;    /* 每块的候选范围 */
+    uint16_t                    *cand;    /* 候选池 */
+    int                          cand_cap;
+
+    struct demo_cell_stats stats;
+};
+
+/* 分配网格与候选池 (rt_malloc)，失败返回 -1。可在预备线程中调用 */
+int  demo_cell_init(struct demo_cell *c, int width, int height, int max_sites, int metric);
+void demo_cell_deinit(struct demo_cell *c);
+
+/*
+ * 提交本帧的种子 (数组须在 render / query 之前保持有效)。
+ * 种子数变化、或任一种子相对重建时的位移超出余量时重建候选表，否则沿用。
+ */
+void demo_cell_update(struct demo_cell *c, const struct demo_cell_site *sites, int count);
+
+/* 按特征渲染 8 位纹理：值 = MIN(feature * gain >> 4, 255)，gain 为 Q4 (16 = 1.0)；DEMO_CELL_ID 忽略 gain */
+void demo_cell_render(struct demo_cell *c, uint8_t *dst, int stride, int feature, int gain);
+
+/* 单点查询：返回最近种子的序号 (无种子时返回 -1)，f1 / f2 可为 NULL */
+int demo_cell_query(const struct demo_cell *c, int x, int y, int *f1, int *f2);
+
+#endif /* _DEMO_CELL_H_ */
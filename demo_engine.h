@@ -60,6 +60,17 @@ struct demo_ctx
     int           osd_stride;
 };
 
+/* [Pipeline] 引擎托管的流水线纹理 (CMA, 双缓冲) */
+struct demo_tex
+{
+    unsigned long phy;    /* 物理地址 (GE 使用) */
+    void         *vir;    /* 虚拟地址 (CPU 使用) */
+    int           width;  /* 像素宽度 */
+    int           height; /* 像素高度 */
+    int           stride; /* 行步幅 (Bytes) */
+    int           format; /* MPP 像素格式 */
+};
+
 /* 特效操作接口：每个特效模块必须实现的功能 */
 struct effect_ops
 {
@@ -73,6 +84,55 @@ struct effect_ops
 
     /* [Phase 16] 混合架构支持：是否启用 VI 物理层隔离 (解决 OSD 偏色) */
     bool is_vi_isolated;
+
+    /*
+     * [Pipeline] 可选：CPU/GE 流水线拆分 (同时提供 compute 与 submit 时 draw 可为空)
+     * 引擎托管两张纹理：GE 缩放第 N 帧纹理的同时，CPU 生成第 N+1 帧纹理，
+     * 帧耗时由 CPU + GE 降为 max(CPU, GE)。
+     */
+    /* CPU 阶段：生成下一帧纹理 (Cache 刷新由引擎完成) */
+    void (*compute)(struct demo_ctx *ctx, struct demo_tex *tex);
+    /* GE 阶段：将纹理合成至 phy_addr，只需 emit，不要 sync (由引擎完成) */
+    void (*submit)(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr);
+    /* 流水线纹理规格：tex_w 为 0 时使用 QVGA RGB565 */
+    int tex_w;
+    int tex_h;
+    int tex_fmt;
+    /*
+     * submit 在合成之后还以 GE 写入纹理本身 (如 fillrect 清空，使清屏与下一帧 compute 重叠) 时置位，
+     * 引擎在 CPU 取回该纹理时先 invalidate。索引色特效不可使用。参考 0020。
+     */
+    bool tex_ge_write;
+
+    /*
+     * [Palette] 可选：索引色模式 (仅流水线特效)。palette 为 256 项 RGB565，须在 init 返回前就绪；
+     * 此时 compute 收到的纹理为每像素 1 字节的索引 (MPP_FMT_YUV400，忽略 tex_fmt)。
+     * 调色板可由 DE gamma 逼近时 submit 收到的即该灰度纹理，特效强制走 VI 隔离路径；
+     * 否则引擎将索引展开为 RGB565 纹理再交给 submit (见 demo_palette.h)。
+     */
+    const uint16_t *palette;
+    /*
+     * 索引为离散的状态号 (相邻索引的颜色互不相关) 时置位：GE 缩放会在索引之间插值，
+     * 边界上出现中间状态的颜色，因此不走 DE gamma，始终由 CPU 展开为 RGB565 后再缩放。参考 0018。
+     */
+    bool palette_discrete;
+
+    /*
+     * [Prewarm] 可选：预备阶段，构建只由 CPU 读取的资源 (LUT、调色板等)。
+     * 引擎在低优先级线程中为预测的下一个 / 上一个特效提前调用，因此不得访问 GE / DE，
+     * 也不得使用 demo_pool (仅限渲染线程)。引擎保证 init 前 prepare 已完成，
+     * 且在 unprepare 之前可多次 init / deinit；这些资源由 unprepare 释放，deinit 不应释放。
+     */
+    int (*prepare)(struct demo_ctx *ctx);
+    void (*unprepare)(struct demo_ctx *ctx);
+
+    /*
+     * [Bench] 可选：负载档位 (以 0 结尾，如粒子 / 磁球数量)。demo_bench 对该特效依次以各档位
+     * 预热并计时，每档输出一行 CSV，用于观察帧耗时随规模的变化。
+     * set_load 由渲染线程在两帧之间调用；init 应恢复默认负载。
+     */
+    const int *bench_loads;
+    void (*set_load)(struct demo_ctx *ctx, int load);
 };
 
 /*
@@ -84,10 +144,19 @@ struct effect_ops
     __attribute__((section("EffectTab"), used)) static struct effect_ops *_ptr_##ops_struct = &ops_struct
 
 /* --- 核心控制 API --- */
-void demo_core_init(void);        /* 系统初始化 */
-void demo_core_start(void);       /* 启动渲染主线程 */
-void demo_next_effect(void);      /* 切换至下一个特效 */
-void demo_prev_effect(void);      /* 切换至上一个特效 */
-void demo_jump_effect(int index); /* 跳转至指定索引的特效 */
+void demo_core_init(void);           /* 系统初始化 */
+void demo_core_start(void);          /* 启动渲染主线程 */
+void demo_next_effect(void);         /* 切换至下一个特效 */
+void demo_prev_effect(void);         /* 切换至上一个特效 */
+void demo_jump_effect(int index);    /* 跳转至指定索引的特效 */
+int  demo_current_effect(void);      /* 当前特效索引 */
+void demo_set_vsync(int enable);     /* 0: 翻转不等待 VSync (基准测试用，会撕裂) */
+void demo_effect_set_load(int load); /* 设置当前特效的负载档位 (仅渲染线程，基准测试用) */
+
+/* --- 显示后处理 API (CCM / Gamma / HSBC，仅渲染线程) --- */
+/* 配置先暂存，随本帧排队，在该帧翻转上屏时才写入 DE，排队中的旧帧不受影响；切换特效时引擎复位为中性配置 */
+void demo_disp_set_ccm(const struct aicfb_ccm_config *ccm);       /* 替代 AICFB_UPDATE_CCM_CONFIG */
+void demo_disp_set_gamma(const struct aicfb_gamma_config *gamma); /* 替代 AICFB_UPDATE_GAMMA_CONFIG */
+void demo_disp_set_prop(const struct aicfb_disp_prop *prop);      /* 替代 AICFB_SET_DISP_PROP */
 
 #endif
@@ -17,6 +17,10 @@
 
 #include "demo_engine.h"
 #include "demo_perf.h"
+#include "demo_bench.h"
+#include "demo_ge_batch.h"
+#include "demo_pool.h"
+#include "demo_palette.h"
 #include "mpp_mem.h"
 #include <rtdevice.h>
 #include <string.h>
@@ -33,7 +37,9 @@ extern struct effect_ops *__stop_EffectTab[];
 static struct demo_ctx g_ctx;
 static int             g_current_effect_idx = 0;
 static rt_thread_t     g_render_thread      = RT_NULL;
-static int             g_req_effect_idx     = -1; /* 请求切换的目标特效索引 */
+static int             g_req_effect_idx     = -1;    /* 请求切换的目标特效索引 */
+static volatile int    g_vsync_enabled      = 1;     /* 0: 翻转不等待 VSync */
+static bool            g_effect_failed      = false; /* 当前特效启动失败 (不绘制、不停止、不调整负载) */
 
 /* 获取当前注册的特效总数 */
 static int get_effect_count(void)
@@ -95,11 +101,934 @@ static void input_init(void)
 #endif
 }
 
+/*
+ * [DispColor] 显示后处理 (CCM / Gamma / HSBC)
+ * DE 的色彩配置作用于整屏，与图层地址一样属于逐帧状态：渲染线程只写暂存值，
+ * 排队翻转时随帧一起拷贝，由显示线程在该帧上屏时提交。
+ * 这样切换特效时，仍在排队或在屏的旧帧保持旧配置，新配置与新特效的首帧同时生效。
+ */
+struct disp_color
+{
+    struct aicfb_ccm_config   ccm;
+    struct aicfb_gamma_config gamma;
+    struct aicfb_disp_prop    prop;
+};
+
+static struct disp_color g_disp_stage = {.prop = {50, 50, 50, 50}}; /* 下一帧的配置 (仅渲染线程) */
+
+void demo_disp_set_ccm(const struct aicfb_ccm_config *ccm)
+{
+    g_disp_stage.ccm = *ccm;
+}
+
+void demo_disp_set_gamma(const struct aicfb_gamma_config *gamma)
+{
+    g_disp_stage.gamma = *gamma;
+}
+
+void demo_disp_set_prop(const struct aicfb_disp_prop *prop)
+{
+    g_disp_stage.prop = *prop;
+}
+
+/* 切换特效时复位为中性配置 (CCM / Gamma 关闭，HSBC 居中)，同样随新特效的首帧生效 */
+static void disp_color_reset(void)
+{
+    memset(&g_disp_stage, 0, sizeof(g_disp_stage));
+    g_disp_stage.prop = (struct aicfb_disp_prop){50, 50, 50, 50};
+}
+
+/* --- [Pipeline] CPU/GE 流水线 --- */
+
+static struct demo_tex g_pipe_tex[2];   /* 引擎托管的双缓冲纹理 */
+static struct ge_fence g_pipe_fence[2]; /* 纹理所有权 */
+static int             g_pipe_idx = 0;  /* 本帧交给 GE 的纹理索引 */
+
+/* [Palette] 索引色特效：DE gamma 模式下纹理即索引；CPU 展开模式下 compute 写入单独的索引缓冲 */
+static struct demo_tex g_pipe_index;         /* CPU 展开模式的索引缓冲 (仅 CPU 访问) */
+static bool            g_pipe_gamma = false; /* DE gamma 模式：须走 VI 隔离路径，OSD 不受 gamma 影响 */
+
+static int pipeline_fmt_bpp(int format)
+{
+    if (format == MPP_FMT_RGB_565)
+        return 2;
+    if (format == MPP_FMT_RGB_888)
+        return 3;
+    if (format == MPP_FMT_YUV400)
+        return 1;
+    return 4;
+}
+
+static bool pipeline_enabled(struct effect_ops *op)
+{
+    return op && op->compute && op->submit;
+}
+
+static void pipeline_stop(void)
+{
+    /* GE 可能仍在读取纹理，释放前必须等待 */
+    ge_batch_sync(g_ctx.ge);
+    for (int i = 0; i < 2; i++)
+    {
+        demo_pool_free(g_pipe_tex[i].phy);
+    }
+    memset(g_pipe_tex, 0, sizeof(g_pipe_tex));
+
+    if (g_pipe_index.vir)
+        rt_free(g_pipe_index.vir);
+    memset(&g_pipe_index, 0, sizeof(g_pipe_index));
+
+    /* 调色板 gamma 随之后的帧撤销 (启动失败时只剩 OSD，不能带着调色板显示) */
+    if (g_pipe_gamma)
+    {
+        struct aicfb_gamma_config gamma_reset = {0};
+        demo_disp_set_gamma(&gamma_reset);
+    }
+    g_pipe_gamma = false;
+}
+
+/* 生成一帧纹理：索引缓冲模式下 compute 之后由 CPU 展开为 RGB565 */
+static void pipeline_generate(struct effect_ops *op, int idx)
+{
+    if (!g_pipe_index.vir)
+    {
+        op->compute(&g_ctx, &g_pipe_tex[idx]);
+        return;
+    }
+    op->compute(&g_ctx, &g_pipe_index);
+    demo_palette_expand(&g_pipe_index, op->palette, &g_pipe_tex[idx]);
+}
+
+/* [Palette] 选择索引色模式：DE gamma 时暂存 gamma 表 (随首帧上屏) 并返回 YUV400，否则准备索引缓冲 */
+static int pipeline_palette_start(struct effect_ops *op, int w, int h)
+{
+    struct aicfb_gamma_config gamma = {0};
+
+    if (demo_palette_setup(op, g_ctx.info.format, &gamma))
+    {
+        demo_disp_set_gamma(&gamma);
+        g_pipe_gamma = true;
+        return MPP_FMT_YUV400;
+    }
+
+    g_pipe_index.width  = w;
+    g_pipe_index.height = h;
+    g_pipe_index.format = MPP_FMT_YUV400;
+    g_pipe_index.stride = w;
+    g_pipe_index.vir    = rt_malloc(w * h);
+    if (!g_pipe_index.vir)
+        return -1;
+    return MPP_FMT_RGB_565;
+}
+
+/* 为流水线特效分配双缓冲纹理，并预先生成首帧，使第一帧即可进入流水 */
+static int pipeline_start(struct effect_ops *op)
+{
+    int w   = op->tex_w ? op->tex_w : DEMO_QVGA_W;
+    int h   = op->tex_w ? op->tex_h : DEMO_QVGA_H;
+    int fmt = op->tex_w ? op->tex_fmt : MPP_FMT_RGB_565;
+
+    if (op->palette)
+    {
+        fmt = pipeline_palette_start(op, w, h);
+        if (fmt < 0)
+        {
+            rt_kprintf("Demo Error: Palette index buffer alloc failed.\n");
+            return -1;
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        struct demo_tex *tex = &g_pipe_tex[i];
+        tex->width           = w;
+        tex->height          = h;
+        tex->format          = fmt;
+        tex->stride          = w * pipeline_fmt_bpp(fmt);
+        tex->phy             = demo_pool_alloc(tex->stride * h);
+        if (!tex->phy)
+        {
+            rt_kprintf("Demo Error: Pipeline texture alloc failed.\n");
+            pipeline_stop();
+            return -1;
+        }
+        tex->vir = (void *)tex->phy;
+        ge_fence_init(&g_pipe_fence[i], tex->vir, tex->stride * h);
+    }
+
+    g_pipe_idx = 0;
+    pipeline_generate(op, 0);
+    ge_fence_cpu_release(&g_pipe_fence[0], 0, g_pipe_fence[0].size);
+    return 0;
+}
+
+/* 流水线各阶段 (带阶段计时)：纹理在交给 GE 时 clean，CPU 取回时只在 GE 未完成时等待 (GE 写过纹理时再 invalidate) */
+static void pipeline_submit(struct effect_ops *op, int idx, unsigned long phy_addr)
+{
+    demo_perf_phase_begin(DEMO_PHASE_CACHE);
+    ge_fence_ge_acquire(&g_pipe_fence[idx], op->tex_ge_write);
+    demo_perf_phase_end();
+
+    demo_perf_phase_begin(DEMO_PHASE_GE_SUBMIT);
+    op->submit(&g_ctx, &g_pipe_tex[idx], phy_addr);
+    demo_perf_phase_end();
+}
+
+static void pipeline_compute(struct effect_ops *op, int idx)
+{
+    struct ge_fence *fence = &g_pipe_fence[idx];
+
+    demo_perf_phase_begin(DEMO_PHASE_GE_SYNC);
+    ge_fence_cpu_acquire(g_ctx.ge, fence, 0, fence->size);
+    demo_perf_phase_end();
+
+    demo_perf_phase_begin(DEMO_PHASE_COMPUTE);
+    pipeline_generate(op, idx);
+    demo_perf_phase_end();
+
+    ge_fence_cpu_release(fence, 0, fence->size);
+}
+
+static void pipeline_sync(void)
+{
+    demo_perf_phase_begin(DEMO_PHASE_GE_SYNC);
+    ge_batch_sync(g_ctx.ge);
+    demo_perf_phase_end();
+}
+
+/* 执行一帧特效绘制：流水线特效走 submit/compute 重叠路径，其余走传统 draw */
+static void effect_render(struct effect_ops *op, unsigned long phy_addr)
+{
+    if (!pipeline_enabled(op))
+    {
+        /* 传统 draw 整体计入 COMPUTE，特效可在内部自行细分阶段 */
+        if (op && op->draw)
+        {
+            demo_perf_phase_begin(DEMO_PHASE_COMPUTE);
+            op->draw(&g_ctx, phy_addr);
+            demo_perf_phase_end();
+
+            /* 提交特效经批处理累积、尚未 emit 的指令，由 OSD 前的同步统一等待 */
+            ge_batch_emit(g_ctx.ge);
+        }
+        return;
+    }
+    if (!g_pipe_tex[0].phy)
+        return;
+
+    int cur = g_pipe_idx;
+    int nxt = !g_pipe_idx;
+
+#ifdef AIC_GE_DEMO_PIPELINE
+    /* GE 缩放第 N 帧的同时，CPU 生成第 N+1 帧 */
+    pipeline_submit(op, cur, phy_addr);
+    pipeline_compute(op, nxt);
+    pipeline_sync();
+#else
+    /* 串行回退：用于与流水线模式对比 */
+    pipeline_submit(op, cur, phy_addr);
+    pipeline_sync();
+    pipeline_compute(op, nxt);
+#endif
+
+    g_pipe_idx = !g_pipe_idx;
+}
+
+/* --- [Prewarm] 预备线程 --- */
+
+/*
+ * 切换请求到来之前，在低优先级线程中为预测的下一个 / 上一个特效执行 prepare，
+ * 使切换只剩 init (纹理借出) 与硬件复位。已预备的特效在不再被预测时才 unprepare，
+ * 因此来回切换相邻特效不会重复构建。预测落空时由渲染线程同步 prepare。
+ */
+
+#ifndef AIC_GE_DEMO_PREWARM_PRIO
+#define AIC_GE_DEMO_PREWARM_PRIO 25 /* 低于渲染线程 (20)，只占用其等待 VSync / GE 的空闲 */
+#endif
+
+#ifndef AIC_GE_DEMO_PREWARM_STACK
+#define AIC_GE_DEMO_PREWARM_STACK 8192 /* prepare 含 libc 浮点、LUT 缓存文件读写，2KB 不够 */
+#endif
+
+#define PREWARM_SLOTS 4 /* 当前 + 下一个 + 上一个 + 一个待回收 */
+
+static struct
+{
+    rt_thread_t thread;               /* 为空时退化为同步 prepare / unprepare */
+    rt_sem_t    kick;                 /* 预测目标变化时唤醒预备线程 */
+    rt_sem_t    done;                 /* 渲染线程等待进行中的 prepare / unprepare */
+    rt_mutex_t  lock;                 /* 保护以下状态 */
+    int         ready[PREWARM_SLOTS]; /* 已预备的特效索引，-1 为空 */
+    long        bytes[PREWARM_SLOTS]; /* 各槽 prepare 时的堆增量 (基准测试按特效归属) */
+    int         want[2];              /* 预测的下一个 / 上一个 */
+    int         current;              /* 运行中的特效，预备线程不得触碰 */
+    int         busy;                 /* 预备线程正在处理的特效 */
+    int         evict;                /* 渲染线程正在就地回收的特效，预备线程须跳过 */
+    rt_size_t   busy_heap;            /* 进行中的 prepare 开始时的堆用量，0 表示无 */
+    int         waiting;              /* 渲染线程阻塞于 done */
+} g_prep;
+
+static bool has_prepare(struct effect_ops *op)
+{
+    return op && op->prepare;
+}
+
+static rt_size_t prep_heap_used(void)
+{
+    rt_size_t total, used, max_used;
+    rt_memory_info(&total, &used, &max_used);
+    return used;
+}
+
+static long prep_heap_since(rt_size_t base)
+{
+    rt_size_t now = prep_heap_used();
+    return now > base ? (long)(now - base) : 0;
+}
+
+/* 以下 prep_* 须持有 g_prep.lock */
+static int prep_find(int idx)
+{
+    for (int i = 0; i < PREWARM_SLOTS; i++)
+    {
+        if (g_prep.ready[i] == idx)
+            return i;
+    }
+    return -1;
+}
+
+static bool prep_wanted(int idx)
+{
+    return idx == g_prep.want[0] || idx == g_prep.want[1];
+}
+
+/* 任务选择：先回收不再需要的资源腾出内存，再预备预测目标 */
+static int prep_pick(bool *release)
+{
+    for (int i = 0; i < PREWARM_SLOTS; i++)
+    {
+        int idx = g_prep.ready[i];
+        if (idx >= 0 && idx != g_prep.current && !prep_wanted(idx))
+        {
+            g_prep.ready[i] = -1;
+            *release        = true;
+            return idx;
+        }
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        int idx = g_prep.want[i];
+        if (idx >= 0 && idx != g_prep.current && idx != g_prep.evict && prep_find(idx) < 0)
+        {
+            *release = false;
+            return idx;
+        }
+    }
+    return -1;
+}
+
+static void prewarm_thread_entry(void *parameter)
+{
+    while (1)
+    {
+        rt_sem_take(g_prep.kick, RT_WAITING_FOREVER);
+
+        while (1)
+        {
+            bool release = false;
+
+            rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+            int idx          = prep_pick(&release);
+            g_prep.busy      = idx;
+            g_prep.busy_heap = (idx >= 0 && !release) ? prep_heap_used() : 0;
+            rt_mutex_release(g_prep.lock);
+
+            if (idx < 0)
+                break;
+
+            struct effect_ops *op  = get_effect_by_index(idx);
+            int                ret = 0;
+            if (release)
+            {
+                if (op->unprepare)
+                    op->unprepare(&g_ctx);
+            }
+            else
+            {
+                ret = op->prepare(&g_ctx);
+            }
+
+            bool drop = false;
+
+            rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+            if (!release)
+            {
+                int slot = (ret < 0) ? -1 : prep_find(-1);
+                if (slot >= 0)
+                {
+                    g_prep.ready[slot] = idx;
+                    g_prep.bytes[slot] = prep_heap_since(g_prep.busy_heap);
+                }
+                else
+                {
+                    /* 失败或槽位已满：放弃本次预测，留待切换时同步重试 */
+                    drop = (ret >= 0);
+                    for (int i = 0; i < 2; i++)
+                        if (g_prep.want[i] == idx)
+                            g_prep.want[i] = -1;
+                }
+            }
+            if (drop && op->unprepare)
+            {
+                /* busy 仍为 idx，渲染线程的 prewarm_claim 会等待，unprepare 不必持锁 */
+                rt_mutex_release(g_prep.lock);
+                op->unprepare(&g_ctx);
+                rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+            }
+            g_prep.busy      = -1;
+            g_prep.busy_heap = 0;
+            if (g_prep.waiting)
+            {
+                g_prep.waiting = 0;
+                rt_sem_release(g_prep.done);
+            }
+            rt_mutex_release(g_prep.lock);
+        }
+    }
+}
+
+static int prewarm_init(void)
+{
+    memset(g_prep.ready, 0xff, sizeof(g_prep.ready));
+    g_prep.want[0] = -1;
+    g_prep.want[1] = -1;
+    g_prep.current = -1;
+    g_prep.busy    = -1;
+    g_prep.evict   = -1;
+
+    g_prep.lock = rt_mutex_create("ge_prep", RT_IPC_FLAG_PRIO);
+    if (!g_prep.lock)
+        return -1;
+
+#ifdef AIC_GE_DEMO_PREWARM
+    g_prep.kick = rt_sem_create("ge_prep", 0, RT_IPC_FLAG_FIFO);
+    g_prep.done = rt_sem_create("ge_prep_done", 0, RT_IPC_FLAG_FIFO);
+    if (!g_prep.kick || !g_prep.done)
+        return 0; /* 退化为同步模式 */
+
+    g_prep.thread = rt_thread_create("ge_prep", prewarm_thread_entry, RT_NULL, AIC_GE_DEMO_PREWARM_STACK,
+                                     AIC_GE_DEMO_PREWARM_PRIO, 10);
+    if (g_prep.thread)
+        rt_thread_startup(g_prep.thread);
+#endif
+    return 0;
+}
+
+/* 取得 idx 的预备资源：等待进行中的预备，预测落空则同步 prepare */
+static int prewarm_claim(int idx)
+{
+    struct effect_ops *op = get_effect_by_index(idx);
+
+    rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    g_prep.current = idx;
+    while (g_prep.busy == idx)
+    {
+        g_prep.waiting = 1;
+        rt_mutex_release(g_prep.lock);
+        rt_sem_take(g_prep.done, RT_WAITING_FOREVER);
+        rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    }
+    bool ready = !has_prepare(op) || prep_find(idx) >= 0;
+    rt_mutex_release(g_prep.lock);
+
+    if (ready)
+        return 0;
+
+    /* current 已指向 idx，预备线程不会同时处理它 */
+    rt_size_t heap0 = prep_heap_used();
+    if (op->prepare(&g_ctx) < 0)
+        return -1;
+    long bytes = prep_heap_since(heap0);
+
+    rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    int slot = prep_find(-1);
+    if (slot < 0)
+    {
+        /* 槽位已满 (预备线程来不及回收)：就地回收一个，此时槽中均非当前特效且无人处理 */
+        slot         = 0;
+        g_prep.evict = g_prep.ready[slot];
+    }
+    int victim         = g_prep.evict;
+    g_prep.ready[slot] = idx;
+    g_prep.bytes[slot] = bytes;
+    rt_mutex_release(g_prep.lock);
+
+    /* 回收在锁外进行：evict 期间预备线程不会重新预备该特效 */
+    if (victim >= 0)
+    {
+        struct effect_ops *vop = get_effect_by_index(victim);
+        if (vop->unprepare)
+            vop->unprepare(&g_ctx);
+
+        rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+        g_prep.evict = -1;
+        rt_mutex_release(g_prep.lock);
+    }
+    return 0;
+}
+
+/* 特效已停止：无预备线程时立即 unprepare */
+static void prewarm_release(int idx)
+{
+    if (g_prep.thread)
+        return;
+
+    struct effect_ops *op = get_effect_by_index(idx);
+    int                slot;
+
+    rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    slot = prep_find(idx);
+    if (slot >= 0)
+        g_prep.ready[slot] = -1;
+    g_prep.current = -1;
+    rt_mutex_release(g_prep.lock);
+
+    if (slot >= 0 && op->unprepare)
+        op->unprepare(&g_ctx);
+}
+
+/*
+ * 预备资源占用的堆 (exclude 所属的除外)：进行中的 prepare 以其开始以来的堆增量近似。
+ * 基准测试以此把预备内存记在所属特效名下，而不是碰巧运行中的特效。
+ */
+long demo_prewarm_heap(int exclude)
+{
+    long sum = 0;
+
+    if (!g_prep.lock)
+        return 0;
+
+    rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    for (int i = 0; i < PREWARM_SLOTS; i++)
+    {
+        if (g_prep.ready[i] >= 0 && g_prep.ready[i] != exclude)
+            sum += g_prep.bytes[i];
+    }
+    if (g_prep.busy_heap && g_prep.busy != exclude)
+        sum += prep_heap_since(g_prep.busy_heap);
+    rt_mutex_release(g_prep.lock);
+    return sum;
+}
+
+/* 以 idx 为当前特效，预测下一次切换的目标并唤醒预备线程 */
+static void prewarm_predict(int idx)
+{
+    if (!g_prep.thread)
+        return;
+
+    int count = get_effect_count();
+    int next  = (idx + 1) % count;
+    int prev  = (idx - 1 + count) % count;
+
+    rt_mutex_take(g_prep.lock, RT_WAITING_FOREVER);
+    g_prep.want[0] = has_prepare(get_effect_by_index(next)) ? next : -1;
+    g_prep.want[1] = has_prepare(get_effect_by_index(prev)) ? prev : -1;
+    rt_mutex_release(g_prep.lock);
+
+    rt_sem_release(g_prep.kick);
+}
+
+/* --- 特效生命周期 --- */
+
+/* 启动特效；失败时撤销已完成的步骤并返回 -1，调用方不得再绘制或停止该特效 */
+static int effect_start(int idx, struct effect_ops *op)
+{
+    if (prewarm_claim(idx) < 0)
+    {
+        rt_kprintf("Demo Error: [%d] prepare failed.\n", idx);
+        return -1;
+    }
+    prewarm_predict(idx);
+
+    if (op->init && op->init(&g_ctx) < 0)
+    {
+        rt_kprintf("Demo Error: [%d] init failed.\n", idx);
+        prewarm_release(idx);
+        return -1;
+    }
+    if (pipeline_enabled(op) && pipeline_start(op) < 0)
+    {
+        ge_batch_sync(g_ctx.ge);
+        if (op->deinit)
+            op->deinit(&g_ctx);
+        prewarm_release(idx);
+        return -1;
+    }
+    return 0;
+}
+
+static void effect_stop(int idx, struct effect_ops *op)
+{
+    /* 特效归还的纹理会被下一个特效复用，GE 必须先停止访问 */
+    ge_batch_sync(g_ctx.ge);
+    if (pipeline_enabled(op))
+        pipeline_stop();
+    if (op->deinit)
+        op->deinit(&g_ctx);
+    prewarm_release(idx);
+}
+
+/* --- [FlipRing] 帧缓冲环与异步翻转 --- */
+
+#ifndef AIC_GE_DEMO_FB_NUM
+#define AIC_GE_DEMO_FB_NUM 2
+#endif
+
+#define FB_RING_MAX 4
+
+/* 一次待上屏的翻转请求 */
+struct flip_req
+{
+    int               buf_idx;
+    bool              is_vi_isolated;
+    struct disp_color color; /* 该帧的显示后处理配置 */
+};
+
+static unsigned long   g_fb_phy[FB_RING_MAX];     /* 环中各缓冲的物理地址 */
+static bool            g_fb_cma[FB_RING_MAX];     /* 超出 FB 显存时由 CMA 补足 */
+static struct ge_fence g_fb_fence[FB_RING_MAX];   /* 各缓冲的所有权 (GE 绘制 / CPU 叠加 OSD / DE 显示) */
+static int             g_fb_num      = 0;         /* 实际缓冲数量 */
+static struct flip_req g_flip_queue[FB_RING_MAX]; /* 待上屏队列 */
+static int             g_flip_head   = 0;         /* 显示线程读取位置 */
+static int             g_flip_tail   = 0;         /* 渲染线程写入位置 */
+static rt_sem_t        g_flip_free   = RT_NULL;   /* 可供渲染的空闲缓冲数 */
+static rt_sem_t        g_flip_ready  = RT_NULL;   /* 已排队待上屏的帧数 */
+static rt_thread_t     g_flip_thread = RT_NULL;
+
+/*
+ * 建立 N 缓冲环：前若干个取自 FB 显存 (驱动通常只提供双缓冲)，不足部分从 CMA 补齐。
+ * 上电时 0 号缓冲在屏，其余 N-1 个可立即用于渲染。
+ */
+static int flip_ring_init(void)
+{
+    unsigned long frame_size = g_ctx.info.stride * g_ctx.info.height;
+    int           fb_frames  = frame_size ? g_ctx.info.smem_len / frame_size : 0;
+
+    g_fb_num = CLAMP(AIC_GE_DEMO_FB_NUM, 2, FB_RING_MAX);
+    for (int i = 0; i < g_fb_num; i++)
+    {
+        if (i < fb_frames)
+        {
+            g_fb_phy[i] = (unsigned long)g_ctx.info.framebuffer + i * frame_size;
+            continue;
+        }
+
+        g_fb_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(frame_size));
+        if (!g_fb_phy[i])
+        {
+            rt_kprintf("Demo Warning: FB ring limited to %d buffers.\n", i);
+            g_fb_num = i;
+            break;
+        }
+        g_fb_cma[i] = true;
+        memset((void *)g_fb_phy[i], 0, frame_size);
+        aicos_dcache_clean_range((void *)g_fb_phy[i], frame_size);
+    }
+    for (int i = 0; i < g_fb_num; i++)
+        ge_fence_init(&g_fb_fence[i], (void *)g_fb_phy[i], frame_size);
+
+    if (g_fb_num < 2)
+        return -1;
+
+    g_flip_free  = rt_sem_create("ge_free", g_fb_num - 1, RT_IPC_FLAG_FIFO);
+    g_flip_ready = rt_sem_create("ge_flip", 0, RT_IPC_FLAG_FIFO);
+    if (!g_flip_free || !g_flip_ready)
+        return -1;
+
+    rt_kprintf("Demo Core: %d-buffer flip ring.\n", g_fb_num);
+    return 0;
+}
+
+/*
+ * [LayerCache] 显示图层状态缓存
+ * 记录最近一次提交给 DE 的图层 / Alpha / 色键配置，只为真正变化的部分发出 ioctl。
+ * 稳态下每帧只剩一次地址切换 (传统路径为 PAN_DISPLAY，隔离路径为 VI 图层更新)，
+ * 避免在扫描中途重写整组寄存器。仅由显示线程访问。
+ */
+struct disp_stats
+{
+    uint32_t frames;  /* 提交的帧数 */
+    uint32_t layer;   /* AICFB_UPDATE_LAYER_CONFIG */
+    uint32_t alpha;   /* AICFB_UPDATE_ALPHA_CONFIG */
+    uint32_t ck;      /* AICFB_UPDATE_CK_CONFIG */
+    uint32_t color;   /* AICFB_UPDATE_CCM_CONFIG / AICFB_UPDATE_GAMMA_CONFIG / AICFB_SET_DISP_PROP */
+    uint32_t pan;     /* AICFB_PAN_DISPLAY */
+    uint32_t skipped; /* 因状态未变化而省略的 ioctl */
+};
+
+static struct
+{
+    struct aicfb_layer_data   layer[2]; /* [VIDEO] / [UI] */
+    struct aicfb_alpha_config alpha;
+    struct aicfb_ck_config    ck;
+    struct disp_color         color;
+    bool                      layer_valid[2];
+    bool                      alpha_valid;
+    bool                      ck_valid;
+    bool                      color_valid;
+    struct disp_stats         stats;
+} g_disp;
+
+/* pan_idx >= 0 表示该缓冲位于 FB 显存内，地址变化可用 PAN_DISPLAY 完成 */
+static void disp_update_layer(const struct aicfb_layer_data *layer, int pan_idx)
+{
+    int                      id   = layer->layer_id;
+    struct aicfb_layer_data *last = &g_disp.layer[id];
+
+    if (g_disp.layer_valid[id] && memcmp(last, layer, sizeof(*layer)) == 0)
+    {
+        g_disp.stats.skipped++;
+        return;
+    }
+
+    /* 只有地址变化：页切换即可 */
+    if (pan_idx >= 0 && g_disp.layer_valid[id])
+    {
+        struct aicfb_layer_data addr_only = *last;
+        addr_only.buf.phy_addr[0]         = layer->buf.phy_addr[0];
+        if (memcmp(&addr_only, layer, sizeof(*layer)) == 0)
+        {
+            mpp_fb_ioctl(g_ctx.fb, AICFB_PAN_DISPLAY, &pan_idx);
+            g_disp.stats.pan++;
+            *last = *layer;
+            return;
+        }
+    }
+
+    mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_LAYER_CONFIG, (void *)layer);
+    g_disp.stats.layer++;
+    /* 同步驱动内部的当前页，保持与传统标准一致 */
+    if (pan_idx >= 0)
+    {
+        mpp_fb_ioctl(g_ctx.fb, AICFB_PAN_DISPLAY, &pan_idx);
+        g_disp.stats.pan++;
+    }
+    *last                  = *layer;
+    g_disp.layer_valid[id] = true;
+}
+
+static void disp_update_alpha(const struct aicfb_alpha_config *alpha)
+{
+    if (g_disp.alpha_valid && memcmp(&g_disp.alpha, alpha, sizeof(*alpha)) == 0)
+    {
+        g_disp.stats.skipped++;
+        return;
+    }
+    mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_ALPHA_CONFIG, (void *)alpha);
+    g_disp.stats.alpha++;
+    g_disp.alpha       = *alpha;
+    g_disp.alpha_valid = true;
+}
+
+static void disp_update_ck(const struct aicfb_ck_config *ck)
+{
+    if (g_disp.ck_valid && memcmp(&g_disp.ck, ck, sizeof(*ck)) == 0)
+    {
+        g_disp.stats.skipped++;
+        return;
+    }
+    mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_CK_CONFIG, (void *)ck);
+    g_disp.stats.ck++;
+    g_disp.ck       = *ck;
+    g_disp.ck_valid = true;
+}
+
+/* 色彩配置逐项比较，只重写变化的部分 (首次提交时全部写入，覆盖上电状态) */
+static void disp_update_color(const struct disp_color *color)
+{
+    struct disp_color *last  = &g_disp.color;
+    bool               valid = g_disp.color_valid;
+
+    if (!valid || memcmp(&last->ccm, &color->ccm, sizeof(color->ccm)) != 0)
+    {
+        mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_CCM_CONFIG, (void *)&color->ccm);
+        g_disp.stats.color++;
+    }
+    else
+        g_disp.stats.skipped++;
+
+    if (!valid || memcmp(&last->gamma, &color->gamma, sizeof(color->gamma)) != 0)
+    {
+        mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_GAMMA_CONFIG, (void *)&color->gamma);
+        g_disp.stats.color++;
+    }
+    else
+        g_disp.stats.skipped++;
+
+    if (!valid || memcmp(&last->prop, &color->prop, sizeof(color->prop)) != 0)
+    {
+        mpp_fb_ioctl(g_ctx.fb, AICFB_SET_DISP_PROP, (void *)&color->prop);
+        g_disp.stats.color++;
+    }
+    else
+        g_disp.stats.skipped++;
+
+    *last              = *color;
+    g_disp.color_valid = true;
+}
+
+/* 将一帧的图层配置提交给 DE (由显示线程在 VSync 之前调用) */
+static void flip_commit(const struct flip_req *req)
+{
+    unsigned long phy = g_fb_phy[req->buf_idx];
+
+    g_disp.stats.frames++;
+    disp_update_color(&req->color);
+    if (req->is_vi_isolated)
+    {
+        /* Path A: 现代隔离路径 (VI Effect + UI OSD) */
+        // 1. 配置 VI 图层 0 (背景)
+        g_ctx.vi_layer.enable          = 1;
+        g_ctx.vi_layer.buf.buf_type    = MPP_PHY_ADDR;
+        g_ctx.vi_layer.buf.format      = g_ctx.info.format;
+        g_ctx.vi_layer.buf.size.width  = g_ctx.screen_w;
+        g_ctx.vi_layer.buf.size.height = g_ctx.screen_h;
+        g_ctx.vi_layer.buf.stride[0]   = g_ctx.info.stride;
+        g_ctx.vi_layer.buf.phy_addr[0] = phy;
+        disp_update_layer(&g_ctx.vi_layer, -1);
+
+        // 2. 配置 UI 图层 1 (OSD 隔离)
+        g_ctx.ui_layer.enable          = 1;
+        g_ctx.ui_layer.buf.buf_type    = MPP_PHY_ADDR;
+        g_ctx.ui_layer.buf.format      = g_ctx.info.format; /* [FIX] 强制对齐主屏幕格式 */
+        g_ctx.ui_layer.buf.size.width  = g_ctx.osd_w;
+        g_ctx.ui_layer.buf.size.height = g_ctx.osd_h;
+        g_ctx.ui_layer.buf.stride[0]   = g_ctx.osd_stride;
+        g_ctx.ui_layer.buf.phy_addr[0] = g_ctx.osd_phy;
+        g_ctx.ui_layer.pos.x           = 24;
+        g_ctx.ui_layer.pos.y           = 16;
+        disp_update_layer(&g_ctx.ui_layer, -1);
+
+        // 显式关闭 Alpha，启用 Color Key
+        struct aicfb_alpha_config alpha = {AICFB_LAYER_TYPE_UI, 0, 0, 0};
+        disp_update_alpha(&alpha);
+
+        /*
+         * [OSD 透明黑规则] 根据格式确定 Key 值
+         * RGB565 -> 0x0000, RGB888/XRGB -> 0x000000
+         */
+        uint32_t               ck_val = 0x0000;
+        struct aicfb_ck_config ck     = {AICFB_LAYER_TYPE_UI, 1, ck_val};
+        disp_update_ck(&ck);
+    }
+    else
+    {
+        /* Path B: 传统叠加路径 (纯 UI Layer 0) */
+        // 确保 VI 图层关闭
+        g_ctx.vi_layer.enable = 0;
+        disp_update_layer(&g_ctx.vi_layer, -1);
+
+        // [FIX] 显式还原 UI 图层为全屏尺寸，解决退出隔离模式后的画面缩小问题
+        g_ctx.ui_layer.enable          = 1;
+        g_ctx.ui_layer.buf.buf_type    = MPP_PHY_ADDR;
+        g_ctx.ui_layer.buf.format      = g_ctx.info.format;
+        g_ctx.ui_layer.buf.size.width  = g_ctx.screen_w;
+        g_ctx.ui_layer.buf.size.height = g_ctx.screen_h;
+        g_ctx.ui_layer.buf.stride[0]   = g_ctx.info.stride;
+        g_ctx.ui_layer.buf.phy_addr[0] = phy;
+        g_ctx.ui_layer.pos.x           = 0;
+        g_ctx.ui_layer.pos.y           = 0;
+
+        /* 分页切换 (传统标准)：仅 FB 显存内的缓冲可用 PAN，CMA 补充缓冲走图层地址更新 */
+        disp_update_layer(&g_ctx.ui_layer, g_fb_cma[req->buf_idx] ? -1 : req->buf_idx);
+
+        // 在传统路径中，恢复 Alpha，关闭 Color Key
+        struct aicfb_alpha_config alpha = {AICFB_LAYER_TYPE_UI, 1, 0, 0};
+        disp_update_alpha(&alpha);
+
+        struct aicfb_ck_config ck = {AICFB_LAYER_TYPE_UI, 0, 0x0000};
+        disp_update_ck(&ck);
+    }
+}
+
+/*
+ * 显示线程：取出排队的帧，提交图层并等待 VSync。
+ * VSync 返回后新帧已在屏，上一帧的缓冲随即归还给渲染线程。
+ */
+static void flip_thread_entry(void *parameter)
+{
+    while (1)
+    {
+        rt_sem_take(g_flip_ready, RT_WAITING_FOREVER);
+        struct flip_req *req = &g_flip_queue[g_flip_head];
+        g_flip_head          = (g_flip_head + 1) % FB_RING_MAX;
+
+        flip_commit(req);
+        if (g_vsync_enabled)
+            mpp_fb_ioctl(g_ctx.fb, AICFB_WAIT_FOR_VSYNC, 0);
+
+        rt_sem_release(g_flip_free);
+    }
+}
+
+/* 渲染线程：排队一次翻转 (连同本帧的色彩配置) 后立即返回，不等待 VSync */
+static void flip_queue(int buf_idx, bool is_vi_isolated)
+{
+    struct flip_req *req = &g_flip_queue[g_flip_tail];
+    req->buf_idx         = buf_idx;
+    req->is_vi_isolated  = is_vi_isolated;
+    req->color           = g_disp_stage;
+    g_flip_tail          = (g_flip_tail + 1) % FB_RING_MAX;
+    rt_sem_release(g_flip_ready);
+}
+
+/* --- [OSD] 隔离图层上的 OSD --- */
+
+static struct ge_fence g_osd_fence;
+static int             g_osd_dirty_y = 0; /* 上一帧写过的行 */
+static int             g_osd_dirty_h = 0;
+static uint32_t        g_osd_gen     = 0; /* 缓冲中文字的代数 (0 表示从未绘制) */
+
+/* 只擦除上一帧写过的行，只 clean 本帧擦除与绘制触及的行 */
+static void osd_draw_isolated(void)
+{
+    int      stride = g_ctx.osd_stride;
+    uint32_t gen    = demo_perf_osd_gen();
+
+    /* 文字未变化：缓冲保持上一帧内容，跳过全部 OSD 工作 */
+    if (gen == g_osd_gen)
+        return;
+    g_osd_gen = gen;
+
+    /* GE 合成：面板整块覆盖上一帧，CPU 不触及缓冲，显示前由引擎等待 GE */
+    if (demo_perf_osd_ge(g_ctx.info.format))
+    {
+        ge_fence_ge_acquire(&g_osd_fence, true);
+        demo_perf_compose(&g_ctx, g_ctx.osd_phy, stride, g_ctx.osd_w, g_ctx.osd_h, false);
+        return;
+    }
+
+    ge_fence_cpu_acquire(g_ctx.ge, &g_osd_fence, 0, 0);
+    if (g_osd_dirty_h > 0)
+    {
+        memset(g_ctx.osd_vir + g_osd_dirty_y * stride, 0, g_osd_dirty_h * stride);
+        ge_fence_cpu_release(&g_osd_fence, g_osd_dirty_y * stride, g_osd_dirty_h * stride);
+    }
+
+    demo_perf_draw(&g_ctx, g_ctx.osd_phy, stride, g_ctx.info.format, g_ctx.osd_w, g_ctx.osd_h);
+    demo_perf_osd_dirty(&g_osd_dirty_y, &g_osd_dirty_h);
+    ge_fence_cpu_release(&g_osd_fence, g_osd_dirty_y * stride, g_osd_dirty_h * stride);
+
+    /* DE 与 GE 同为 DMA 读取方，移交即 clean */
+    demo_perf_phase_begin(DEMO_PHASE_CACHE);
+    ge_fence_ge_acquire(&g_osd_fence, false);
+    demo_perf_phase_end();
+}
+
 /* --- 核心渲染主线程 --- */
 static void render_thread_entry(void *parameter)
 {
-    int           current_buf_idx = 0;
-    unsigned long phy_addr_0, phy_addr_1;
+    int current_buf_idx = 0;
 
     /* 1. 硬件句柄开启与屏幕信息获取 */
     g_ctx.fb = mpp_fb_open();
@@ -130,6 +1059,7 @@ static void render_thread_entry(void *parameter)
         g_ctx.osd_vir = (uint8_t *)(unsigned long)g_ctx.osd_phy;
         memset(g_ctx.osd_vir, 0, osd_size);
         aicos_dcache_clean_range(g_ctx.osd_vir, osd_size);
+        ge_fence_init(&g_osd_fence, g_ctx.osd_vir, osd_size);
     }
 
     /* 3. 预置图层配置模板 */
@@ -142,9 +1072,20 @@ static void render_thread_entry(void *parameter)
     g_ctx.ui_layer.rect_id  = 0; /* 默认主矩形 */
     mpp_fb_ioctl(g_ctx.fb, AICFB_GET_LAYER_CONFIG, &g_ctx.ui_layer);
 
-    /* 获取双缓冲物理地址 */
-    phy_addr_0 = (unsigned long)g_ctx.info.framebuffer;
-    phy_addr_1 = phy_addr_0 + (g_ctx.info.stride * g_ctx.info.height);
+    /* 建立帧缓冲环并启动显示线程 (优先级高于渲染线程，保证按时翻转) */
+    if (flip_ring_init() < 0)
+    {
+        rt_kprintf("Demo Error: Flip ring init failed.\n");
+        return;
+    }
+    g_flip_thread = rt_thread_create("ge_flip", flip_thread_entry, RT_NULL, 2048, 19, 10);
+    if (!g_flip_thread)
+        return;
+    rt_thread_startup(g_flip_thread);
+
+    /* 预备线程 (优先级低于渲染线程，只在渲染线程等待时运行) */
+    if (prewarm_init() < 0)
+        return;
 
     int total_effects = get_effect_count();
     rt_kprintf("Demo Core: Found %d effects registered.\n", total_effects);
@@ -153,136 +1094,113 @@ static void render_thread_entry(void *parameter)
         return;
 
     /* 4. 初始化首个特效 */
+    /* curr_op 为空表示没有运行中的特效 (启动失败时只绘制 OSD，等待切换) */
     struct effect_ops *curr_op = get_effect_by_index(g_current_effect_idx);
-    if (curr_op && curr_op->init)
-        curr_op->init(&g_ctx);
+    if (curr_op)
+    {
+        const char *name = curr_op->name;
+        g_effect_failed  = effect_start(g_current_effect_idx, curr_op) < 0;
+        if (g_effect_failed)
+            curr_op = RT_NULL;
+        demo_perf_effect_begin(g_current_effect_idx, name);
+    }
 
     /* 5. 渲染主循环 */
     while (1)
     {
+        /*
+         * 取得一块空闲缓冲：缓冲按环序上屏、按环序归还，
+         * 因此下一块待写入的缓冲总是环中的下一个。
+         * 只有当环中所有缓冲都在排队或在屏时才会阻塞。
+         */
+        demo_perf_phase_begin(DEMO_PHASE_VSYNC);
+        rt_sem_take(g_flip_free, RT_WAITING_FOREVER);
+        demo_perf_phase_end();
+
         /* 响应切换请求 */
         if (g_req_effect_idx != -1)
         {
-            if (curr_op && curr_op->deinit)
-                curr_op->deinit(&g_ctx);
+            uint64_t t0 = demo_perf_now_us();
+            if (curr_op)
+                effect_stop(g_current_effect_idx, curr_op);
+            demo_bench_on_stop((uint32_t)(demo_perf_now_us() - t0));
 
-            g_current_effect_idx = g_req_effect_idx;
-            curr_op              = get_effect_by_index(g_current_effect_idx);
-            g_req_effect_idx     = -1;
+            g_current_effect_idx       = g_req_effect_idx;
+            struct effect_ops *next_op = get_effect_by_index(g_current_effect_idx);
+            g_req_effect_idx           = -1;
+            curr_op                    = RT_NULL;
 
-            if (curr_op)
+            if (next_op)
             {
-                rt_kprintf("Switch to [%d]: %s\n", g_current_effect_idx, curr_op->name);
-
-                /* [CRITICAL FIX] 每次切换必须强制复位硬件状态，防止残留 */
-                struct aicfb_ccm_config ccm_reset = {0};
-                mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
-                struct aicfb_gamma_config gamma_reset = {0};
-                mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_GAMMA_CONFIG, &gamma_reset);
-                struct aicfb_disp_prop prop_reset = {50, 50, 50, 50};
-                mpp_fb_ioctl(g_ctx.fb, AICFB_SET_DISP_PROP, &prop_reset);
-
-                if (curr_op->init)
-                    curr_op->init(&g_ctx);
+                rt_kprintf("Switch to [%d]: %s\n", g_current_effect_idx, next_op->name);
+
+                /* [CRITICAL FIX] 每次切换必须强制复位硬件状态，防止残留 (随新特效的首帧提交，旧帧保持原配置) */
+                disp_color_reset();
+
+                t0 = demo_perf_now_us();
+                g_effect_failed = effect_start(g_current_effect_idx, next_op) < 0;
+                if (!g_effect_failed)
+                    curr_op = next_op;
+                demo_perf_effect_begin(g_current_effect_idx, next_op->name);
+                demo_bench_on_start(g_current_effect_idx, (uint32_t)(demo_perf_now_us() - t0));
             }
         }
 
-        /* 确定当前待写入的 FB 缓冲 */
-        int           next_buf_idx = !current_buf_idx;
-        unsigned long next_phy     = (next_buf_idx == 0) ? phy_addr_0 : phy_addr_1;
+        int           next_buf_idx = (current_buf_idx + 1) % g_fb_num;
+        unsigned long next_phy     = g_fb_phy[next_buf_idx];
+        bool          isolated     = curr_op && (curr_op->is_vi_isolated || g_pipe_gamma);
 
         /* 更新性能监控数据 */
         demo_perf_update();
 
-        /* [HYBRID Zenith] 核心分流渲染逻辑 */
-        if (curr_op && curr_op->is_vi_isolated)
-        {
-            /* Path A: 现代隔离路径 (VI Effect + UI OSD) */
-            // 1. 配置 VI 图层 0 (背景)
-            g_ctx.vi_layer.enable          = 1;
-            g_ctx.vi_layer.buf.buf_type    = MPP_PHY_ADDR;
-            g_ctx.vi_layer.buf.format      = g_ctx.info.format;
-            g_ctx.vi_layer.buf.size.width  = g_ctx.screen_w;
-            g_ctx.vi_layer.buf.size.height = g_ctx.screen_h;
-            g_ctx.vi_layer.buf.stride[0]   = g_ctx.info.stride;
-            g_ctx.vi_layer.buf.phy_addr[0] = next_phy;
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_LAYER_CONFIG, &g_ctx.vi_layer);
-
-            // 2. 配置 UI 图层 1 (OSD 隔离)
-            g_ctx.ui_layer.enable          = 1;
-            g_ctx.ui_layer.buf.buf_type    = MPP_PHY_ADDR;
-            g_ctx.ui_layer.buf.format      = g_ctx.info.format; /* [FIX] 强制对齐主屏幕格式 */
-            g_ctx.ui_layer.buf.size.width  = g_ctx.osd_w;
-            g_ctx.ui_layer.buf.size.height = g_ctx.osd_h;
-            g_ctx.ui_layer.buf.stride[0]   = g_ctx.osd_stride;
-            g_ctx.ui_layer.buf.phy_addr[0] = g_ctx.osd_phy;
-            g_ctx.ui_layer.pos.x           = 24;
-            g_ctx.ui_layer.pos.y           = 16;
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_LAYER_CONFIG, &g_ctx.ui_layer);
-
-            // 显式关闭 Alpha，启用 Color Key
-            struct aicfb_alpha_config alpha = {AICFB_LAYER_TYPE_UI, 0, 0, 0};
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_ALPHA_CONFIG, &alpha);
-
-            /*
-             * [OSD 透明黑规则] 根据格式确定 Key 值
-             * RGB565 -> 0x0000, RGB888/XRGB -> 0x000000
-             */
-            uint32_t               ck_val = 0x0000;
-            struct aicfb_ck_config ck     = {AICFB_LAYER_TYPE_UI, 1, ck_val};
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_CK_CONFIG, &ck);
-
-            // 3. 执行绘制
-            curr_op->draw(&g_ctx, next_phy);
+        /* [HYBRID Zenith] 核心分流渲染逻辑 (图层配置由显示线程在翻转时提交) */
+        struct ge_fence *fb_fence = &g_fb_fence[next_buf_idx];
+        ge_fence_ge_acquire(fb_fence, true);
+        effect_render(curr_op, next_phy);
 
+        demo_perf_phase_begin(DEMO_PHASE_OSD);
+        if (isolated)
+        {
+            /* Path A: OSD 绘制于独立的 UI 图层缓冲，GE 从不触及，无需等待 */
             if (g_ctx.osd_vir)
-            {
-                memset(g_ctx.osd_vir, 0, g_ctx.osd_stride * g_ctx.osd_h);
-                demo_perf_draw(&g_ctx, g_ctx.osd_phy, g_ctx.osd_stride, g_ctx.info.format, g_ctx.osd_w, g_ctx.osd_h);
-                aicos_dcache_clean_range(g_ctx.osd_vir, g_ctx.osd_stride * g_ctx.osd_h);
-            }
+                osd_draw_isolated();
+        }
+        else if (demo_perf_osd_ge(g_ctx.info.format))
+        {
+            /* Path B: OSD 以 GE 叠加在帧缓冲上，排在特效指令之后，无需等待 */
+            demo_perf_compose(&g_ctx, next_phy, g_ctx.info.stride, g_ctx.screen_w, g_ctx.screen_h, true);
         }
         else
         {
-            /* Path B: 传统叠加路径 (纯 UI Layer 0) */
-            // 确保 VI 图层关闭
-            g_ctx.vi_layer.enable = 0;
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_LAYER_CONFIG, &g_ctx.vi_layer);
-
-            // [FIX] 显式还原 UI 图层为全屏尺寸，解决退出隔离模式后的画面缩小问题
-            g_ctx.ui_layer.enable          = 1;
-            g_ctx.ui_layer.buf.buf_type    = MPP_PHY_ADDR;
-            g_ctx.ui_layer.buf.format      = g_ctx.info.format;
-            g_ctx.ui_layer.buf.size.width  = g_ctx.screen_w;
-            g_ctx.ui_layer.buf.size.height = g_ctx.screen_h;
-            g_ctx.ui_layer.buf.stride[0]   = g_ctx.info.stride;
-            g_ctx.ui_layer.buf.phy_addr[0] = next_phy;
-            g_ctx.ui_layer.pos.x           = 0;
-            g_ctx.ui_layer.pos.y           = 0;
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_LAYER_CONFIG, &g_ctx.ui_layer);
-
-            // 在传统路径中，恢复 Alpha，关闭 Color Key
-            struct aicfb_alpha_config alpha = {AICFB_LAYER_TYPE_UI, 1, 0, 0};
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_ALPHA_CONFIG, &alpha);
-
-            struct aicfb_ck_config ck = {AICFB_LAYER_TYPE_UI, 0, 0x0000};
-            mpp_fb_ioctl(g_ctx.fb, AICFB_UPDATE_CK_CONFIG, &ck);
-
-            if (curr_op && curr_op->draw)
-                curr_op->draw(&g_ctx, next_phy);
+            /* Path B': 逐像素叠加在帧缓冲上，须先取回 GE 刚画完的 OSD 行带 */
+            int osd_y, osd_h;
+            demo_perf_osd_band(&osd_y, &osd_h);
+            demo_perf_phase_begin(DEMO_PHASE_GE_SYNC);
+            ge_fence_cpu_acquire(g_ctx.ge, fb_fence, osd_y * g_ctx.info.stride, osd_h * g_ctx.info.stride);
+            demo_perf_phase_end();
 
             demo_perf_draw(&g_ctx, next_phy, g_ctx.info.stride, g_ctx.info.format, g_ctx.screen_w, g_ctx.screen_h);
-
-            /* 分页切换 (传统标准) */
-            mpp_fb_ioctl(g_ctx.fb, AICFB_PAN_DISPLAY, &next_buf_idx);
+            demo_perf_osd_dirty(&osd_y, &osd_h);
+            ge_fence_cpu_release(fb_fence, osd_y * g_ctx.info.stride, osd_h * g_ctx.info.stride);
         }
+        demo_perf_phase_end();
 
-        /* 翻转显示并同步显示完成 */
-        mpp_fb_ioctl(g_ctx.fb, AICFB_WAIT_FOR_VSYNC, 0);
-        current_buf_idx = next_buf_idx;
+        /* 交给 DE 显示前：GE 必须完成 (逐像素叠加路径已在取回时等待)，CPU 写过的行须 clean */
+        demo_perf_phase_begin(DEMO_PHASE_GE_SYNC);
+        ge_fence_wait(g_ctx.ge, fb_fence);
+        if (isolated)
+            ge_fence_wait(g_ctx.ge, &g_osd_fence);
+        demo_perf_phase_end();
+        demo_perf_phase_begin(DEMO_PHASE_CACHE);
+        ge_fence_ge_acquire(fb_fence, false);
+        demo_perf_phase_end();
 
-        /* 短暂休眠以出让控制权 */
-        rt_thread_mdelay(1);
+        /* 排队翻转后立即开始下一帧，VSync 由显示线程等待 */
+        flip_queue(next_buf_idx, isolated);
+        current_buf_idx = next_buf_idx;
+        demo_perf_frame_end();
+        ge_batch_frame_end();
+        demo_bench_on_frame();
     }
 }
 
@@ -332,6 +1250,23 @@ void demo_jump_effect(int index)
         rt_kprintf("Invalid ID: %d\n", index);
 }
 
+int demo_current_effect(void)
+{
+    return g_current_effect_idx;
+}
+
+void demo_set_vsync(int enable)
+{
+    g_vsync_enabled = enable;
+}
+
+void demo_effect_set_load(int load)
+{
+    struct effect_ops *op = get_effect_by_index(g_current_effect_idx);
+    if (op && op->set_load && !g_effect_failed)
+        op->set_load(&g_ctx, load);
+}
+
 /* --- Shell 控制指令集 --- */
 
 static int cmd_demo_next(int argc, char **argv)
@@ -369,3 +1304,17 @@ static int cmd_demo_list(int argc, char **argv)
     return 0;
 }
 MSH_CMD_EXPORT_ALIAS(cmd_demo_list, demo_list, List all registered effects);
+
+static int cmd_demo_disp(int argc, char **argv)
+{
+    struct disp_stats st = g_disp.stats;
+    uint32_t          n  = MAX(st.frames, 1);
+    uint32_t          io = st.layer + st.alpha + st.ck + st.color + st.pan;
+
+    rt_kprintf("--- Display ioctls (%u frames) ---\n", st.frames);
+    rt_kprintf("layer %u, alpha %u, ck %u, color %u, pan %u, skipped %u\n", st.layer, st.alpha, st.ck, st.color, st.pan,
+               st.skipped);
+    rt_kprintf("ioctls per frame: %u.%02u\n", io / n, (io % n) * 100 / n);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_disp, demo_disp, Show display ioctl counters);
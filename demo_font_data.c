@@ -0,0 +1,469 @@
+/*
+ * Filename: demo_font_data.c
+ * 由 fonts/font_conv.py --embed 生成，请勿手工修改。
+ * 源资产：font_24px.bin (7280 字节)
+ */
+
+#include "demo_perf.h"
+
+#ifdef AIC_GE_DEMO_FONT_EMBED
+
+DEMO_FONT_EMBED(font_asset) = {
+    0x47, 0x46, 0x4e, 0x54, 0x02, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x20, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
+    0xee, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00,
+    0x20, 0x01, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x40, 0x02, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x17, 0x17, 0x00, 0x00,
+    0x58, 0x00, 0x2d, 0x00, 0x40, 0x05, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x85, 0x00, 0x1d, 0x00,
+    0x68, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xa2, 0x00, 0x06, 0x00, 0xe8, 0x08, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0xa8, 0x00, 0x13, 0x00, 0x90, 0x09, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0xbb, 0x00, 0x13, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xce, 0x00, 0x11, 0x00,
+    0x10, 0x0b, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xdf, 0x00, 0x0c, 0x00, 0x48, 0x0c, 0x00, 0x00,
+    0x07, 0x07, 0x00, 0x00, 0xeb, 0x00, 0x03, 0x00, 0xc8, 0x0d, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00,
+    0xee, 0x00, 0x02, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xf0, 0x00, 0x04, 0x00,
+    0x78, 0x0f, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0xf4, 0x00, 0x13, 0x00, 0x20, 0x10, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x07, 0x01, 0x1e, 0x00, 0xf8, 0x10, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x25, 0x01, 0x13, 0x00, 0x78, 0x12, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x38, 0x01, 0x15, 0x00,
+    0x68, 0x13, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x4d, 0x01, 0x17, 0x00, 0xd0, 0x14, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x64, 0x01, 0x17, 0x00, 0x38, 0x16, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0x7b, 0x01, 0x16, 0x00, 0xb8, 0x17, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x91, 0x01, 0x1c, 0x00,
+    0x20, 0x19, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0xad, 0x01, 0x11, 0x00, 0x88, 0x1a, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0xbe, 0x01, 0x1d, 0x00, 0xd8, 0x1b, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0xdb, 0x01, 0x1c, 0x00, 0x40, 0x1d, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xf7, 0x01, 0x08, 0x00,
+    0xa8, 0x1e, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xff, 0x01, 0x06, 0x00, 0x50, 0x1f, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x05, 0x02, 0x0e, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+    0x13, 0x02, 0x06, 0x00, 0x78, 0x21, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x19, 0x02, 0x0e, 0x00,
+    0xf8, 0x22, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x27, 0x02, 0x14, 0x00, 0x78, 0x24, 0x00, 0x00,
+    0x18, 0x18, 0x00, 0x00, 0x3b, 0x02, 0x32, 0x00, 0xc8, 0x25, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00,
+    0x6d, 0x02, 0x1c, 0x00, 0x08, 0x28, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x89, 0x02, 0x1b, 0x00,
+    0xb8, 0x29, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0xa4, 0x02, 0x18, 0x00, 0x38, 0x2b, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x00, 0xbc, 0x02, 0x1c, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0xd8, 0x02, 0x11, 0x00, 0x80, 0x2e, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0xe9, 0x02, 0x11, 0x00,
+    0xe8, 0x2f, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0xfa, 0x02, 0x1b, 0x00, 0x38, 0x31, 0x00, 0x00,
+    0x12, 0x12, 0x00, 0x00, 0x15, 0x03, 0x1f, 0x00, 0xe8, 0x32, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,
+    0x34, 0x03, 0x11, 0x00, 0x98, 0x34, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x45, 0x03, 0x14, 0x00,
+    0x28, 0x35, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x59, 0x03, 0x1f, 0x00, 0x78, 0x36, 0x00, 0x00,
+    0x0d, 0x0d, 0x00, 0x00, 0x78, 0x03, 0x11, 0x00, 0x10, 0x38, 0x00, 0x00, 0x16, 0x16, 0x00, 0x00,
+    0x89, 0x03, 0x33, 0x00, 0x48, 0x39, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0xbc, 0x03, 0x27, 0x00,
+    0x58, 0x3b, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0xe3, 0x03, 0x1d, 0x00, 0x08, 0x3d, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x16, 0x00, 0xb8, 0x3e, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00,
+    0x16, 0x04, 0x1e, 0x00, 0x20, 0x40, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x34, 0x04, 0x1c, 0x00,
+    0xd0, 0x41, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x50, 0x04, 0x18, 0x00, 0x50, 0x43, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x68, 0x04, 0x11, 0x00, 0xd0, 0x44, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
+    0x79, 0x04, 0x1f, 0x00, 0x50, 0x46, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x98, 0x04, 0x1e, 0x00,
+    0xe8, 0x47, 0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0xb6, 0x04, 0x32, 0x00, 0x98, 0x49, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x00, 0xe8, 0x04, 0x1c, 0x00, 0xf0, 0x4b, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
+    0x04, 0x05, 0x18, 0x00, 0x88, 0x4d, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x1c, 0x05, 0x11, 0x00,
+    0x20, 0x4f, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x2d, 0x05, 0x13, 0x00, 0xa0, 0x50, 0x00, 0x00,
+    0x09, 0x09, 0x00, 0x00, 0x40, 0x05, 0x13, 0x00, 0x60, 0x51, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x53, 0x05, 0x13, 0x00, 0x38, 0x52, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00, 0x66, 0x05, 0x0b, 0x00,
+    0xf8, 0x52, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x71, 0x05, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x71, 0x05, 0x04, 0x00, 0x20, 0x55, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00,
+    0x75, 0x05, 0x13, 0x00, 0xe0, 0x55, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x88, 0x05, 0x1a, 0x00,
+    0x30, 0x57, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0xa2, 0x05, 0x11, 0x00, 0x98, 0x58, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0xb3, 0x05, 0x1b, 0x00, 0xe8, 0x59, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00,
+    0xce, 0x05, 0x11, 0x00, 0x50, 0x5b, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0xdf, 0x05, 0x12, 0x00,
+    0xa0, 0x5c, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xf1, 0x05, 0x18, 0x00, 0x78, 0x5d, 0x00, 0x00,
+    0x0e, 0x0e, 0x00, 0x00, 0x09, 0x06, 0x1c, 0x00, 0xe0, 0x5e, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,
+    0x25, 0x06, 0x11, 0x00, 0x30, 0x60, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x36, 0x06, 0x11, 0x00,
+    0xc0, 0x60, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x47, 0x06, 0x1b, 0x00, 0x68, 0x61, 0x00, 0x00,
+    0x06, 0x06, 0x00, 0x00, 0x62, 0x06, 0x11, 0x00, 0xb8, 0x62, 0x00, 0x00, 0x16, 0x16, 0x00, 0x00,
+    0x73, 0x06, 0x24, 0x00, 0x48, 0x63, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x97, 0x06, 0x18, 0x00,
+    0x58, 0x65, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0xaf, 0x06, 0x14, 0x00, 0xa8, 0x66, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0xc3, 0x06, 0x16, 0x00, 0xf8, 0x67, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0xd9, 0x06, 0x17, 0x00, 0x60, 0x69, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0xf0, 0x06, 0x0e, 0x00,
+    0xc8, 0x6a, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xfe, 0x06, 0x10, 0x00, 0xa0, 0x6b, 0x00, 0x00,
+    0x09, 0x09, 0x00, 0x00, 0x0e, 0x07, 0x10, 0x00, 0xd8, 0x6c, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00,
+    0x1e, 0x07, 0x19, 0x00, 0xb0, 0x6d, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x37, 0x07, 0x15, 0x00,
+    0x00, 0x6f, 0x00, 0x00, 0x14, 0x14, 0x00, 0x00, 0x4c, 0x07, 0x23, 0x00, 0x50, 0x70, 0x00, 0x00,
+    0x0e, 0x0e, 0x00, 0x00, 0x6f, 0x07, 0x15, 0x00, 0x30, 0x72, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00,
+    0x84, 0x07, 0x15, 0x00, 0x80, 0x73, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0x99, 0x07, 0x0d, 0x00,
+    0xd0, 0x74, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00, 0xa6, 0x07, 0x13, 0x00, 0x08, 0x76, 0x00, 0x00,
+    0x09, 0x09, 0x00, 0x00, 0xb9, 0x07, 0x18, 0x00, 0x10, 0x77, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00,
+    0xd1, 0x07, 0x13, 0x00, 0xe8, 0x77, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xe4, 0x07, 0x0a, 0x00,
+    0xf0, 0x78, 0x00, 0x00, 0x06, 0x02, 0x03, 0x07, 0x02, 0x03, 0x08, 0x02, 0x03, 0x09, 0x02, 0x03,
+    0x0a, 0x02, 0x03, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x03, 0x0d, 0x02, 0x03, 0x0e, 0x02, 0x03, 0x0f,
+    0x02, 0x03, 0x10, 0x02, 0x03, 0x11, 0x02, 0x03, 0x13, 0x02, 0x02, 0x14, 0x02, 0x03, 0x15, 0x01,
+    0x04, 0x16, 0x02, 0x03, 0x06, 0x02, 0x03, 0x06, 0x07, 0x03, 0x07, 0x02, 0x03, 0x07, 0x07, 0x03,
+    0x08, 0x02, 0x03, 0x08, 0x07, 0x03, 0x09, 0x02, 0x03, 0x09, 0x07, 0x03, 0x0a, 0x02, 0x03, 0x0a,
+    0x07, 0x03, 0x0b, 0x02, 0x03, 0x0b, 0x07, 0x03, 0x06, 0x04, 0x03, 0x06, 0x0b, 0x02, 0x07, 0x04,
+    0x03, 0x07, 0x0a, 0x03, 0x08, 0x04, 0x03, 0x08, 0x0a, 0x03, 0x09, 0x04, 0x03, 0x09, 0x0a, 0x03,
+    0x0a, 0x01, 0x0e, 0x0b, 0x01, 0x0e, 0x0c, 0x01, 0x0e, 0x0d, 0x03, 0x03, 0x0d, 0x09, 0x03, 0x0e,
+    0x03, 0x03, 0x0e, 0x09, 0x03, 0x0f, 0x03, 0x03, 0x0f, 0x09, 0x03, 0x10, 0x00, 0x0e, 0x11, 0x00,
+    0x0e, 0x12, 0x00, 0x0e, 0x13, 0x02, 0x03, 0x13, 0x08, 0x03, 0x14, 0x02, 0x03, 0x14, 0x08, 0x03,
+    0x15, 0x02, 0x03, 0x15, 0x08, 0x03, 0x16, 0x02, 0x03, 0x16, 0x08, 0x03, 0x04, 0x07, 0x02, 0x05,
+    0x07, 0x02, 0x06, 0x06, 0x04, 0x07, 0x03, 0x09, 0x08, 0x02, 0x0b, 0x09, 0x02, 0x0c, 0x0a, 0x01,
+    0x04, 0x0a, 0x07, 0x02, 0x0a, 0x0b, 0x03, 0x0b, 0x01, 0x04, 0x0b, 0x07, 0x02, 0x0b, 0x0b, 0x03,
+    0x0c, 0x01, 0x04, 0x0c, 0x07, 0x02, 0x0d, 0x02, 0x07, 0x0e, 0x02, 0x09, 0x0f, 0x04, 0x09, 0x10,
+    0x07, 0x07, 0x11, 0x07, 0x02, 0x11, 0x0a, 0x05, 0x12, 0x01, 0x03, 0x12, 0x07, 0x02, 0x12, 0x0b,
+    0x04, 0x13, 0x01, 0x04, 0x13, 0x07, 0x02, 0x13, 0x0b, 0x04, 0x14, 0x01, 0x04, 0x14, 0x07, 0x02,
+    0x14, 0x0a, 0x05, 0x15, 0x02, 0x0c, 0x16, 0x02, 0x0b, 0x17, 0x04, 0x08, 0x06, 0x04, 0x03, 0x06,
+    0x12, 0x01, 0x07, 0x03, 0x06, 0x07, 0x10, 0x02, 0x08, 0x02, 0x03, 0x08, 0x06, 0x03, 0x08, 0x0f,
+    0x03, 0x09, 0x02, 0x02, 0x09, 0x07, 0x03, 0x09, 0x0e, 0x03, 0x0a, 0x02, 0x02, 0x0a, 0x07, 0x03,
+    0x0a, 0x0e, 0x02, 0x0b, 0x02, 0x02, 0x0b, 0x07, 0x03, 0x0b, 0x0d, 0x02, 0x0c, 0x02, 0x03, 0x0c,
+    0x07, 0x02, 0x0c, 0x0c, 0x03, 0x0d, 0x03, 0x06, 0x0d, 0x0c, 0x02, 0x0e, 0x04, 0x04, 0x0e, 0x0b,
+    0x02, 0x0f, 0x0a, 0x03, 0x0f, 0x11, 0x01, 0x10, 0x0a, 0x02, 0x10, 0x0f, 0x05, 0x11, 0x09, 0x02,
+    0x11, 0x0e, 0x07, 0x12, 0x08, 0x03, 0x12, 0x0e, 0x02, 0x12, 0x13, 0x02, 0x13, 0x07, 0x03, 0x13,
+    0x0e, 0x02, 0x13, 0x13, 0x03, 0x14, 0x07, 0x02, 0x14, 0x0e, 0x02, 0x14, 0x13, 0x03, 0x15, 0x06,
+    0x03, 0x15, 0x0e, 0x02, 0x15, 0x13, 0x02, 0x16, 0x05, 0x03, 0x16, 0x0e, 0x07, 0x17, 0x04, 0x03,
+    0x17, 0x0f, 0x05, 0x06, 0x06, 0x02, 0x07, 0x04, 0x06, 0x08, 0x03, 0x08, 0x09, 0x02, 0x04, 0x09,
+    0x08, 0x03, 0x0a, 0x02, 0x03, 0x0a, 0x09, 0x03, 0x0b, 0x02, 0x03, 0x0b, 0x08, 0x03, 0x0c, 0x03,
+    0x03, 0x0c, 0x07, 0x04, 0x0d, 0x03, 0x07, 0x0e, 0x04, 0x05, 0x0f, 0x03, 0x05, 0x10, 0x02, 0x07,
+    0x10, 0x0c, 0x03, 0x11, 0x01, 0x04, 0x11, 0x06, 0x04, 0x11, 0x0c, 0x03, 0x12, 0x01, 0x03, 0x12,
+    0x07, 0x07, 0x13, 0x01, 0x03, 0x13, 0x08, 0x06, 0x14, 0x01, 0x04, 0x14, 0x09, 0x05, 0x15, 0x01,
+    0x0d, 0x16, 0x02, 0x0d, 0x17, 0x03, 0x07, 0x17, 0x0c, 0x04, 0x06, 0x02, 0x03, 0x07, 0x02, 0x03,
+    0x08, 0x02, 0x03, 0x09, 0x02, 0x03, 0x0a, 0x02, 0x03, 0x0b, 0x02, 0x03, 0x05, 0x04, 0x04, 0x06,
+    0x04, 0x03, 0x07, 0x03, 0x04, 0x08, 0x03, 0x03, 0x09, 0x03, 0x03, 0x0a, 0x02, 0x04, 0x0b, 0x02,
+    0x04, 0x0c, 0x02, 0x03, 0x0d, 0x02, 0x03, 0x0e, 0x02, 0x03, 0x0f, 0x02, 0x03, 0x10, 0x02, 0x03,
+    0x11, 0x02, 0x03, 0x12, 0x02, 0x03, 0x13, 0x02, 0x04, 0x14, 0x02, 0x04, 0x15, 0x02, 0x04, 0x16,
+    0x03, 0x03, 0x17, 0x03, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x04, 0x07, 0x02, 0x03, 0x08, 0x02,
+    0x04, 0x09, 0x02, 0x04, 0x0a, 0x03, 0x03, 0x0b, 0x03, 0x03, 0x0c, 0x03, 0x04, 0x0d, 0x03, 0x04,
+    0x0e, 0x03, 0x04, 0x0f, 0x03, 0x04, 0x10, 0x03, 0x04, 0x11, 0x03, 0x04, 0x12, 0x03, 0x04, 0x13,
+    0x03, 0x03, 0x14, 0x03, 0x03, 0x15, 0x02, 0x04, 0x16, 0x02, 0x04, 0x17, 0x02, 0x03, 0x06, 0x05,
+    0x03, 0x07, 0x03, 0x01, 0x07, 0x06, 0x02, 0x07, 0x0a, 0x01, 0x08, 0x02, 0x03, 0x08, 0x06, 0x01,
+    0x08, 0x08, 0x03, 0x09, 0x03, 0x07, 0x0a, 0x05, 0x03, 0x0b, 0x03, 0x08, 0x0c, 0x02, 0x03, 0x0c,
+    0x06, 0x01, 0x0c, 0x08, 0x03, 0x0d, 0x03, 0x01, 0x0d, 0x06, 0x02, 0x0d, 0x0a, 0x01, 0x0e, 0x05,
+    0x03, 0x0b, 0x06, 0x03, 0x0c, 0x06, 0x03, 0x0d, 0x06, 0x03, 0x0e, 0x06, 0x03, 0x0f, 0x06, 0x03,
+    0x10, 0x02, 0x0c, 0x11, 0x02, 0x0c, 0x12, 0x02, 0x0c, 0x13, 0x06, 0x03, 0x14, 0x06, 0x03, 0x15,
+    0x06, 0x03, 0x16, 0x06, 0x03, 0x15, 0x02, 0x03, 0x16, 0x02, 0x03, 0x17, 0x01, 0x03, 0x0f, 0x01,
+    0x08, 0x10, 0x01, 0x08, 0x14, 0x02, 0x02, 0x15, 0x02, 0x03, 0x16, 0x01, 0x04, 0x17, 0x02, 0x03,
+    0x05, 0x06, 0x03, 0x06, 0x05, 0x03, 0x07, 0x05, 0x03, 0x08, 0x05, 0x03, 0x09, 0x04, 0x04, 0x0a,
+    0x04, 0x03, 0x0b, 0x04, 0x03, 0x0c, 0x04, 0x03, 0x0d, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x0f, 0x03,
+    0x03, 0x10, 0x03, 0x03, 0x11, 0x02, 0x03, 0x12, 0x02, 0x03, 0x13, 0x02, 0x03, 0x14, 0x02, 0x03,
+    0x15, 0x01, 0x03, 0x16, 0x01, 0x03, 0x17, 0x01, 0x03, 0x06, 0x06, 0x04, 0x07, 0x04, 0x08, 0x08,
+    0x03, 0x0a, 0x09, 0x02, 0x05, 0x09, 0x09, 0x05, 0x0a, 0x02, 0x04, 0x0a, 0x0a, 0x04, 0x0b, 0x01,
+    0x04, 0x0b, 0x0b, 0x03, 0x0c, 0x01, 0x04, 0x0c, 0x0b, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0b, 0x04,
+    0x0e, 0x01, 0x03, 0x0e, 0x0b, 0x04, 0x0f, 0x01, 0x03, 0x0f, 0x0b, 0x04, 0x10, 0x01, 0x03, 0x10,
+    0x0b, 0x04, 0x11, 0x01, 0x04, 0x11, 0x0b, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0b, 0x04, 0x13, 0x02,
+    0x03, 0x13, 0x0b, 0x03, 0x14, 0x02, 0x04, 0x14, 0x0a, 0x04, 0x15, 0x02, 0x0b, 0x16, 0x03, 0x0a,
+    0x17, 0x05, 0x06, 0x06, 0x03, 0x05, 0x07, 0x02, 0x06, 0x08, 0x01, 0x07, 0x09, 0x01, 0x03, 0x09,
+    0x05, 0x03, 0x0a, 0x01, 0x01, 0x0a, 0x05, 0x03, 0x0b, 0x05, 0x03, 0x0c, 0x05, 0x03, 0x0d, 0x05,
+    0x03, 0x0e, 0x05, 0x03, 0x0f, 0x05, 0x03, 0x10, 0x05, 0x03, 0x11, 0x05, 0x03, 0x12, 0x05, 0x03,
+    0x13, 0x05, 0x03, 0x14, 0x05, 0x03, 0x15, 0x05, 0x03, 0x16, 0x05, 0x03, 0x06, 0x05, 0x04, 0x07,
+    0x03, 0x08, 0x08, 0x02, 0x0a, 0x09, 0x02, 0x04, 0x09, 0x09, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0a,
+    0x03, 0x0b, 0x01, 0x03, 0x0b, 0x0a, 0x03, 0x0c, 0x0a, 0x03, 0x0d, 0x0a, 0x03, 0x0e, 0x09, 0x04,
+    0x0f, 0x08, 0x04, 0x10, 0x07, 0x04, 0x11, 0x06, 0x04, 0x12, 0x04, 0x05, 0x13, 0x03, 0x05, 0x14,
+    0x02, 0x05, 0x15, 0x01, 0x0d, 0x16, 0x01, 0x0d, 0x17, 0x01, 0x0d, 0x06, 0x06, 0x04, 0x07, 0x03,
+    0x09, 0x08, 0x02, 0x0b, 0x09, 0x02, 0x04, 0x09, 0x09, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0a, 0x04,
+    0x0b, 0x01, 0x04, 0x0b, 0x0a, 0x04, 0x0c, 0x0a, 0x03, 0x0d, 0x09, 0x04, 0x0e, 0x06, 0x06, 0x0f,
+    0x06, 0x06, 0x10, 0x08, 0x05, 0x11, 0x0a, 0x04, 0x12, 0x0a, 0x04, 0x13, 0x01, 0x04, 0x13, 0x0b,
+    0x03, 0x14, 0x01, 0x04, 0x14, 0x0a, 0x04, 0x15, 0x02, 0x0c, 0x16, 0x03, 0x0a, 0x17, 0x04, 0x07,
+    0x06, 0x08, 0x05, 0x07, 0x07, 0x06, 0x08, 0x06, 0x07, 0x09, 0x06, 0x07, 0x0a, 0x05, 0x08, 0x0b,
+    0x04, 0x04, 0x0b, 0x09, 0x04, 0x0c, 0x04, 0x03, 0x0c, 0x09, 0x04, 0x0d, 0x03, 0x04, 0x0d, 0x09,
+    0x04, 0x0e, 0x02, 0x04, 0x0e, 0x09, 0x04, 0x0f, 0x02, 0x03, 0x0f, 0x09, 0x04, 0x10, 0x01, 0x04,
+    0x10, 0x09, 0x04, 0x11, 0x01, 0x0e, 0x12, 0x01, 0x0e, 0x13, 0x01, 0x0e, 0x14, 0x09, 0x04, 0x15,
+    0x09, 0x04, 0x16, 0x09, 0x04, 0x06, 0x02, 0x0b, 0x07, 0x02, 0x0b, 0x08, 0x02, 0x03, 0x09, 0x02,
+    0x03, 0x0a, 0x01, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x07, 0x02, 0x0c, 0x01, 0x0b, 0x0d, 0x01, 0x0c,
+    0x0e, 0x01, 0x04, 0x0e, 0x09, 0x04, 0x0f, 0x04, 0x01, 0x0f, 0x0a, 0x04, 0x10, 0x0a, 0x04, 0x11,
+    0x0a, 0x04, 0x12, 0x01, 0x03, 0x12, 0x0a, 0x04, 0x13, 0x01, 0x04, 0x13, 0x09, 0x04, 0x14, 0x02,
+    0x0b, 0x15, 0x02, 0x0a, 0x16, 0x04, 0x07, 0x06, 0x06, 0x04, 0x07, 0x04, 0x08, 0x08, 0x03, 0x0a,
+    0x09, 0x02, 0x05, 0x09, 0x09, 0x05, 0x0a, 0x02, 0x03, 0x0a, 0x0a, 0x04, 0x0b, 0x01, 0x04, 0x0c,
+    0x01, 0x04, 0x0c, 0x08, 0x01, 0x0d, 0x01, 0x03, 0x0d, 0x05, 0x07, 0x0e, 0x01, 0x0c, 0x0f, 0x01,
+    0x05, 0x0f, 0x09, 0x05, 0x10, 0x01, 0x04, 0x10, 0x0a, 0x04, 0x11, 0x01, 0x04, 0x11, 0x0b, 0x03,
+    0x12, 0x01, 0x04, 0x12, 0x0b, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0b, 0x03, 0x14, 0x02, 0x04, 0x14,
+    0x0a, 0x04, 0x15, 0x02, 0x0b, 0x16, 0x03, 0x0a, 0x17, 0x04, 0x07, 0x06, 0x01, 0x0c, 0x07, 0x01,
+    0x0c, 0x08, 0x01, 0x0c, 0x09, 0x09, 0x03, 0x0a, 0x08, 0x04, 0x0b, 0x08, 0x03, 0x0c, 0x07, 0x04,
+    0x0d, 0x07, 0x03, 0x0e, 0x06, 0x04, 0x0f, 0x06, 0x03, 0x10, 0x05, 0x04, 0x11, 0x05, 0x03, 0x12,
+    0x04, 0x04, 0x13, 0x04, 0x03, 0x14, 0x03, 0x04, 0x15, 0x03, 0x03, 0x16, 0x02, 0x04, 0x06, 0x06,
+    0x04, 0x07, 0x03, 0x09, 0x08, 0x02, 0x0b, 0x09, 0x02, 0x04, 0x09, 0x09, 0x04, 0x0a, 0x01, 0x04,
+    0x0a, 0x0a, 0x04, 0x0b, 0x02, 0x03, 0x0b, 0x0a, 0x04, 0x0c, 0x02, 0x03, 0x0c, 0x0a, 0x03, 0x0d,
+    0x02, 0x05, 0x0d, 0x09, 0x04, 0x0e, 0x04, 0x07, 0x0f, 0x03, 0x09, 0x10, 0x02, 0x05, 0x10, 0x08,
+    0x05, 0x11, 0x01, 0x04, 0x11, 0x0a, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0b, 0x03, 0x13, 0x01, 0x04,
+    0x13, 0x0b, 0x03, 0x14, 0x01, 0x04, 0x14, 0x0a, 0x04, 0x15, 0x01, 0x06, 0x15, 0x08, 0x06, 0x16,
+    0x02, 0x0b, 0x17, 0x04, 0x07, 0x06, 0x05, 0x04, 0x07, 0x03, 0x08, 0x08, 0x02, 0x0a, 0x09, 0x02,
+    0x04, 0x09, 0x09, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0a, 0x04, 0x0b, 0x01, 0x03, 0x0b, 0x0a, 0x04,
+    0x0c, 0x01, 0x03, 0x0c, 0x0a, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0a, 0x04, 0x0e, 0x01, 0x04, 0x0e,
+    0x09, 0x05, 0x0f, 0x02, 0x0c, 0x10, 0x03, 0x07, 0x10, 0x0b, 0x03, 0x11, 0x04, 0x05, 0x11, 0x0b,
+    0x03, 0x12, 0x0b, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x04, 0x14, 0x01, 0x04, 0x14, 0x09, 0x04,
+    0x15, 0x02, 0x0b, 0x16, 0x03, 0x09, 0x17, 0x04, 0x06, 0x0c, 0x02, 0x02, 0x0d, 0x02, 0x03, 0x0e,
+    0x01, 0x04, 0x0f, 0x02, 0x03, 0x14, 0x02, 0x02, 0x15, 0x02, 0x03, 0x16, 0x01, 0x04, 0x17, 0x02,
+    0x03, 0x0c, 0x03, 0x02, 0x0d, 0x02, 0x03, 0x0e, 0x02, 0x04, 0x0f, 0x02, 0x03, 0x16, 0x02, 0x03,
+    0x17, 0x02, 0x03, 0x0a, 0x0d, 0x01, 0x0b, 0x0b, 0x03, 0x0c, 0x09, 0x05, 0x0d, 0x06, 0x08, 0x0e,
+    0x04, 0x08, 0x0f, 0x02, 0x07, 0x10, 0x02, 0x05, 0x11, 0x02, 0x05, 0x12, 0x02, 0x07, 0x13, 0x04,
+    0x07, 0x14, 0x06, 0x08, 0x15, 0x09, 0x05, 0x16, 0x0b, 0x03, 0x17, 0x0d, 0x01, 0x0c, 0x02, 0x0c,
+    0x0d, 0x02, 0x0c, 0x0e, 0x02, 0x0c, 0x11, 0x02, 0x0c, 0x12, 0x02, 0x0c, 0x13, 0x02, 0x0c, 0x0a,
+    0x02, 0x01, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x05, 0x0d, 0x02, 0x07, 0x0e, 0x04, 0x08, 0x0f, 0x07,
+    0x07, 0x10, 0x09, 0x05, 0x11, 0x09, 0x05, 0x12, 0x07, 0x07, 0x13, 0x05, 0x07, 0x14, 0x02, 0x08,
+    0x15, 0x02, 0x05, 0x16, 0x02, 0x03, 0x17, 0x02, 0x01, 0x06, 0x05, 0x04, 0x07, 0x03, 0x08, 0x08,
+    0x02, 0x0a, 0x09, 0x01, 0x04, 0x09, 0x08, 0x04, 0x0a, 0x01, 0x03, 0x0a, 0x09, 0x03, 0x0b, 0x01,
+    0x03, 0x0b, 0x09, 0x03, 0x0c, 0x09, 0x03, 0x0d, 0x08, 0x04, 0x0e, 0x06, 0x05, 0x0f, 0x05, 0x05,
+    0x10, 0x05, 0x03, 0x11, 0x05, 0x03, 0x12, 0x05, 0x03, 0x14, 0x05, 0x02, 0x15, 0x04, 0x04, 0x16,
+    0x04, 0x04, 0x17, 0x05, 0x03, 0x06, 0x07, 0x0a, 0x07, 0x05, 0x0e, 0x08, 0x04, 0x06, 0x08, 0x0e,
+    0x06, 0x09, 0x03, 0x05, 0x09, 0x11, 0x04, 0x0a, 0x03, 0x03, 0x0a, 0x12, 0x04, 0x0b, 0x02, 0x03,
+    0x0b, 0x09, 0x05, 0x0b, 0x0f, 0x02, 0x0b, 0x13, 0x03, 0x0c, 0x02, 0x03, 0x0c, 0x08, 0x09, 0x0c,
+    0x14, 0x03, 0x0d, 0x01, 0x03, 0x0d, 0x07, 0x0a, 0x0d, 0x14, 0x03, 0x0e, 0x01, 0x03, 0x0e, 0x07,
+    0x03, 0x0e, 0x0e, 0x03, 0x0e, 0x14, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x06, 0x03, 0x0f, 0x0f, 0x02,
+    0x0f, 0x14, 0x03, 0x10, 0x01, 0x03, 0x10, 0x06, 0x03, 0x10, 0x0f, 0x02, 0x10, 0x14, 0x03, 0x11,
+    0x01, 0x03, 0x11, 0x06, 0x03, 0x11, 0x0f, 0x02, 0x11, 0x14, 0x03, 0x12, 0x01, 0x03, 0x12, 0x07,
+    0x02, 0x12, 0x0e, 0x03, 0x12, 0x14, 0x03, 0x13, 0x01, 0x03, 0x13, 0x07, 0x03, 0x13, 0x0e, 0x03,
+    0x13, 0x14, 0x03, 0x14, 0x01, 0x03, 0x14, 0x07, 0x0f, 0x15, 0x02, 0x03, 0x15, 0x08, 0x0e, 0x16,
+    0x02, 0x04, 0x16, 0x0a, 0x03, 0x16, 0x11, 0x03, 0x17, 0x03, 0x04, 0x06, 0x06, 0x05, 0x07, 0x06,
+    0x06, 0x08, 0x05, 0x07, 0x09, 0x05, 0x03, 0x09, 0x09, 0x03, 0x0a, 0x05, 0x03, 0x0a, 0x09, 0x04,
+    0x0b, 0x04, 0x04, 0x0b, 0x09, 0x04, 0x0c, 0x04, 0x04, 0x0c, 0x0a, 0x03, 0x0d, 0x04, 0x03, 0x0d,
+    0x0a, 0x04, 0x0e, 0x03, 0x04, 0x0e, 0x0a, 0x04, 0x0f, 0x03, 0x04, 0x0f, 0x0b, 0x04, 0x10, 0x03,
+    0x0c, 0x11, 0x02, 0x0d, 0x12, 0x02, 0x0e, 0x13, 0x02, 0x03, 0x13, 0x0c, 0x04, 0x14, 0x01, 0x04,
+    0x14, 0x0c, 0x04, 0x15, 0x01, 0x04, 0x15, 0x0d, 0x04, 0x16, 0x00, 0x04, 0x16, 0x0d, 0x04, 0x06,
+    0x01, 0x0b, 0x07, 0x01, 0x0c, 0x08, 0x01, 0x04, 0x08, 0x09, 0x05, 0x09, 0x01, 0x04, 0x09, 0x0a,
+    0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0b, 0x03, 0x0b, 0x01, 0x04, 0x0b, 0x0a, 0x04, 0x0c, 0x01, 0x04,
+    0x0c, 0x09, 0x04, 0x0d, 0x01, 0x0b, 0x0e, 0x01, 0x0c, 0x0f, 0x01, 0x04, 0x0f, 0x09, 0x05, 0x10,
+    0x01, 0x04, 0x10, 0x0b, 0x04, 0x11, 0x01, 0x04, 0x11, 0x0b, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0b,
+    0x04, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x05, 0x14, 0x01, 0x0d, 0x15, 0x01, 0x0c, 0x16, 0x01, 0x0b,
+    0x06, 0x07, 0x04, 0x07, 0x05, 0x09, 0x08, 0x03, 0x0c, 0x09, 0x03, 0x0d, 0x0a, 0x02, 0x04, 0x0a,
+    0x0c, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x0d, 0x03, 0x0c, 0x01, 0x04, 0x0c, 0x0d, 0x04, 0x0d, 0x01,
+    0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04, 0x12, 0x01, 0x04,
+    0x12, 0x0d, 0x04, 0x13, 0x02, 0x04, 0x13, 0x0c, 0x04, 0x14, 0x02, 0x05, 0x14, 0x0b, 0x05, 0x15,
+    0x03, 0x0c, 0x16, 0x04, 0x0a, 0x17, 0x06, 0x07, 0x06, 0x01, 0x0b, 0x07, 0x01, 0x0d, 0x08, 0x01,
+    0x0d, 0x09, 0x01, 0x04, 0x09, 0x0b, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0c, 0x04, 0x0b, 0x01, 0x04,
+    0x0b, 0x0c, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x0c, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0d, 0x03, 0x0e,
+    0x01, 0x04, 0x0e, 0x0d, 0x03, 0x0f, 0x01, 0x04, 0x0f, 0x0c, 0x04, 0x10, 0x01, 0x04, 0x10, 0x0c,
+    0x04, 0x11, 0x01, 0x04, 0x11, 0x0c, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0b, 0x04, 0x13, 0x01, 0x04,
+    0x13, 0x0a, 0x05, 0x14, 0x01, 0x0d, 0x15, 0x01, 0x0c, 0x16, 0x01, 0x0a, 0x06, 0x01, 0x0d, 0x07,
+    0x01, 0x0d, 0x08, 0x01, 0x0d, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0b, 0x01, 0x04, 0x0c, 0x01,
+    0x04, 0x0d, 0x01, 0x0c, 0x0e, 0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04,
+    0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x0d, 0x15, 0x01, 0x0d, 0x16, 0x01, 0x0d, 0x06,
+    0x01, 0x0c, 0x07, 0x01, 0x0c, 0x08, 0x01, 0x0c, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0b, 0x01,
+    0x04, 0x0c, 0x01, 0x04, 0x0d, 0x01, 0x0c, 0x0e, 0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x10, 0x01, 0x04,
+    0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x04, 0x15, 0x01, 0x04, 0x16,
+    0x01, 0x04, 0x06, 0x07, 0x04, 0x07, 0x05, 0x09, 0x08, 0x03, 0x0c, 0x09, 0x03, 0x06, 0x09, 0x0a,
+    0x06, 0x0a, 0x02, 0x04, 0x0a, 0x0c, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x0d, 0x04, 0x0c, 0x01, 0x04,
+    0x0d, 0x01, 0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x07, 0x10, 0x01, 0x04, 0x10,
+    0x0a, 0x07, 0x11, 0x01, 0x04, 0x11, 0x0d, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0d, 0x04, 0x13, 0x02,
+    0x04, 0x13, 0x0d, 0x03, 0x14, 0x02, 0x05, 0x14, 0x0c, 0x04, 0x15, 0x03, 0x0c, 0x16, 0x04, 0x0a,
+    0x17, 0x05, 0x08, 0x06, 0x01, 0x04, 0x06, 0x0d, 0x03, 0x07, 0x01, 0x04, 0x07, 0x0d, 0x03, 0x08,
+    0x01, 0x04, 0x08, 0x0d, 0x03, 0x09, 0x01, 0x04, 0x09, 0x0d, 0x03, 0x0a, 0x01, 0x04, 0x0a, 0x0d,
+    0x03, 0x0b, 0x01, 0x04, 0x0b, 0x0d, 0x03, 0x0c, 0x01, 0x04, 0x0c, 0x0d, 0x03, 0x0d, 0x01, 0x0f,
+    0x0e, 0x01, 0x0f, 0x0f, 0x01, 0x0f, 0x10, 0x01, 0x04, 0x10, 0x0d, 0x03, 0x11, 0x01, 0x04, 0x11,
+    0x0d, 0x03, 0x12, 0x01, 0x04, 0x12, 0x0d, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0d, 0x03, 0x14, 0x01,
+    0x04, 0x14, 0x0d, 0x03, 0x15, 0x01, 0x04, 0x15, 0x0d, 0x03, 0x16, 0x01, 0x04, 0x16, 0x0d, 0x03,
+    0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x08, 0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0b,
+    0x01, 0x04, 0x0c, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x10, 0x01,
+    0x04, 0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x04, 0x15, 0x01, 0x04,
+    0x16, 0x01, 0x04, 0x06, 0x09, 0x03, 0x07, 0x09, 0x03, 0x08, 0x09, 0x03, 0x09, 0x09, 0x03, 0x0a,
+    0x09, 0x03, 0x0b, 0x09, 0x03, 0x0c, 0x09, 0x03, 0x0d, 0x09, 0x03, 0x0e, 0x09, 0x03, 0x0f, 0x09,
+    0x03, 0x10, 0x09, 0x03, 0x11, 0x01, 0x03, 0x11, 0x09, 0x03, 0x12, 0x01, 0x03, 0x12, 0x09, 0x03,
+    0x13, 0x01, 0x04, 0x13, 0x08, 0x04, 0x14, 0x01, 0x0b, 0x15, 0x02, 0x09, 0x16, 0x03, 0x07, 0x06,
+    0x01, 0x04, 0x06, 0x0b, 0x05, 0x07, 0x01, 0x04, 0x07, 0x0a, 0x05, 0x08, 0x01, 0x04, 0x08, 0x09,
+    0x05, 0x09, 0x01, 0x04, 0x09, 0x09, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x08, 0x04, 0x0b, 0x01, 0x04,
+    0x0b, 0x07, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x06, 0x04, 0x0d, 0x01, 0x09, 0x0e, 0x01, 0x0a, 0x0f,
+    0x01, 0x0a, 0x10, 0x01, 0x05, 0x10, 0x08, 0x04, 0x11, 0x01, 0x05, 0x11, 0x09, 0x04, 0x12, 0x01,
+    0x04, 0x12, 0x09, 0x04, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x04, 0x14, 0x01, 0x04, 0x14, 0x0b, 0x04,
+    0x15, 0x01, 0x04, 0x15, 0x0b, 0x04, 0x16, 0x01, 0x04, 0x16, 0x0c, 0x04, 0x06, 0x01, 0x04, 0x07,
+    0x01, 0x04, 0x08, 0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0b, 0x01, 0x04, 0x0c, 0x01,
+    0x04, 0x0d, 0x01, 0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04,
+    0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x0c, 0x15, 0x01, 0x0c, 0x16, 0x01, 0x0c, 0x06,
+    0x01, 0x06, 0x06, 0x0f, 0x05, 0x07, 0x01, 0x06, 0x07, 0x0e, 0x06, 0x08, 0x01, 0x07, 0x08, 0x0e,
+    0x06, 0x09, 0x01, 0x07, 0x09, 0x0e, 0x06, 0x0a, 0x01, 0x08, 0x0a, 0x0d, 0x07, 0x0b, 0x01, 0x08,
+    0x0b, 0x0d, 0x03, 0x0b, 0x11, 0x03, 0x0c, 0x01, 0x04, 0x0c, 0x06, 0x03, 0x0c, 0x0d, 0x03, 0x0c,
+    0x11, 0x03, 0x0d, 0x01, 0x04, 0x0d, 0x06, 0x04, 0x0d, 0x0c, 0x04, 0x0d, 0x11, 0x03, 0x0e, 0x01,
+    0x04, 0x0e, 0x06, 0x04, 0x0e, 0x0c, 0x03, 0x0e, 0x11, 0x03, 0x0f, 0x01, 0x04, 0x0f, 0x07, 0x03,
+    0x0f, 0x0c, 0x03, 0x0f, 0x11, 0x03, 0x10, 0x01, 0x04, 0x10, 0x07, 0x03, 0x10, 0x0b, 0x04, 0x10,
+    0x11, 0x03, 0x11, 0x01, 0x04, 0x11, 0x07, 0x07, 0x11, 0x11, 0x03, 0x12, 0x01, 0x04, 0x12, 0x08,
+    0x06, 0x12, 0x11, 0x03, 0x13, 0x01, 0x04, 0x13, 0x08, 0x06, 0x13, 0x11, 0x03, 0x14, 0x01, 0x04,
+    0x14, 0x09, 0x04, 0x14, 0x11, 0x03, 0x15, 0x01, 0x04, 0x15, 0x09, 0x04, 0x15, 0x11, 0x03, 0x16,
+    0x01, 0x04, 0x16, 0x09, 0x04, 0x16, 0x11, 0x03, 0x06, 0x01, 0x05, 0x06, 0x0d, 0x03, 0x07, 0x01,
+    0x06, 0x07, 0x0d, 0x03, 0x08, 0x01, 0x06, 0x08, 0x0d, 0x03, 0x09, 0x01, 0x07, 0x09, 0x0d, 0x03,
+    0x0a, 0x01, 0x07, 0x0a, 0x0d, 0x03, 0x0b, 0x01, 0x08, 0x0b, 0x0d, 0x03, 0x0c, 0x01, 0x04, 0x0c,
+    0x06, 0x04, 0x0c, 0x0d, 0x03, 0x0d, 0x01, 0x04, 0x0d, 0x07, 0x03, 0x0d, 0x0d, 0x03, 0x0e, 0x01,
+    0x04, 0x0e, 0x07, 0x04, 0x0e, 0x0d, 0x03, 0x0f, 0x01, 0x04, 0x0f, 0x08, 0x04, 0x0f, 0x0d, 0x03,
+    0x10, 0x01, 0x04, 0x10, 0x08, 0x04, 0x10, 0x0d, 0x03, 0x11, 0x01, 0x04, 0x11, 0x09, 0x07, 0x12,
+    0x01, 0x04, 0x12, 0x0a, 0x06, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x06, 0x14, 0x01, 0x04, 0x14, 0x0b,
+    0x05, 0x15, 0x01, 0x04, 0x15, 0x0c, 0x04, 0x16, 0x01, 0x04, 0x16, 0x0c, 0x04, 0x06, 0x07, 0x04,
+    0x07, 0x05, 0x08, 0x08, 0x03, 0x0c, 0x09, 0x03, 0x0d, 0x0a, 0x02, 0x04, 0x0a, 0x0c, 0x04, 0x0b,
+    0x01, 0x04, 0x0b, 0x0d, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x0d, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0d,
+    0x04, 0x0e, 0x01, 0x04, 0x0e, 0x0e, 0x03, 0x0f, 0x01, 0x04, 0x0f, 0x0e, 0x03, 0x10, 0x01, 0x04,
+    0x10, 0x0e, 0x03, 0x11, 0x01, 0x04, 0x11, 0x0d, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0d, 0x04, 0x13,
+    0x02, 0x04, 0x13, 0x0c, 0x04, 0x14, 0x02, 0x05, 0x14, 0x0b, 0x05, 0x15, 0x03, 0x0c, 0x16, 0x04,
+    0x0a, 0x17, 0x06, 0x07, 0x06, 0x01, 0x0b, 0x07, 0x01, 0x0c, 0x08, 0x01, 0x0d, 0x09, 0x01, 0x04,
+    0x09, 0x0a, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0b, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x0b, 0x04, 0x0c,
+    0x01, 0x04, 0x0c, 0x0b, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0a, 0x04, 0x0e, 0x01, 0x0d, 0x0f, 0x01,
+    0x0c, 0x10, 0x01, 0x0a, 0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x04,
+    0x15, 0x01, 0x04, 0x16, 0x01, 0x04, 0x06, 0x07, 0x04, 0x07, 0x05, 0x08, 0x08, 0x03, 0x0c, 0x09,
+    0x03, 0x0d, 0x0a, 0x02, 0x04, 0x0a, 0x0c, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x0d, 0x04, 0x0c, 0x01,
+    0x04, 0x0c, 0x0d, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0d, 0x04, 0x0e, 0x01, 0x04, 0x0e, 0x0e, 0x03,
+    0x0f, 0x01, 0x04, 0x0f, 0x0e, 0x03, 0x10, 0x01, 0x04, 0x10, 0x0e, 0x03, 0x11, 0x01, 0x04, 0x11,
+    0x0d, 0x04, 0x12, 0x01, 0x04, 0x12, 0x08, 0x03, 0x12, 0x0d, 0x04, 0x13, 0x02, 0x04, 0x13, 0x09,
+    0x07, 0x14, 0x02, 0x05, 0x14, 0x0a, 0x06, 0x15, 0x03, 0x0c, 0x16, 0x04, 0x0b, 0x17, 0x06, 0x09,
+    0x06, 0x01, 0x0b, 0x07, 0x01, 0x0c, 0x08, 0x01, 0x0d, 0x09, 0x01, 0x04, 0x09, 0x0a, 0x04, 0x0a,
+    0x01, 0x04, 0x0a, 0x0b, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x0b, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x0b,
+    0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0a, 0x04, 0x0e, 0x01, 0x0d, 0x0f, 0x01, 0x0c, 0x10, 0x01, 0x0b,
+    0x11, 0x01, 0x04, 0x11, 0x08, 0x04, 0x12, 0x01, 0x04, 0x12, 0x09, 0x04, 0x13, 0x01, 0x04, 0x13,
+    0x09, 0x04, 0x14, 0x01, 0x04, 0x14, 0x0a, 0x04, 0x15, 0x01, 0x04, 0x15, 0x0a, 0x04, 0x16, 0x01,
+    0x04, 0x16, 0x0b, 0x04, 0x06, 0x06, 0x04, 0x07, 0x03, 0x09, 0x08, 0x02, 0x0b, 0x09, 0x02, 0x05,
+    0x09, 0x09, 0x05, 0x0a, 0x01, 0x04, 0x0a, 0x0b, 0x03, 0x0b, 0x01, 0x04, 0x0b, 0x0b, 0x03, 0x0c,
+    0x01, 0x04, 0x0d, 0x02, 0x06, 0x0e, 0x02, 0x09, 0x0f, 0x04, 0x09, 0x10, 0x07, 0x07, 0x11, 0x0a,
+    0x05, 0x12, 0x01, 0x03, 0x12, 0x0b, 0x04, 0x13, 0x01, 0x04, 0x13, 0x0b, 0x04, 0x14, 0x01, 0x04,
+    0x14, 0x0a, 0x05, 0x15, 0x02, 0x0c, 0x16, 0x02, 0x0b, 0x17, 0x04, 0x08, 0x06, 0x01, 0x0e, 0x07,
+    0x01, 0x0e, 0x08, 0x01, 0x0e, 0x09, 0x06, 0x04, 0x0a, 0x06, 0x04, 0x0b, 0x06, 0x04, 0x0c, 0x06,
+    0x04, 0x0d, 0x06, 0x04, 0x0e, 0x06, 0x04, 0x0f, 0x06, 0x04, 0x10, 0x06, 0x04, 0x11, 0x06, 0x04,
+    0x12, 0x06, 0x04, 0x13, 0x06, 0x04, 0x14, 0x06, 0x04, 0x15, 0x06, 0x04, 0x16, 0x06, 0x04, 0x06,
+    0x01, 0x04, 0x06, 0x0c, 0x04, 0x07, 0x01, 0x04, 0x07, 0x0c, 0x04, 0x08, 0x01, 0x04, 0x08, 0x0c,
+    0x04, 0x09, 0x01, 0x04, 0x09, 0x0c, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x0c, 0x04, 0x0b, 0x01, 0x04,
+    0x0b, 0x0c, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x0c, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x0c, 0x04, 0x0e,
+    0x01, 0x04, 0x0e, 0x0c, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x0c, 0x04, 0x10, 0x01, 0x04, 0x10, 0x0c,
+    0x04, 0x11, 0x01, 0x04, 0x11, 0x0c, 0x04, 0x12, 0x02, 0x03, 0x12, 0x0c, 0x04, 0x13, 0x02, 0x04,
+    0x13, 0x0b, 0x04, 0x14, 0x02, 0x0d, 0x15, 0x03, 0x0b, 0x16, 0x05, 0x07, 0x06, 0x00, 0x05, 0x06,
+    0x0d, 0x04, 0x07, 0x01, 0x04, 0x07, 0x0d, 0x03, 0x08, 0x01, 0x04, 0x08, 0x0c, 0x04, 0x09, 0x02,
+    0x04, 0x09, 0x0c, 0x04, 0x0a, 0x02, 0x04, 0x0a, 0x0c, 0x03, 0x0b, 0x02, 0x04, 0x0b, 0x0b, 0x04,
+    0x0c, 0x03, 0x04, 0x0c, 0x0b, 0x04, 0x0d, 0x03, 0x04, 0x0d, 0x0b, 0x03, 0x0e, 0x03, 0x04, 0x0e,
+    0x0a, 0x04, 0x0f, 0x04, 0x04, 0x0f, 0x0a, 0x04, 0x10, 0x04, 0x04, 0x10, 0x0a, 0x03, 0x11, 0x05,
+    0x03, 0x11, 0x09, 0x04, 0x12, 0x05, 0x03, 0x12, 0x09, 0x04, 0x13, 0x05, 0x07, 0x14, 0x06, 0x06,
+    0x15, 0x06, 0x06, 0x16, 0x06, 0x05, 0x06, 0x00, 0x04, 0x06, 0x0a, 0x04, 0x06, 0x14, 0x04, 0x07,
+    0x01, 0x04, 0x07, 0x0a, 0x05, 0x07, 0x14, 0x04, 0x08, 0x01, 0x04, 0x08, 0x0a, 0x05, 0x08, 0x13,
+    0x04, 0x09, 0x01, 0x04, 0x09, 0x09, 0x06, 0x09, 0x13, 0x04, 0x0a, 0x02, 0x03, 0x0a, 0x09, 0x06,
+    0x0a, 0x13, 0x04, 0x0b, 0x02, 0x04, 0x0b, 0x09, 0x07, 0x0b, 0x13, 0x03, 0x0c, 0x02, 0x04, 0x0c,
+    0x09, 0x03, 0x0c, 0x0d, 0x03, 0x0c, 0x13, 0x03, 0x0d, 0x02, 0x04, 0x0d, 0x08, 0x04, 0x0d, 0x0d,
+    0x03, 0x0d, 0x12, 0x04, 0x0e, 0x03, 0x03, 0x0e, 0x08, 0x03, 0x0e, 0x0d, 0x03, 0x0e, 0x12, 0x04,
+    0x0f, 0x03, 0x04, 0x0f, 0x08, 0x03, 0x0f, 0x0d, 0x03, 0x0f, 0x12, 0x03, 0x10, 0x03, 0x04, 0x10,
+    0x08, 0x03, 0x10, 0x0e, 0x03, 0x10, 0x12, 0x03, 0x11, 0x04, 0x07, 0x11, 0x0e, 0x07, 0x12, 0x04,
+    0x06, 0x12, 0x0e, 0x07, 0x13, 0x04, 0x06, 0x13, 0x0e, 0x06, 0x14, 0x04, 0x06, 0x14, 0x0f, 0x05,
+    0x15, 0x05, 0x04, 0x15, 0x0f, 0x05, 0x16, 0x05, 0x04, 0x16, 0x0f, 0x04, 0x06, 0x01, 0x05, 0x06,
+    0x0c, 0x04, 0x07, 0x02, 0x04, 0x07, 0x0b, 0x04, 0x08, 0x03, 0x04, 0x08, 0x0a, 0x04, 0x09, 0x04,
+    0x04, 0x09, 0x0a, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x09, 0x04, 0x0b, 0x05, 0x07, 0x0c, 0x06, 0x06,
+    0x0d, 0x06, 0x05, 0x0e, 0x06, 0x05, 0x0f, 0x06, 0x06, 0x10, 0x05, 0x07, 0x11, 0x04, 0x04, 0x11,
+    0x09, 0x04, 0x12, 0x03, 0x05, 0x12, 0x0a, 0x04, 0x13, 0x03, 0x04, 0x13, 0x0a, 0x04, 0x14, 0x02,
+    0x04, 0x14, 0x0b, 0x04, 0x15, 0x01, 0x04, 0x15, 0x0c, 0x04, 0x16, 0x00, 0x05, 0x16, 0x0c, 0x05,
+    0x06, 0x00, 0x05, 0x06, 0x0c, 0x05, 0x07, 0x01, 0x05, 0x07, 0x0b, 0x05, 0x08, 0x02, 0x04, 0x08,
+    0x0b, 0x04, 0x09, 0x03, 0x04, 0x09, 0x0a, 0x04, 0x0a, 0x03, 0x04, 0x0a, 0x0a, 0x04, 0x0b, 0x04,
+    0x04, 0x0b, 0x09, 0x04, 0x0c, 0x04, 0x04, 0x0c, 0x09, 0x04, 0x0d, 0x05, 0x07, 0x0e, 0x06, 0x05,
+    0x0f, 0x06, 0x05, 0x10, 0x07, 0x03, 0x11, 0x07, 0x03, 0x12, 0x07, 0x03, 0x13, 0x07, 0x03, 0x14,
+    0x07, 0x03, 0x15, 0x07, 0x03, 0x16, 0x07, 0x03, 0x06, 0x01, 0x0e, 0x07, 0x01, 0x0e, 0x08, 0x01,
+    0x0d, 0x09, 0x09, 0x04, 0x0a, 0x09, 0x04, 0x0b, 0x08, 0x04, 0x0c, 0x07, 0x04, 0x0d, 0x06, 0x04,
+    0x0e, 0x06, 0x04, 0x0f, 0x05, 0x04, 0x10, 0x04, 0x04, 0x11, 0x03, 0x04, 0x12, 0x02, 0x05, 0x13,
+    0x02, 0x04, 0x14, 0x01, 0x0e, 0x15, 0x01, 0x0e, 0x16, 0x01, 0x0e, 0x05, 0x02, 0x05, 0x06, 0x02,
+    0x05, 0x07, 0x02, 0x03, 0x08, 0x02, 0x03, 0x09, 0x02, 0x03, 0x0a, 0x02, 0x03, 0x0b, 0x02, 0x03,
+    0x0c, 0x02, 0x03, 0x0d, 0x02, 0x03, 0x0e, 0x02, 0x03, 0x0f, 0x02, 0x03, 0x10, 0x02, 0x03, 0x11,
+    0x02, 0x03, 0x12, 0x02, 0x03, 0x13, 0x02, 0x03, 0x14, 0x02, 0x03, 0x15, 0x02, 0x03, 0x16, 0x02,
+    0x03, 0x17, 0x02, 0x03, 0x05, 0x00, 0x03, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x08, 0x01, 0x03,
+    0x09, 0x01, 0x03, 0x0a, 0x02, 0x03, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x03, 0x0d, 0x03, 0x03, 0x0e,
+    0x03, 0x03, 0x0f, 0x03, 0x03, 0x10, 0x03, 0x03, 0x11, 0x04, 0x03, 0x12, 0x04, 0x03, 0x13, 0x04,
+    0x03, 0x14, 0x04, 0x03, 0x15, 0x05, 0x03, 0x16, 0x05, 0x03, 0x17, 0x05, 0x03, 0x05, 0x01, 0x06,
+    0x06, 0x01, 0x06, 0x07, 0x03, 0x04, 0x08, 0x03, 0x04, 0x09, 0x03, 0x04, 0x0a, 0x03, 0x04, 0x0b,
+    0x03, 0x04, 0x0c, 0x03, 0x04, 0x0d, 0x03, 0x04, 0x0e, 0x03, 0x04, 0x0f, 0x03, 0x04, 0x10, 0x03,
+    0x04, 0x11, 0x03, 0x04, 0x12, 0x03, 0x04, 0x13, 0x03, 0x04, 0x14, 0x03, 0x04, 0x15, 0x03, 0x04,
+    0x16, 0x03, 0x04, 0x17, 0x03, 0x04, 0x06, 0x04, 0x03, 0x07, 0x03, 0x05, 0x08, 0x03, 0x05, 0x09,
+    0x03, 0x02, 0x09, 0x06, 0x03, 0x0a, 0x02, 0x03, 0x0a, 0x07, 0x02, 0x0b, 0x02, 0x02, 0x0b, 0x07,
+    0x03, 0x0c, 0x01, 0x03, 0x0c, 0x08, 0x03, 0x06, 0x01, 0x04, 0x07, 0x02, 0x03, 0x08, 0x03, 0x03,
+    0x09, 0x04, 0x02, 0x0b, 0x04, 0x05, 0x0c, 0x02, 0x09, 0x0d, 0x02, 0x0a, 0x0e, 0x01, 0x04, 0x0e,
+    0x09, 0x03, 0x0f, 0x09, 0x03, 0x10, 0x06, 0x06, 0x11, 0x02, 0x0a, 0x12, 0x01, 0x06, 0x12, 0x09,
+    0x03, 0x13, 0x01, 0x03, 0x13, 0x09, 0x03, 0x14, 0x01, 0x03, 0x14, 0x09, 0x03, 0x15, 0x01, 0x04,
+    0x15, 0x07, 0x05, 0x16, 0x01, 0x0b, 0x17, 0x02, 0x06, 0x17, 0x09, 0x03, 0x06, 0x01, 0x04, 0x07,
+    0x01, 0x04, 0x08, 0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x07, 0x04, 0x0b, 0x01,
+    0x0b, 0x0c, 0x01, 0x0c, 0x0d, 0x01, 0x05, 0x0d, 0x09, 0x04, 0x0e, 0x01, 0x04, 0x0e, 0x0a, 0x04,
+    0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x04, 0x10, 0x01, 0x04, 0x10, 0x0a, 0x04, 0x11, 0x01, 0x04, 0x11,
+    0x0a, 0x04, 0x12, 0x01, 0x04, 0x12, 0x0a, 0x04, 0x13, 0x01, 0x05, 0x13, 0x0a, 0x03, 0x14, 0x01,
+    0x0c, 0x15, 0x01, 0x0b, 0x16, 0x01, 0x04, 0x16, 0x06, 0x05, 0x0b, 0x05, 0x05, 0x0c, 0x03, 0x08,
+    0x0d, 0x02, 0x0a, 0x0e, 0x01, 0x04, 0x0e, 0x09, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x09, 0x04, 0x10,
+    0x01, 0x03, 0x11, 0x01, 0x03, 0x12, 0x01, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x02, 0x14, 0x01,
+    0x04, 0x14, 0x09, 0x04, 0x15, 0x02, 0x0a, 0x16, 0x03, 0x09, 0x17, 0x04, 0x06, 0x06, 0x0a, 0x03,
+    0x07, 0x0a, 0x03, 0x08, 0x0a, 0x03, 0x09, 0x0a, 0x03, 0x0a, 0x04, 0x04, 0x0a, 0x0a, 0x03, 0x0b,
+    0x03, 0x06, 0x0b, 0x0a, 0x03, 0x0c, 0x02, 0x0b, 0x0d, 0x01, 0x04, 0x0d, 0x09, 0x04, 0x0e, 0x01,
+    0x04, 0x0e, 0x0a, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x0a, 0x03, 0x10, 0x01, 0x03, 0x10, 0x0a, 0x03,
+    0x11, 0x01, 0x03, 0x11, 0x0a, 0x03, 0x12, 0x01, 0x04, 0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13,
+    0x09, 0x04, 0x14, 0x02, 0x0b, 0x15, 0x02, 0x0b, 0x16, 0x03, 0x06, 0x16, 0x0a, 0x03, 0x0b, 0x05,
+    0x04, 0x0c, 0x03, 0x08, 0x0d, 0x02, 0x0a, 0x0e, 0x01, 0x04, 0x0e, 0x09, 0x03, 0x0f, 0x01, 0x03,
+    0x0f, 0x0a, 0x03, 0x10, 0x01, 0x0c, 0x11, 0x01, 0x0c, 0x12, 0x01, 0x0c, 0x13, 0x01, 0x03, 0x14,
+    0x01, 0x04, 0x14, 0x0a, 0x03, 0x15, 0x02, 0x05, 0x15, 0x08, 0x05, 0x16, 0x03, 0x09, 0x17, 0x04,
+    0x06, 0x06, 0x05, 0x04, 0x07, 0x03, 0x06, 0x08, 0x03, 0x06, 0x09, 0x02, 0x04, 0x0a, 0x02, 0x04,
+    0x0b, 0x00, 0x09, 0x0c, 0x00, 0x09, 0x0d, 0x00, 0x09, 0x0e, 0x02, 0x04, 0x0f, 0x02, 0x04, 0x10,
+    0x02, 0x04, 0x11, 0x02, 0x04, 0x12, 0x02, 0x04, 0x13, 0x02, 0x04, 0x14, 0x02, 0x04, 0x15, 0x02,
+    0x04, 0x16, 0x02, 0x04, 0x17, 0x02, 0x04, 0x0b, 0x04, 0x04, 0x0b, 0x0a, 0x03, 0x0c, 0x03, 0x06,
+    0x0c, 0x0a, 0x03, 0x0d, 0x02, 0x0b, 0x0e, 0x01, 0x04, 0x0e, 0x09, 0x04, 0x0f, 0x01, 0x04, 0x0f,
+    0x0a, 0x03, 0x10, 0x01, 0x03, 0x10, 0x0a, 0x03, 0x11, 0x01, 0x03, 0x11, 0x0a, 0x03, 0x12, 0x01,
+    0x03, 0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x03, 0x14, 0x01, 0x04, 0x14, 0x09, 0x04,
+    0x15, 0x02, 0x0b, 0x16, 0x03, 0x06, 0x16, 0x0a, 0x03, 0x17, 0x04, 0x04, 0x17, 0x0a, 0x03, 0x06,
+    0x01, 0x04, 0x07, 0x01, 0x04, 0x08, 0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x07,
+    0x04, 0x0b, 0x01, 0x0b, 0x0c, 0x01, 0x0c, 0x0d, 0x01, 0x05, 0x0d, 0x09, 0x04, 0x0e, 0x01, 0x04,
+    0x0e, 0x09, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x03, 0x10, 0x01, 0x04, 0x10, 0x0a, 0x03, 0x11,
+    0x01, 0x04, 0x11, 0x0a, 0x03, 0x12, 0x01, 0x04, 0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a,
+    0x03, 0x14, 0x01, 0x04, 0x14, 0x0a, 0x03, 0x15, 0x01, 0x04, 0x15, 0x0a, 0x03, 0x16, 0x01, 0x04,
+    0x16, 0x0a, 0x03, 0x06, 0x02, 0x02, 0x07, 0x01, 0x04, 0x08, 0x01, 0x04, 0x09, 0x02, 0x02, 0x0b,
+    0x01, 0x04, 0x0c, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x10, 0x01,
+    0x04, 0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x04, 0x15, 0x01, 0x04,
+    0x16, 0x01, 0x04, 0x17, 0x01, 0x04, 0x06, 0x03, 0x02, 0x07, 0x02, 0x04, 0x08, 0x02, 0x04, 0x09,
+    0x03, 0x02, 0x0b, 0x02, 0x04, 0x0c, 0x02, 0x04, 0x0d, 0x02, 0x04, 0x0e, 0x02, 0x04, 0x0f, 0x02,
+    0x04, 0x10, 0x02, 0x04, 0x11, 0x02, 0x04, 0x12, 0x02, 0x04, 0x13, 0x02, 0x04, 0x14, 0x02, 0x04,
+    0x15, 0x02, 0x04, 0x16, 0x02, 0x04, 0x17, 0x02, 0x04, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x08,
+    0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0a, 0x09, 0x04, 0x0b, 0x01, 0x04, 0x0b, 0x08,
+    0x04, 0x0c, 0x01, 0x04, 0x0c, 0x07, 0x04, 0x0d, 0x01, 0x04, 0x0d, 0x06, 0x05, 0x0e, 0x01, 0x04,
+    0x0e, 0x06, 0x04, 0x0f, 0x01, 0x08, 0x10, 0x01, 0x08, 0x11, 0x01, 0x09, 0x12, 0x01, 0x04, 0x12,
+    0x06, 0x04, 0x13, 0x01, 0x04, 0x13, 0x07, 0x04, 0x14, 0x01, 0x04, 0x14, 0x08, 0x04, 0x15, 0x01,
+    0x04, 0x15, 0x08, 0x04, 0x16, 0x01, 0x04, 0x16, 0x09, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04,
+    0x08, 0x01, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x01, 0x04, 0x0b, 0x01, 0x04, 0x0c, 0x01, 0x04, 0x0d,
+    0x01, 0x04, 0x0e, 0x01, 0x04, 0x0f, 0x01, 0x04, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04, 0x12, 0x01,
+    0x04, 0x13, 0x01, 0x04, 0x14, 0x01, 0x04, 0x15, 0x01, 0x04, 0x16, 0x01, 0x04, 0x0b, 0x01, 0x04,
+    0x0b, 0x07, 0x03, 0x0b, 0x0e, 0x04, 0x0c, 0x01, 0x0a, 0x0c, 0x0d, 0x06, 0x0d, 0x01, 0x13, 0x0e,
+    0x01, 0x05, 0x0e, 0x08, 0x05, 0x0e, 0x10, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x09, 0x04, 0x0f, 0x11,
+    0x03, 0x10, 0x01, 0x04, 0x10, 0x09, 0x03, 0x10, 0x11, 0x03, 0x11, 0x01, 0x04, 0x11, 0x09, 0x03,
+    0x11, 0x11, 0x03, 0x12, 0x01, 0x04, 0x12, 0x09, 0x03, 0x12, 0x11, 0x03, 0x13, 0x01, 0x04, 0x13,
+    0x09, 0x03, 0x13, 0x11, 0x03, 0x14, 0x01, 0x04, 0x14, 0x09, 0x03, 0x14, 0x11, 0x03, 0x15, 0x01,
+    0x04, 0x15, 0x09, 0x03, 0x15, 0x11, 0x03, 0x16, 0x01, 0x04, 0x16, 0x09, 0x03, 0x16, 0x11, 0x03,
+    0x17, 0x01, 0x04, 0x17, 0x09, 0x03, 0x17, 0x11, 0x03, 0x0b, 0x01, 0x04, 0x0b, 0x07, 0x04, 0x0c,
+    0x01, 0x0b, 0x0d, 0x01, 0x0c, 0x0e, 0x01, 0x05, 0x0e, 0x09, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x09,
+    0x04, 0x10, 0x01, 0x04, 0x10, 0x0a, 0x03, 0x11, 0x01, 0x04, 0x11, 0x0a, 0x03, 0x12, 0x01, 0x04,
+    0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x03, 0x14, 0x01, 0x04, 0x14, 0x0a, 0x03, 0x15,
+    0x01, 0x04, 0x15, 0x0a, 0x03, 0x16, 0x01, 0x04, 0x16, 0x0a, 0x03, 0x17, 0x01, 0x04, 0x17, 0x0a,
+    0x03, 0x0b, 0x05, 0x05, 0x0c, 0x03, 0x08, 0x0d, 0x02, 0x0a, 0x0e, 0x01, 0x04, 0x0e, 0x09, 0x04,
+    0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x03, 0x10, 0x01, 0x03, 0x10, 0x0a, 0x03, 0x11, 0x01, 0x03, 0x11,
+    0x0a, 0x03, 0x12, 0x01, 0x03, 0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x03, 0x14, 0x01,
+    0x04, 0x14, 0x09, 0x04, 0x15, 0x02, 0x0a, 0x16, 0x03, 0x09, 0x17, 0x04, 0x06, 0x0b, 0x01, 0x04,
+    0x0b, 0x07, 0x04, 0x0c, 0x01, 0x0b, 0x0d, 0x01, 0x0c, 0x0e, 0x01, 0x05, 0x0e, 0x09, 0x04, 0x0f,
+    0x01, 0x04, 0x0f, 0x0a, 0x04, 0x10, 0x01, 0x04, 0x10, 0x0a, 0x04, 0x11, 0x01, 0x04, 0x11, 0x0a,
+    0x04, 0x12, 0x01, 0x04, 0x12, 0x0a, 0x04, 0x13, 0x01, 0x04, 0x13, 0x0a, 0x04, 0x14, 0x01, 0x05,
+    0x14, 0x0a, 0x03, 0x15, 0x01, 0x0c, 0x16, 0x01, 0x0b, 0x17, 0x01, 0x04, 0x17, 0x06, 0x05, 0x0b,
+    0x04, 0x04, 0x0b, 0x0a, 0x03, 0x0c, 0x03, 0x06, 0x0c, 0x0a, 0x03, 0x0d, 0x02, 0x0b, 0x0e, 0x01,
+    0x04, 0x0e, 0x09, 0x04, 0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x03, 0x10, 0x01, 0x03, 0x10, 0x0a, 0x03,
+    0x11, 0x01, 0x03, 0x11, 0x0a, 0x03, 0x12, 0x01, 0x03, 0x12, 0x0a, 0x03, 0x13, 0x01, 0x04, 0x13,
+    0x0a, 0x03, 0x14, 0x01, 0x04, 0x14, 0x09, 0x04, 0x15, 0x02, 0x0b, 0x16, 0x02, 0x0b, 0x17, 0x03,
+    0x06, 0x17, 0x0a, 0x03, 0x0b, 0x01, 0x04, 0x0b, 0x06, 0x03, 0x0c, 0x01, 0x08, 0x0d, 0x01, 0x08,
+    0x0e, 0x01, 0x05, 0x0f, 0x01, 0x04, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13,
+    0x01, 0x04, 0x14, 0x01, 0x04, 0x15, 0x01, 0x04, 0x16, 0x01, 0x04, 0x17, 0x01, 0x04, 0x0b, 0x04,
+    0x05, 0x0c, 0x02, 0x09, 0x0d, 0x01, 0x0a, 0x0e, 0x01, 0x04, 0x0e, 0x08, 0x04, 0x0f, 0x01, 0x04,
+    0x10, 0x01, 0x07, 0x11, 0x02, 0x09, 0x12, 0x04, 0x08, 0x13, 0x08, 0x04, 0x14, 0x01, 0x03, 0x14,
+    0x09, 0x03, 0x15, 0x01, 0x05, 0x15, 0x08, 0x04, 0x16, 0x02, 0x09, 0x17, 0x03, 0x07, 0x08, 0x02,
+    0x04, 0x09, 0x02, 0x04, 0x0a, 0x02, 0x04, 0x0b, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x0d, 0x00, 0x08,
+    0x0e, 0x02, 0x04, 0x0f, 0x02, 0x04, 0x10, 0x02, 0x04, 0x11, 0x02, 0x04, 0x12, 0x02, 0x04, 0x13,
+    0x02, 0x04, 0x14, 0x02, 0x04, 0x15, 0x02, 0x06, 0x16, 0x03, 0x05, 0x17, 0x04, 0x04, 0x0b, 0x01,
+    0x04, 0x0b, 0x0a, 0x03, 0x0c, 0x01, 0x04, 0x0c, 0x0a, 0x03, 0x0d, 0x01, 0x04, 0x0d, 0x0a, 0x03,
+    0x0e, 0x01, 0x04, 0x0e, 0x0a, 0x03, 0x0f, 0x01, 0x04, 0x0f, 0x0a, 0x03, 0x10, 0x01, 0x04, 0x10,
+    0x0a, 0x03, 0x11, 0x01, 0x04, 0x11, 0x0a, 0x03, 0x12, 0x01, 0x04, 0x12, 0x0a, 0x03, 0x13, 0x01,
+    0x04, 0x13, 0x09, 0x04, 0x14, 0x01, 0x04, 0x14, 0x09, 0x04, 0x15, 0x02, 0x0b, 0x16, 0x02, 0x07,
+    0x16, 0x0a, 0x03, 0x17, 0x03, 0x05, 0x17, 0x0a, 0x03, 0x0b, 0x00, 0x04, 0x0b, 0x0a, 0x04, 0x0c,
+    0x01, 0x03, 0x0c, 0x0a, 0x03, 0x0d, 0x01, 0x04, 0x0d, 0x09, 0x04, 0x0e, 0x01, 0x04, 0x0e, 0x09,
+    0x03, 0x0f, 0x02, 0x03, 0x0f, 0x09, 0x03, 0x10, 0x02, 0x04, 0x10, 0x08, 0x04, 0x11, 0x03, 0x03,
+    0x11, 0x08, 0x03, 0x12, 0x03, 0x03, 0x12, 0x08, 0x03, 0x13, 0x03, 0x08, 0x14, 0x04, 0x06, 0x15,
+    0x04, 0x06, 0x16, 0x04, 0x05, 0x17, 0x05, 0x04, 0x0b, 0x00, 0x04, 0x0b, 0x08, 0x04, 0x0b, 0x10,
+    0x04, 0x0c, 0x01, 0x03, 0x0c, 0x08, 0x04, 0x0c, 0x10, 0x03, 0x0d, 0x01, 0x03, 0x0d, 0x08, 0x04,
+    0x0d, 0x0f, 0x04, 0x0e, 0x01, 0x04, 0x0e, 0x08, 0x04, 0x0e, 0x0f, 0x04, 0x0f, 0x02, 0x03, 0x0f,
+    0x07, 0x06, 0x0f, 0x0f, 0x03, 0x10, 0x02, 0x03, 0x10, 0x07, 0x06, 0x10, 0x0f, 0x03, 0x11, 0x02,
+    0x03, 0x11, 0x07, 0x06, 0x11, 0x0f, 0x03, 0x12, 0x02, 0x04, 0x12, 0x07, 0x02, 0x12, 0x0b, 0x02,
+    0x12, 0x0e, 0x04, 0x13, 0x03, 0x06, 0x13, 0x0b, 0x06, 0x14, 0x03, 0x06, 0x14, 0x0b, 0x06, 0x15,
+    0x03, 0x05, 0x15, 0x0c, 0x05, 0x16, 0x04, 0x04, 0x16, 0x0c, 0x04, 0x17, 0x04, 0x04, 0x17, 0x0c,
+    0x04, 0x0b, 0x01, 0x03, 0x0b, 0x09, 0x04, 0x0c, 0x01, 0x04, 0x0c, 0x08, 0x04, 0x0d, 0x02, 0x04,
+    0x0d, 0x08, 0x03, 0x0e, 0x03, 0x03, 0x0e, 0x07, 0x04, 0x0f, 0x03, 0x07, 0x10, 0x04, 0x05, 0x11,
+    0x05, 0x04, 0x12, 0x04, 0x05, 0x13, 0x03, 0x07, 0x14, 0x03, 0x03, 0x14, 0x07, 0x04, 0x15, 0x02,
+    0x04, 0x15, 0x08, 0x03, 0x16, 0x01, 0x04, 0x16, 0x08, 0x04, 0x17, 0x00, 0x04, 0x17, 0x09, 0x04,
+    0x0b, 0x00, 0x04, 0x0b, 0x0a, 0x04, 0x0c, 0x01, 0x03, 0x0c, 0x0a, 0x03, 0x0d, 0x01, 0x04, 0x0d,
+    0x09, 0x04, 0x0e, 0x01, 0x04, 0x0e, 0x09, 0x03, 0x0f, 0x02, 0x03, 0x0f, 0x09, 0x03, 0x10, 0x02,
+    0x04, 0x10, 0x08, 0x04, 0x11, 0x03, 0x03, 0x11, 0x08, 0x03, 0x12, 0x03, 0x03, 0x12, 0x07, 0x04,
+    0x13, 0x03, 0x07, 0x14, 0x04, 0x06, 0x15, 0x04, 0x06, 0x16, 0x05, 0x04, 0x17, 0x05, 0x04, 0x0b,
+    0x01, 0x0b, 0x0c, 0x01, 0x0b, 0x0d, 0x01, 0x0b, 0x0e, 0x07, 0x04, 0x0f, 0x06, 0x04, 0x10, 0x06,
+    0x03, 0x11, 0x05, 0x04, 0x12, 0x04, 0x04, 0x13, 0x03, 0x04, 0x14, 0x02, 0x04, 0x15, 0x01, 0x0b,
+    0x16, 0x01, 0x0b, 0x17, 0x01, 0x0b, 0x05, 0x06, 0x04, 0x06, 0x05, 0x05, 0x07, 0x04, 0x04, 0x08,
+    0x04, 0x04, 0x09, 0x04, 0x03, 0x0a, 0x04, 0x03, 0x0b, 0x04, 0x03, 0x0c, 0x04, 0x03, 0x0d, 0x03,
+    0x04, 0x0e, 0x01, 0x06, 0x0f, 0x01, 0x04, 0x10, 0x01, 0x06, 0x11, 0x03, 0x04, 0x12, 0x04, 0x03,
+    0x13, 0x04, 0x03, 0x14, 0x04, 0x03, 0x15, 0x04, 0x03, 0x16, 0x04, 0x04, 0x17, 0x04, 0x05, 0x00,
+    0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x05, 0x03,
+    0x03, 0x06, 0x03, 0x03, 0x07, 0x03, 0x03, 0x08, 0x03, 0x03, 0x09, 0x03, 0x03, 0x0a, 0x03, 0x03,
+    0x0b, 0x03, 0x03, 0x0c, 0x03, 0x03, 0x0d, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x0f, 0x03, 0x03, 0x10,
+    0x03, 0x03, 0x11, 0x03, 0x03, 0x12, 0x03, 0x03, 0x13, 0x03, 0x03, 0x14, 0x03, 0x03, 0x15, 0x03,
+    0x03, 0x16, 0x03, 0x03, 0x17, 0x03, 0x03, 0x05, 0x01, 0x04, 0x06, 0x01, 0x05, 0x07, 0x02, 0x05,
+    0x08, 0x03, 0x04, 0x09, 0x03, 0x04, 0x0a, 0x03, 0x04, 0x0b, 0x03, 0x04, 0x0c, 0x03, 0x04, 0x0d,
+    0x04, 0x04, 0x0e, 0x04, 0x05, 0x0f, 0x06, 0x03, 0x10, 0x04, 0x05, 0x11, 0x04, 0x04, 0x12, 0x03,
+    0x04, 0x13, 0x03, 0x04, 0x14, 0x03, 0x04, 0x15, 0x03, 0x04, 0x16, 0x03, 0x04, 0x17, 0x02, 0x05,
+    0x0e, 0x04, 0x02, 0x0f, 0x03, 0x05, 0x0f, 0x0b, 0x03, 0x10, 0x02, 0x07, 0x10, 0x0b, 0x03, 0x11,
+    0x02, 0x03, 0x11, 0x07, 0x07, 0x12, 0x02, 0x02, 0x12, 0x08, 0x05, 0x13, 0x09, 0x03, 0x00, 0x00,
+};
+
+#endif /* AIC_GE_DEMO_FONT_EMBED */
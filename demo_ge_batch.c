@@ -0,0 +1,275 @@
+/*
+ * Filename: demo_ge_batch.c
+ * THE LEDGER OF COMMANDS
+ * 指令账簿
+ *
+ * 记账规则：
+ * 1. 每条指令按其在 GE 队列中的开销计入预算，自上次 sync 起累计超出预算前先 emit + sync。
+ * 2. 记录未完成指令触及的内存区间 (源与目标)，CPU 访问时据此判断是否需要等待。
+ * 3. 任何 sync 之后账簿清零，同步代数 gen 加一。
+ * 4. ge_fence 以 gen 判断 GE 是否已完成：移交 GE 之后发生过 sync 且无重叠的未完成指令，即视为完成。
+ */
+
+#include "demo_ge_batch.h"
+#include <string.h>
+
+/* 各类指令在 GE 队列中的开销 (Bytes) */
+#define GE_BATCH_CMD_FILL 64
+#define GE_BATCH_CMD_BLT  128
+#define GE_BATCH_CMD_ROT  128
+
+/* Cache 维护按行对齐 */
+#define GE_CACHE_LINE 64
+
+/* 未完成区间的记录上限，超出后合并为一个包络区间 */
+#define GE_BATCH_RANGES 8
+
+struct ge_range
+{
+    unsigned long start;
+    unsigned long end;
+};
+
+static struct
+{
+    int                   pending_bytes; /* 自上次 sync 起的指令字节 */
+    int                   queued;        /* 已入队但尚未 emit 的指令数 */
+    struct ge_range       range[GE_BATCH_RANGES];
+    int                   range_num;
+    uint32_t              gen; /* 同步代数 */
+    struct ge_batch_stats stats;
+} g_batch;
+
+/* --- 区间账簿 --- */
+
+static void batch_track(const struct mpp_buf *buf)
+{
+    if (buf->buf_type != MPP_PHY_ADDR || !buf->phy_addr[0])
+        return;
+
+    unsigned long start = buf->phy_addr[0];
+    unsigned long end   = start + (unsigned long)buf->stride[0] * buf->size.height;
+
+    /* 与已有区间相交或相邻则直接扩展 (同一缓冲通常被多次引用) */
+    for (int i = 0; i < g_batch.range_num; i++)
+    {
+        struct ge_range *r = &g_batch.range[i];
+        if (start <= r->end && end >= r->start)
+        {
+            r->start = MIN(r->start, start);
+            r->end   = MAX(r->end, end);
+            return;
+        }
+    }
+
+    if (g_batch.range_num == GE_BATCH_RANGES)
+    {
+        /* 记录已满：收缩为包络区间，宁可多等也不漏等 */
+        for (int i = 1; i < g_batch.range_num; i++)
+        {
+            g_batch.range[0].start = MIN(g_batch.range[0].start, g_batch.range[i].start);
+            g_batch.range[0].end   = MAX(g_batch.range[0].end, g_batch.range[i].end);
+        }
+        g_batch.range_num = 1;
+    }
+
+    g_batch.range[g_batch.range_num].start = start;
+    g_batch.range[g_batch.range_num].end   = end;
+    g_batch.range_num++;
+}
+
+static bool batch_overlaps(unsigned long start, unsigned long end)
+{
+    for (int i = 0; i < g_batch.range_num; i++)
+    {
+        if (start < g_batch.range[i].end && end > g_batch.range[i].start)
+            return true;
+    }
+    return false;
+}
+
+/* --- 队列预算 --- */
+
+static void batch_reserve(struct mpp_ge *ge, int cmd_size)
+{
+    if (g_batch.pending_bytes + cmd_size > AIC_GE_DEMO_GE_QUEUE_SIZE)
+    {
+        g_batch.stats.queue_syncs++;
+        ge_batch_sync(ge);
+    }
+    g_batch.pending_bytes += cmd_size;
+    g_batch.queued++;
+    g_batch.stats.ops++;
+}
+
+int ge_batch_fillrect(struct mpp_ge *ge, struct ge_fillrect *fill)
+{
+    batch_reserve(ge, GE_BATCH_CMD_FILL);
+    batch_track(&fill->dst_buf);
+    return mpp_ge_fillrect(ge, fill);
+}
+
+int ge_batch_bitblt(struct mpp_ge *ge, struct ge_bitblt *blt)
+{
+    batch_reserve(ge, GE_BATCH_CMD_BLT);
+    batch_track(&blt->src_buf);
+    batch_track(&blt->dst_buf);
+    return mpp_ge_bitblt(ge, blt);
+}
+
+int ge_batch_rotate(struct mpp_ge *ge, struct ge_rotation *rot)
+{
+    batch_reserve(ge, GE_BATCH_CMD_ROT);
+    batch_track(&rot->src_buf);
+    batch_track(&rot->dst_buf);
+    return mpp_ge_rotate(ge, rot);
+}
+
+/* --- 提交与同步 --- */
+
+void ge_batch_emit(struct mpp_ge *ge)
+{
+    if (!g_batch.queued)
+        return;
+    mpp_ge_emit(ge);
+    g_batch.queued = 0;
+    g_batch.stats.emits++;
+}
+
+void ge_batch_sync(struct mpp_ge *ge)
+{
+    ge_batch_emit(ge);
+    mpp_ge_sync(ge);
+    g_batch.pending_bytes = 0;
+    g_batch.range_num     = 0;
+    g_batch.gen++;
+    g_batch.stats.syncs++;
+}
+
+void ge_batch_cpu_access(struct mpp_ge *ge, const void *addr, size_t len)
+{
+    unsigned long start = (unsigned long)addr;
+    if (!batch_overlaps(start, start + len))
+    {
+        g_batch.stats.cpu_skipped++;
+        return;
+    }
+    g_batch.stats.cpu_syncs++;
+    ge_batch_sync(ge);
+}
+
+/* --- 缓冲所有权 --- */
+
+void ge_fence_init(struct ge_fence *f, void *vir, uint32_t size)
+{
+    memset(f, 0, sizeof(*f));
+    f->vir  = vir;
+    f->size = size;
+}
+
+enum ge_owner ge_fence_owner(const struct ge_fence *f)
+{
+    if (f->owner == GE_OWNER_CPU)
+        return GE_OWNER_CPU;
+
+    /* 移交后未发生过 sync (含未经批处理的裸 mpp_ge_* 指令)，或仍有重叠的批处理指令 */
+    unsigned long start = (unsigned long)f->vir;
+    if (f->gen == g_batch.gen || batch_overlaps(start, start + f->size))
+        return GE_OWNER_GE_PENDING;
+    return GE_OWNER_GE_DONE;
+}
+
+void ge_fence_ge_acquire(struct ge_fence *f, bool ge_write)
+{
+    if (f->dirty_hi > f->dirty_lo)
+    {
+        uint32_t lo = f->dirty_lo & ~(GE_CACHE_LINE - 1);
+        uint32_t hi = MIN((f->dirty_hi + GE_CACHE_LINE - 1) & ~(GE_CACHE_LINE - 1), f->size);
+        aicos_dcache_clean_range(f->vir + lo, hi - lo);
+        g_batch.stats.clean_bytes += hi - lo;
+        f->dirty_lo = 0;
+        f->dirty_hi = 0;
+    }
+
+    /* 仍未完成的写入不因本次只读移交而丢失 */
+    if (ge_fence_owner(f) != GE_OWNER_GE_PENDING)
+        f->ge_write = 0;
+    f->ge_write |= ge_write;
+    f->owner = GE_OWNER_GE_PENDING;
+    f->gen   = g_batch.gen;
+}
+
+void ge_fence_wait(struct mpp_ge *ge, struct ge_fence *f)
+{
+    if (ge_fence_owner(f) != GE_OWNER_GE_PENDING)
+    {
+        g_batch.stats.fence_skipped++;
+        return;
+    }
+    g_batch.stats.fence_syncs++;
+    ge_batch_sync(ge);
+}
+
+void ge_fence_cpu_acquire(struct mpp_ge *ge, struct ge_fence *f, uint32_t off, uint32_t len)
+{
+    if (f->owner == GE_OWNER_CPU)
+        return;
+
+    ge_fence_wait(ge, f);
+    if (f->ge_write && len)
+    {
+        uint32_t lo = off & ~(GE_CACHE_LINE - 1);
+        uint32_t hi = MIN((off + len + GE_CACHE_LINE - 1) & ~(GE_CACHE_LINE - 1), f->size);
+        aicos_dcache_invalid_range((unsigned long *)(f->vir + lo), hi - lo);
+        g_batch.stats.invalid_bytes += hi - lo;
+    }
+    f->owner    = GE_OWNER_CPU;
+    f->ge_write = 0;
+}
+
+void ge_fence_cpu_release(struct ge_fence *f, uint32_t off, uint32_t len)
+{
+    if (!len)
+        return;
+    if (f->dirty_hi <= f->dirty_lo)
+    {
+        f->dirty_lo = off;
+        f->dirty_hi = off + len;
+        return;
+    }
+    f->dirty_lo = MIN(f->dirty_lo, off);
+    f->dirty_hi = MAX(f->dirty_hi, off + len);
+}
+
+/* --- 统计 --- */
+
+void ge_batch_frame_end(void)
+{
+    g_batch.stats.frames++;
+}
+
+const struct ge_batch_stats *ge_batch_get_stats(void)
+{
+    return &g_batch.stats;
+}
+
+static int cmd_demo_ge(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        memset(&g_batch.stats, 0, sizeof(g_batch.stats));
+        return 0;
+    }
+
+    struct ge_batch_stats st = g_batch.stats;
+    uint32_t              n  = MAX(st.frames, 1);
+
+    rt_kprintf("--- GE batch (%u frames, budget %d B) ---\n", st.frames, AIC_GE_DEMO_GE_QUEUE_SIZE);
+    rt_kprintf("ops %u, emits %u, syncs %u (queue %u, cpu %u), cpu skipped %u\n", st.ops, st.emits, st.syncs,
+               st.queue_syncs, st.cpu_syncs, st.cpu_skipped);
+    rt_kprintf("fence: syncs %u, skipped %u\n", st.fence_syncs, st.fence_skipped);
+    rt_kprintf("per frame: syncs %u.%02u, clean %u B, invalidate %u B\n", st.syncs / n, (st.syncs % n) * 100 / n,
+               (uint32_t)(st.clean_bytes / n), (uint32_t)(st.invalid_bytes / n));
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_ge, demo_ge, Show GE batch counters : [reset]);
@@ -0,0 +1,97 @@
+/*
+ * Filename: demo_ge_batch.h
+ * THE LEDGER OF COMMANDS
+ * 指令账簿
+ *
+ * GE 指令批处理层：累积 fillrect / bitblt / rotate，按每条指令的队列开销记账，
+ * 在 GE 队列 (SPEC.md: 2KB / 4KB) 即将溢出前自动提交并等待，
+ * 其余时刻只在 CPU 需要访问 GE 未完成的内存区间时才同步。
+ *
+ * GE 按入队顺序执行指令，因此 "清理 -> 旋转 -> 缩放" 这类 GE 内部的前后依赖
+ * 无需在两条指令之间插入 sync；只有 CPU 读写才需要等待硬件落地。
+ *
+ * 缓冲所有权 (ge_fence)：CMA 缓冲在 CPU 与 GE 之间移交时才做 sync 与 Cache 维护，
+ * 且只覆盖实际触及的字节区间。
+ */
+
+#ifndef _DEMO_GE_BATCH_H_
+#define _DEMO_GE_BATCH_H_
+
+#include "demo_engine.h"
+
+/* 一次 sync 之间允许累积的指令字节 (保守取 2KB 队列) */
+#ifndef AIC_GE_DEMO_GE_QUEUE_SIZE
+#define AIC_GE_DEMO_GE_QUEUE_SIZE 2048
+#endif
+
+struct ge_batch_stats
+{
+    uint32_t frames;      /* ge_batch_frame_end 调用次数 */
+    uint32_t ops;         /* 经批处理提交的指令数 */
+    uint32_t emits;       /* mpp_ge_emit 次数 */
+    uint32_t syncs;       /* mpp_ge_sync 次数 (含下列两项) */
+    uint32_t queue_syncs; /* 队列预算耗尽导致的同步 */
+    uint32_t cpu_syncs;   /* CPU 访问未完成区间导致的同步 */
+    uint32_t cpu_skipped; /* CPU 访问无冲突、省略的同步 */
+
+    uint32_t fence_syncs;   /* 所有权移交时真正等待 GE 的次数 */
+    uint32_t fence_skipped; /* GE 已由其他同步完成、省略的等待 */
+    uint64_t clean_bytes;   /* ge_fence 执行 clean 的字节数 */
+    uint64_t invalid_bytes; /* ge_fence 执行 invalidate 的字节数 */
+};
+
+/* 缓冲所有者 */
+enum ge_owner
+{
+    GE_OWNER_CPU = 0,    /* CPU 可直接读写 */
+    GE_OWNER_GE_PENDING, /* 已交给 GE，指令可能尚未完成 */
+    GE_OWNER_GE_DONE,    /* GE 指令已完成，CPU 取回前无需等待 */
+};
+
+struct ge_fence
+{
+    uint8_t *vir;
+    uint32_t size;
+    uint8_t  owner;    /* GE_OWNER_CPU 或 GE_OWNER_GE_PENDING (DONE 由 gen 推导) */
+    uint8_t  ge_write; /* GE 是否写入，决定 CPU 取回时是否 invalidate */
+    uint32_t gen;      /* 移交 GE 时的同步代数 */
+    uint32_t dirty_lo; /* CPU 已写、尚未 clean 的区间 [lo, hi) */
+    uint32_t dirty_hi;
+};
+
+/* 入队 (必要时先自动 emit + sync 腾出队列) */
+int ge_batch_fillrect(struct mpp_ge *ge, struct ge_fillrect *fill);
+int ge_batch_bitblt(struct mpp_ge *ge, struct ge_bitblt *blt);
+int ge_batch_rotate(struct mpp_ge *ge, struct ge_rotation *rot);
+
+/* 提交已入队的指令，不等待 */
+void ge_batch_emit(struct mpp_ge *ge);
+
+/* 提交并等待 GE 全部完成 (也覆盖未经批处理、直接调用 mpp_ge_* 的指令) */
+void ge_batch_sync(struct mpp_ge *ge);
+
+/*
+ * CPU 即将读写 [addr, addr + len)：仅当区间与未完成的 GE 指令 (源或目标) 重叠时才同步。
+ * 本仓库的 CMA 缓冲虚拟地址与物理地址一致，直接按地址比较。
+ */
+void ge_batch_cpu_access(struct mpp_ge *ge, const void *addr, size_t len);
+
+/*
+ * 缓冲所有权：
+ * ge_acquire:  移交 GE，clean CPU 登记的脏区间。须紧挨在使用该缓冲的 GE 指令入队之前调用。
+ * cpu_acquire: 取回 CPU 访问 [off, off + len)，GE 尚未完成时等待；GE 写过则 invalidate 该区间。
+ * cpu_release: 登记 CPU 写过的区间，留待下次 ge_acquire 时 clean。
+ * wait:        仅等待 GE 完成 (如交给 DE 显示前)，不改变所有者。
+ */
+void          ge_fence_init(struct ge_fence *f, void *vir, uint32_t size);
+void          ge_fence_ge_acquire(struct ge_fence *f, bool ge_write);
+void          ge_fence_cpu_acquire(struct mpp_ge *ge, struct ge_fence *f, uint32_t off, uint32_t len);
+void          ge_fence_cpu_release(struct ge_fence *f, uint32_t off, uint32_t len);
+void          ge_fence_wait(struct mpp_ge *ge, struct ge_fence *f);
+enum ge_owner ge_fence_owner(const struct ge_fence *f);
+
+/* 帧统计 (由引擎在每帧结束时调用) */
+void                         ge_batch_frame_end(void);
+const struct ge_batch_stats *ge_batch_get_stats(void);
+
+#endif /* _DEMO_GE_BATCH_H_ */
@@ -0,0 +1,206 @@
+/*
+ * Filename: demo_lut.c
+ * THE ARCHIVE OF TABLES
+ * 查找表档案馆
+ *
+ * 文件格式：32 字节文件头 + 表数据。写入先落到临时文件再改名，
+ * 断电或写满时最多丢失缓存，不会留下一个通过校验的残缺文件。
+ */
+
+#include "demo_lut.h"
+#include "demo_perf.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define LUT_MAGIC   "GLUT"
+#define LUT_VERSION 1 /* 文件格式版本 */
+
+struct lut_file_hdr
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t param_hash;
+    uint32_t size;
+    uint32_t checksum;
+    uint32_t reserved[3];
+};
+
+static struct demo_lut_stats g_lut_stats;
+
+/* FNV-1a：参数按字节，表数据按 32 位字 (尾部不足一字的按字节) */
+static uint32_t lut_hash_bytes(uint32_t h, const uint8_t *p, size_t len)
+{
+    while (len--)
+    {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t lut_checksum(const void *buf, size_t size)
+{
+    const uint32_t *w = buf;
+    uint32_t        h = 2166136261u;
+
+    for (size_t n = size / 4; n; n--)
+    {
+        h ^= *w++;
+        h *= 16777619u;
+    }
+    return lut_hash_bytes(h, (const uint8_t *)w, size & 3);
+}
+
+#ifdef AIC_GE_DEMO_LUT_CACHE
+
+static void lut_path(char *path, size_t len, const char *name, const char *ext)
+{
+    snprintf(path, len, "%s/%s.%s", LUT_CACHE_DIR, name, ext);
+}
+
+/* 读取并校验缓存文件，成功返回 true；失败时 buf 内容不确定 */
+static bool lut_load(const char *name, uint32_t param_hash, void *buf, size_t size)
+{
+    char path[96];
+    lut_path(path, sizeof(path), name, "lut");
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        g_lut_stats.misses++;
+        return false;
+    }
+
+    struct lut_file_hdr hdr;
+    bool                ok = false;
+
+    if (read(fd, &hdr, sizeof(hdr)) != sizeof(hdr) || memcmp(hdr.magic, LUT_MAGIC, 4) != 0 ||
+        hdr.version != LUT_VERSION)
+    {
+        g_lut_stats.corrupt++;
+    }
+    else if (hdr.param_hash != param_hash || hdr.size != size)
+    {
+        g_lut_stats.stale++;
+    }
+    else if (read(fd, buf, size) != (ssize_t)size || lut_checksum(buf, size) != hdr.checksum)
+    {
+        g_lut_stats.corrupt++;
+    }
+    else
+    {
+        ok = true;
+    }
+
+    close(fd);
+    return ok;
+}
+
+static void lut_store(const char *name, uint32_t param_hash, const void *buf, size_t size)
+{
+    char tmp[96], path[96];
+    lut_path(tmp, sizeof(tmp), name, "tmp");
+    lut_path(path, sizeof(path), name, "lut");
+
+    /* 先建上一级 (字体内嵌时 /data/ge_demos 不再由安装步骤创建)，已存在时失败，忽略 */
+    char  dir[96];
+    char *slash;
+    snprintf(dir, sizeof(dir), "%s", LUT_CACHE_DIR);
+    slash = strrchr(dir, '/');
+    if (slash && slash != dir)
+    {
+        *slash = '\0';
+        mkdir(dir, 0755);
+    }
+    mkdir(LUT_CACHE_DIR, 0755);
+
+    struct lut_file_hdr hdr = {0};
+    memcpy(hdr.magic, LUT_MAGIC, 4);
+    hdr.version    = LUT_VERSION;
+    hdr.param_hash = param_hash;
+    hdr.size       = size;
+    hdr.checksum   = lut_checksum(buf, size);
+
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        g_lut_stats.write_errors++;
+        return;
+    }
+
+    bool ok = write(fd, &hdr, sizeof(hdr)) == sizeof(hdr) && write(fd, buf, size) == (ssize_t)size;
+    close(fd);
+
+    /* 先删除旧文件：部分文件系统的 rename 不覆盖已存在的目标 */
+    if (ok)
+    {
+        unlink(path);
+        ok = rename(tmp, path) == 0;
+    }
+    if (!ok)
+    {
+        unlink(tmp);
+        g_lut_stats.write_errors++;
+        rt_kprintf("Demo LUT: failed to write %s\n", path);
+        return;
+    }
+    g_lut_stats.writes++;
+}
+
+#endif /* AIC_GE_DEMO_LUT_CACHE */
+
+bool demo_lut_fetch(const char *name, const void *params, size_t params_len, void *buf, size_t size,
+                    demo_lut_build_t build)
+{
+    uint64_t t0         = demo_perf_now_us();
+    uint32_t param_hash = lut_hash_bytes(2166136261u, params, params_len);
+
+#ifdef AIC_GE_DEMO_LUT_CACHE
+    if (lut_load(name, param_hash, buf, size))
+    {
+        g_lut_stats.hits++;
+        g_lut_stats.load_us += demo_perf_now_us() - t0;
+        return true;
+    }
+#else
+    g_lut_stats.misses++;
+#endif
+
+    build(buf, size);
+    g_lut_stats.build_us += demo_perf_now_us() - t0;
+
+#ifdef AIC_GE_DEMO_LUT_CACHE
+    lut_store(name, param_hash, buf, size);
+#else
+    (void)param_hash;
+#endif
+    return false;
+}
+
+const struct demo_lut_stats *demo_lut_get_stats(void)
+{
+    return &g_lut_stats;
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_lut(int argc, char **argv)
+{
+    const struct demo_lut_stats *st    = &g_lut_stats;
+    uint32_t                     built = st->misses + st->stale + st->corrupt;
+
+#ifdef AIC_GE_DEMO_LUT_CACHE
+    rt_kprintf("--- LUT cache (%s) ---\n", LUT_CACHE_DIR);
+#else
+    rt_kprintf("--- LUT cache (disabled) ---\n");
+#endif
+    rt_kprintf("hits %u, misses %u, stale %u, corrupt %u\n", st->hits, st->misses, st->stale, st->corrupt);
+    rt_kprintf("writes %u, write errors %u\n", st->writes, st->write_errors);
+    rt_kprintf("avg load %u us, avg build %u us\n", st->hits ? (uint32_t)(st->load_us / st->hits) : 0,
+               built ? (uint32_t)(st->build_us / built) : 0);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_lut, demo_lut, Show LUT cache stats);
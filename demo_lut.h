@@ -0,0 +1,47 @@
+/*
+ * Filename: demo_lut.h
+ * THE ARCHIVE OF TABLES
+ * 查找表档案馆
+ *
+ * 持久化 LUT 缓存：确定性的纯 CPU 查找表 (极坐标、重映射、深度表) 首次构建后
+ * 写入 LUT_CACHE_DIR，之后的 prepare 以一次整块读取载入，省去逐像素的浮点运算。
+ * 文件头记录参数哈希、长度与校验和，任一不符即重新构建并覆盖。
+ */
+
+#ifndef _DEMO_LUT_H_
+#define _DEMO_LUT_H_
+
+#include "demo_engine.h"
+
+/* 缓存目录 (与字体资产同在 /data/ge_demos) */
+#ifndef LUT_CACHE_DIR
+#define LUT_CACHE_DIR "/data/ge_demos/lut"
+#endif
+
+struct demo_lut_stats
+{
+    uint32_t hits;         /* 由缓存载入 */
+    uint32_t misses;       /* 无缓存文件 */
+    uint32_t stale;        /* 参数或长度变化 */
+    uint32_t corrupt;      /* 读取不完整或校验失败 */
+    uint32_t writes;       /* 写入缓存文件 */
+    uint32_t write_errors; /* 写入失败 (只读文件系统、空间不足等) */
+    uint64_t load_us;      /* 命中时的载入耗时累计 */
+    uint64_t build_us;     /* 未命中时的构建耗时累计 */
+};
+
+/* 构建函数：向 buf 写满 size 字节 */
+typedef void (*demo_lut_build_t)(void *buf, size_t size);
+
+/*
+ * 以 name 为键载入一张查找表至 buf，缓存无效时调用 build 构建并写回。
+ * params 为影响表内容的全部参数 (含纹理尺寸)，按字节取哈希；
+ * 修改构建算法本身时须同时修改 params (如递增其中的版本号)。
+ * 返回 true 表示由缓存载入。可在预备线程中调用。
+ */
+bool demo_lut_fetch(const char *name, const void *params, size_t params_len, void *buf, size_t size,
+                    demo_lut_build_t build);
+
+const struct demo_lut_stats *demo_lut_get_stats(void);
+
+#endif /* _DEMO_LUT_H_ */
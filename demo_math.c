@@ -0,0 +1,91 @@
+/*
+ * Filename: demo_math.c
+ * THE TABLETS OF MEASURE
+ * 度量石板
+ *
+ * 查找表本身位于生成的 demo_math_tables.c；这里只有与 libm 对照的自检指令，
+ * 板上与主机 (./build/ge_demo_host demo_math) 均可运行。
+ */
+
+#include "demo_math.h"
+#include <math.h>
+
+/* --- 自检 --- */
+
+static int check_sin(const char *name, const int16_t *tab, int one, int tol)
+{
+    int max_err = 0;
+    for (int i = 0; i < DEMO_ANGLE_ONE; i++)
+    {
+        int ref = (int)lrint(sin(i * 2.0 * M_PI / DEMO_ANGLE_ONE) * one);
+        int err = ABS(tab[i] - ref);
+        max_err = MAX(max_err, err);
+    }
+    rt_kprintf("%-6s max err %d LSB (limit %d)\n", name, max_err, tol);
+    return max_err <= tol ? 0 : -1;
+}
+
+static int check_recip(void)
+{
+    int bad = 0;
+    for (uint32_t n = 1; n < 4 * DEMO_RECIP_SIZE; n++)
+    {
+        if (demo_recip_q16(n) != 65536u / n)
+            bad++;
+    }
+    rt_kprintf("recip  %d mismatches in [1, %d)\n", bad, 4 * DEMO_RECIP_SIZE);
+    return bad ? -1 : 0;
+}
+
+static int check_isqrt(void)
+{
+    int bad = 0;
+
+    /* 覆盖 QVGA / VGA 距离平方的全部取值，之后按几何步长抽样至 2^32 */
+    for (uint32_t x = 0; x < 640 * 640 + 480 * 480; x++)
+    {
+        if (demo_isqrt(x) != (uint32_t)sqrt((double)x))
+            bad++;
+    }
+    for (uint64_t x = 640 * 640; x < 0xFFFFFFFFull; x += x / 97 + 1)
+    {
+        if (demo_isqrt((uint32_t)x) != (uint32_t)sqrt((double)x))
+            bad++;
+    }
+    rt_kprintf("isqrt  %d mismatches\n", bad);
+    return bad ? -1 : 0;
+}
+
+static int check_atan2(void)
+{
+    int max_err = 0;
+    for (int y = -240; y <= 240; y++)
+    {
+        for (int x = -320; x <= 320; x++)
+        {
+            if (!x && !y)
+                continue;
+            double ref = atan2(y, x) * DEMO_ANGLE_ONE / (2.0 * M_PI);
+            int    err = (int)lrint(fabs(fmod(demo_atan2(y, x) - ref + 1.5 * DEMO_ANGLE_ONE, DEMO_ANGLE_ONE) -
+                                         DEMO_ANGLE_ONE / 2));
+            max_err = MAX(max_err, err);
+        }
+    }
+    rt_kprintf("atan2  max err %d / %d per turn (limit 1)\n", max_err, DEMO_ANGLE_ONE);
+    return max_err <= 1 ? 0 : -1;
+}
+
+static int cmd_demo_math(int argc, char **argv)
+{
+    int ret = 0;
+
+    rt_kprintf("--- Fixed-point math vs libm ---\n");
+    ret |= check_sin("sin12", demo_sin_q12_tab, 4096, 1);
+    ret |= check_sin("sin8", demo_sin_q8_tab, 256, 1);
+    ret |= check_recip();
+    ret |= check_isqrt();
+    ret |= check_atan2();
+    rt_kprintf("%s\n", ret ? "FAIL" : "PASS");
+    return ret;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_math, demo_math, Check fixed - point tables against libm);
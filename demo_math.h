@@ -0,0 +1,106 @@
+/*
+ * Filename: demo_math.h
+ * THE TABLETS OF MEASURE
+ * 度量石板
+ *
+ * 共享定点数学：正弦 / 余弦 (Q12、Q8)、倒数、整数平方根与八分圆 atan2。
+ * 查找表由 tools/gen_math_tables.py 生成于 demo_math_tables.c，以 const 放在只读段，
+ * 各特效不再在 init 中各自构建一份私有正弦表，逐像素的超越函数调用也改为查表。
+ *
+ * 角度单位：一整周 = DEMO_ANGLE_ONE (1024)，可直接与原有 10-bit 正弦表的索引互换；
+ * 512 点的私有表索引左移 1 位即可。
+ */
+
+#ifndef _DEMO_MATH_H_
+#define _DEMO_MATH_H_
+
+#include "demo_utils.h"
+#include <stdint.h>
+
+#define DEMO_ANGLE_ONE  1024
+#define DEMO_ANGLE_MASK (DEMO_ANGLE_ONE - 1)
+
+#define DEMO_RECIP_SIZE 1024 /* 倒数表覆盖 [1, 1024) */
+#define DEMO_SQRT_SIZE  1024 /* 平方根表的归一化区间 */
+#define DEMO_ATAN_SIZE  256  /* 八分圆内 tan 的分辨率 */
+
+/* 与原先 (int)(sinf(i * PI / 512.0f) * Q) 逐位一致 (向零截断) */
+extern const int16_t  demo_sin_q12_tab[DEMO_ANGLE_ONE];
+extern const int16_t  demo_sin_q8_tab[DEMO_ANGLE_ONE];
+extern const uint32_t demo_recip_q16_tab[DEMO_RECIP_SIZE]; /* 65536 / i，[0] 饱和为 65536 */
+extern const uint16_t demo_sqrt_q4_tab[DEMO_SQRT_SIZE];    /* floor(sqrt(i) * 16) */
+extern const uint8_t  demo_atan_tab[DEMO_ATAN_SIZE + 1];   /* atan(i / 256)，角度单位 */
+
+/* --- 正弦 / 余弦 --- */
+
+static inline int demo_sin_q12(int a)
+{
+    return demo_sin_q12_tab[a & DEMO_ANGLE_MASK];
+}
+
+static inline int demo_cos_q12(int a)
+{
+    return demo_sin_q12_tab[(a + DEMO_ANGLE_ONE / 4) & DEMO_ANGLE_MASK];
+}
+
+static inline int demo_sin_q8(int a)
+{
+    return demo_sin_q8_tab[a & DEMO_ANGLE_MASK];
+}
+
+static inline int demo_cos_q8(int a)
+{
+    return demo_sin_q8_tab[(a + DEMO_ANGLE_ONE / 4) & DEMO_ANGLE_MASK];
+}
+
+/* --- 倒数 (Q16)：n 在表内时为精确的 floor(65536 / n)，超出时退回除法 --- */
+
+static inline uint32_t demo_recip_q16(uint32_t n)
+{
+    return (n < DEMO_RECIP_SIZE) ? demo_recip_q16_tab[n] : 65536u / n;
+}
+
+/* --- 整数平方根：返回 floor(sqrt(x))，与 (int)sqrtf((float)x) 在 x < 2^24 时一致 --- */
+
+static inline uint32_t demo_isqrt(uint32_t x)
+{
+    if (x < DEMO_SQRT_SIZE)
+        return demo_sqrt_q4_tab[x] >> 4;
+
+    /* 以偶数位移把 x 归一化到表内，查表得到近似值后按整数修正 (通常 0~1 步) */
+    int s = 31 - __builtin_clz(x) - 9;
+    s     = (s + 1) & ~1;
+
+    uint64_t r = ((uint64_t)demo_sqrt_q4_tab[x >> s] << (s >> 1)) >> 4;
+    while (r * r > x)
+        r--;
+    while ((r + 1) * (r + 1) <= x)
+        r++;
+    return (uint32_t)r;
+}
+
+/* --- atan2：返回 [0, DEMO_ANGLE_ONE) 内的角度 (与 atan2f 同向，y 轴向下时为顺时针)，误差约 ±1 --- */
+
+static inline int demo_atan2(int y, int x)
+{
+    int ax = ABS(x);
+    int ay = ABS(y);
+    int a;
+
+    if (ax == 0 && ay == 0)
+        return 0;
+
+    /* 先在第一八分圆内查表，再按对称性展开到整周 */
+    if (ax >= ay)
+        a = demo_atan_tab[(ay * DEMO_ATAN_SIZE) / ax];
+    else
+        a = DEMO_ANGLE_ONE / 4 - demo_atan_tab[(ax * DEMO_ATAN_SIZE) / ay];
+
+    if (x < 0)
+        a = DEMO_ANGLE_ONE / 2 - a;
+    if (y < 0)
+        a = -a;
+    return a & DEMO_ANGLE_MASK;
+}
+
+#endif /* _DEMO_MATH_H_ */
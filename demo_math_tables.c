@@ -0,0 +1,317 @@
+/*
+ * Filename: demo_math_tables.c
+ * 由 tools/gen_math_tables.py 生成，请勿手工修改。
+ */
+
+#include "demo_math.h"
+
+const int16_t demo_sin_q12_tab[1024] = {
+    0, 25, 50, 75, 100, 125, 150, 175, 200, 226, 251, 276, 301, 326, 351, 376,
+    401, 426, 451, 476, 501, 526, 551, 576, 601, 625, 650, 675, 700, 725, 749, 774,
+    799, 823, 848, 872, 897, 921, 946, 970, 995, 1019, 1043, 1068, 1092, 1116, 1140, 1164,
+    1189, 1213, 1237, 1260, 1284, 1308, 1332, 1356, 1379, 1403, 1427, 1450, 1474, 1497, 1520, 1544,
+    1567, 1590, 1613, 1636, 1659, 1682, 1705, 1728, 1751, 1773, 1796, 1819, 1841, 1864, 1886, 1908,
+    1930, 1952, 1975, 1997, 2018, 2040, 2062, 2084, 2105, 2127, 2148, 2170, 2191, 2212, 2233, 2254,
+    2275, 2296, 2317, 2337, 2358, 2379, 2399, 2419, 2439, 2460, 2480, 2500, 2519, 2539, 2559, 2578,
+    2598, 2617, 2637, 2656, 2675, 2694, 2713, 2732, 2750, 2769, 2787, 2806, 2824, 2842, 2860, 2878,
+    2896, 2914, 2931, 2949, 2966, 2983, 3000, 3018, 3034, 3051, 3068, 3085, 3101, 3117, 3134, 3150,
+    3166, 3182, 3197, 3213, 3229, 3244, 3259, 3274, 3289, 3304, 3319, 3334, 3348, 3363, 3377, 3391,
+    3405, 3419, 3433, 3447, 3460, 3473, 3487, 3500, 3513, 3526, 3538, 3551, 3563, 3576, 3588, 3600,
+    3612, 3624, 3635, 3647, 3658, 3669, 3680, 3691, 3702, 3713, 3723, 3734, 3744, 3754, 3764, 3774,
+    3784, 3793, 3803, 3812, 3821, 3830, 3839, 3848, 3856, 3864, 3873, 3881, 3889, 3897, 3904, 3912,
+    3919, 3926, 3933, 3940, 3947, 3954, 3960, 3967, 3973, 3979, 3985, 3990, 3996, 4001, 4007, 4012,
+    4017, 4022, 4026, 4031, 4035, 4039, 4043, 4047, 4051, 4055, 4058, 4062, 4065, 4068, 4071, 4073,
+    4076, 4078, 4080, 4082, 4084, 4086, 4088, 4089, 4091, 4092, 4093, 4094, 4094, 4095, 4095, 4095,
+    4096, 4095, 4095, 4095, 4094, 4094, 4093, 4092, 4091, 4089, 4088, 4086, 4084, 4082, 4080, 4078,
+    4076, 4073, 4071, 4068, 4065, 4062, 4058, 4055, 4051, 4047, 4043, 4039, 4035, 4031, 4026, 4022,
+    4017, 4012, 4007, 4001, 3996, 3990, 3985, 3979, 3973, 3967, 3960, 3954, 3947, 3940, 3933, 3926,
+    3919, 3912, 3904, 3897, 3889, 3881, 3873, 3864, 3856, 3848, 3839, 3830, 3821, 3812, 3803, 3793,
+    3784, 3774, 3764, 3754, 3744, 3734, 3723, 3713, 3702, 3691, 3680, 3669, 3658, 3647, 3635, 3624,
+    3612, 3600, 3588, 3576, 3563, 3551, 3538, 3526, 3513, 3500, 3487, 3473, 3460, 3447, 3433, 3419,
+    3405, 3391, 3377, 3363, 3348, 3334, 3319, 3304, 3289, 3274, 3259, 3244, 3229, 3213, 3197, 3182,
+    3166, 3150, 3134, 3117, 3101, 3085, 3068, 3051, 3034, 3018, 3000, 2983, 2966, 2949, 2931, 2914,
+    2896, 2878, 2860, 2842, 2824, 2806, 2787, 2769, 2750, 2732, 2713, 2694, 2675, 2656, 2637, 2617,
+    2598, 2578, 2559, 2539, 2519, 2500, 2480, 2460, 2439, 2419, 2399, 2379, 2358, 2337, 2317, 2296,
+    2275, 2254, 2233, 2212, 2191, 2170, 2148, 2127, 2105, 2084, 2062, 2040, 2018, 1997, 1975, 1952,
+    1930, 1908, 1886, 1864, 1841, 1819, 1796, 1773, 1751, 1728, 1705, 1682, 1659, 1636, 1613, 1590,
+    1567, 1544, 1520, 1497, 1474, 1450, 1427, 1403, 1379, 1356, 1332, 1308, 1284, 1260, 1237, 1213,
+    1189, 1164, 1140, 1116, 1092, 1068, 1043, 1019, 995, 970, 946, 921, 897, 872, 848, 823,
+    799, 774, 749, 725, 700, 675, 650, 625, 601, 576, 551, 526, 501, 476, 451, 426,
+    401, 376, 351, 326, 301, 276, 251, 226, 200, 175, 150, 125, 100, 75, 50, 25,
+    0, -25, -50, -75, -100, -125, -150, -175, -200, -226, -251, -276, -301, -326, -351, -376,
+    -401, -426, -451, -476, -501, -526, -551, -576, -601, -625, -650, -675, -700, -725, -749, -774,
+    -799, -823, -848, -872, -897, -921, -946, -970, -995, -1019, -1043, -1068, -1092, -1116, -1140, -1164,
+    -1189, -1213, -1237, -1260, -1284, -1308, -1332, -1356, -1379, -1403, -1427, -1450, -1474, -1497, -1520, -1544,
+    -1567, -1590, -1613, -1636, -1659, -1682, -1705, -1728, -1751, -1773, -1796, -1819, -1841, -1864, -1886, -1908,
+    -1930, -1952, -1975, -1997, -2018, -2040, -2062, -2084, -2105, -2127, -2148, -2170, -2191, -2212, -2233, -2254,
+    -2275, -2296, -2317, -2337, -2358, -2379, -2399, -2419, -2439, -2460, -2480, -2500, -2519, -2539, -2559, -2578,
+    -2598, -2617, -2637, -2656, -2675, -2694, -2713, -2732, -2750, -2769, -2787, -2806, -2824, -2842, -2860, -2878,
+    -2896, -2914, -2931, -2949, -2966, -2983, -3000, -3018, -3034, -3051, -3068, -3085, -3101, -3117, -3134, -3150,
+    -3166, -3182, -3197, -3213, -3229, -3244, -3259, -3274, -3289, -3304, -3319, -3334, -3348, -3363, -3377, -3391,
+    -3405, -3419, -3433, -3447, -3460, -3473, -3487, -3500, -3513, -3526, -3538, -3551, -3563, -3576, -3588, -3600,
+    -3612, -3624, -3635, -3647, -3658, -3669, -3680, -3691, -3702, -3713, -3723, -3734, -3744, -3754, -3764, -3774,
+    -3784, -3793, -3803, -3812, -3821, -3830, -3839, -3848, -3856, -3864, -3873, -3881, -3889, -3897, -3904, -3912,
+    -3919, -3926, -3933, -3940, -3947, -3954, -3960, -3967, -3973, -3979, -3985, -3990, -3996, -4001, -4007, -4012,
+    -4017, -4022, -4026, -4031, -4035, -4039, -4043, -4047, -4051, -4055, -4058, -4062, -4065, -4068, -4071, -4073,
+    -4076, -4078, -4080, -4082, -4084, -4086, -4088, -4089, -4091, -4092, -4093, -4094, -4094, -4095, -4095, -4095,
+    -4096, -4095, -4095, -4095, -4094, -4094, -4093, -4092, -4091, -4089, -4088, -4086, -4084, -4082, -4080, -4078,
+    -4076, -4073, -4071, -4068, -4065, -4062, -4058, -4055, -4051, -4047, -4043, -4039, -4035, -4031, -4026, -4022,
+    -4017, -4012, -4007, -4001, -3996, -3990, -3985, -3979, -3973, -3967, -3960, -3954, -3947, -3940, -3933, -3926,
+    -3919, -3912, -3904, -3897, -3889, -3881, -3873, -3864, -3856, -3848, -3839, -3830, -3821, -3812, -3803, -3793,
+    -3784, -3774, -3764, -3754, -3744, -3734, -3723, -3713, -3702, -3691, -3680, -3669, -3658, -3647, -3635, -3624,
+    -3612, -3600, -3588, -3576, -3563, -3551, -3538, -3526, -3513, -3500, -3487, -3473, -3460, -3447, -3433, -3419,
+    -3405, -3391, -3377, -3363, -3348, -3334, -3319, -3304, -3289, -3274, -3259, -3244, -3229, -3213, -3197, -3182,
+    -3166, -3150, -3134, -3117, -3101, -3085, -3068, -3051, -3034, -3018, -3000, -2983, -2966, -2949, -2931, -2914,
+    -2896, -2878, -2860, -2842, -2824, -2806, -2787, -2769, -2750, -2732, -2713, -2694, -2675, -2656, -2637, -2617,
+    -2598, -2578, -2559, -2539, -2519, -2500, -2480, -2460, -2439, -2419, -2399, -2379, -2358, -2337, -2317, -2296,
+    -2275, -2254, -2233, -2212, -2191, -2170, -2148, -2127, -2105, -2084, -2062, -2040, -2018, -1997, -1975, -1952,
+    -1930, -1908, -1886, -1864, -1841, -1819, -1796, -1773, -1751, -1728, -1705, -1682, -1659, -1636, -1613, -1590,
+    -1567, -1544, -1520, -1497, -1474, -1450, -1427, -1403, -1379, -1356, -1332, -1308, -1284, -1260, -1237, -1213,
+    -1189, -1164, -1140, -1116, -1092, -1068, -1043, -1019, -995, -970, -946, -921, -897, -872, -848, -823,
+    -799, -774, -749, -725, -700, -675, -650, -625, -601, -576, -551, -526, -501, -476, -451, -426,
+    -401, -376, -351, -326, -301, -276, -251, -226, -200, -175, -150, -125, -100, -75, -50, -25,
+};
+
+const int16_t demo_sin_q8_tab[1024] = {
+    0, 1, 3, 4, 6, 7, 9, 10, 12, 14, 15, 17, 18, 20, 21, 23,
+    25, 26, 28, 29, 31, 32, 34, 36, 37, 39, 40, 42, 43, 45, 46, 48,
+    49, 51, 53, 54, 56, 57, 59, 60, 62, 63, 65, 66, 68, 69, 71, 72,
+    74, 75, 77, 78, 80, 81, 83, 84, 86, 87, 89, 90, 92, 93, 95, 96,
+    97, 99, 100, 102, 103, 105, 106, 108, 109, 110, 112, 113, 115, 116, 117, 119,
+    120, 122, 123, 124, 126, 127, 128, 130, 131, 132, 134, 135, 136, 138, 139, 140,
+    142, 143, 144, 146, 147, 148, 149, 151, 152, 153, 155, 156, 157, 158, 159, 161,
+    162, 163, 164, 166, 167, 168, 169, 170, 171, 173, 174, 175, 176, 177, 178, 179,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 211,
+    212, 213, 214, 215, 216, 217, 217, 218, 219, 220, 221, 221, 222, 223, 224, 225,
+    225, 226, 227, 227, 228, 229, 230, 230, 231, 232, 232, 233, 234, 234, 235, 235,
+    236, 237, 237, 238, 238, 239, 239, 240, 241, 241, 242, 242, 243, 243, 244, 244,
+    244, 245, 245, 246, 246, 247, 247, 247, 248, 248, 249, 249, 249, 250, 250, 250,
+    251, 251, 251, 251, 252, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 254,
+    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    256, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
+    254, 254, 254, 254, 254, 253, 253, 253, 253, 252, 252, 252, 252, 251, 251, 251,
+    251, 250, 250, 250, 249, 249, 249, 248, 248, 247, 247, 247, 246, 246, 245, 245,
+    244, 244, 244, 243, 243, 242, 242, 241, 241, 240, 239, 239, 238, 238, 237, 237,
+    236, 235, 235, 234, 234, 233, 232, 232, 231, 230, 230, 229, 228, 227, 227, 226,
+    225, 225, 224, 223, 222, 221, 221, 220, 219, 218, 217, 217, 216, 215, 214, 213,
+    212, 211, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198,
+    197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182,
+    181, 179, 178, 177, 176, 175, 174, 173, 171, 170, 169, 168, 167, 166, 164, 163,
+    162, 161, 159, 158, 157, 156, 155, 153, 152, 151, 149, 148, 147, 146, 144, 143,
+    142, 140, 139, 138, 136, 135, 134, 132, 131, 130, 128, 127, 126, 124, 123, 122,
+    120, 119, 117, 116, 115, 113, 112, 110, 109, 108, 106, 105, 103, 102, 100, 99,
+    97, 96, 95, 93, 92, 90, 89, 87, 86, 84, 83, 81, 80, 78, 77, 75,
+    74, 72, 71, 69, 68, 66, 65, 63, 62, 60, 59, 57, 56, 54, 53, 51,
+    49, 48, 46, 45, 43, 42, 40, 39, 37, 36, 34, 32, 31, 29, 28, 26,
+    25, 23, 21, 20, 18, 17, 15, 14, 12, 10, 9, 7, 6, 4, 3, 1,
+    0, -1, -3, -4, -6, -7, -9, -10, -12, -14, -15, -17, -18, -20, -21, -23,
+    -25, -26, -28, -29, -31, -32, -34, -36, -37, -39, -40, -42, -43, -45, -46, -48,
+    -49, -51, -53, -54, -56, -57, -59, -60, -62, -63, -65, -66, -68, -69, -71, -72,
+    -74, -75, -77, -78, -80, -81, -83, -84, -86, -87, -89, -90, -92, -93, -95, -96,
+    -97, -99, -100, -102, -103, -105, -106, -108, -109, -110, -112, -113, -115, -116, -117, -119,
+    -120, -122, -123, -124, -126, -127, -128, -130, -131, -132, -134, -135, -136, -138, -139, -140,
+    -142, -143, -144, -146, -147, -148, -149, -151, -152, -153, -155, -156, -157, -158, -159, -161,
+    -162, -163, -164, -166, -167, -168, -169, -170, -171, -173, -174, -175, -176, -177, -178, -179,
+    -181, -182, -183, -184, -185, -186, -187, -188, -189, -190, -191, -192, -193, -194, -195, -196,
+    -197, -198, -199, -200, -201, -202, -203, -204, -205, -206, -207, -208, -209, -210, -211, -211,
+    -212, -213, -214, -215, -216, -217, -217, -218, -219, -220, -221, -221, -222, -223, -224, -225,
+    -225, -226, -227, -227, -228, -229, -230, -230, -231, -232, -232, -233, -234, -234, -235, -235,
+    -236, -237, -237, -238, -238, -239, -239, -240, -241, -241, -242, -242, -243, -243, -244, -244,
+    -244, -245, -245, -246, -246, -247, -247, -247, -248, -248, -249, -249, -249, -250, -250, -250,
+    -251, -251, -251, -251, -252, -252, -252, -252, -253, -253, -253, -253, -254, -254, -254, -254,
+    -254, -254, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255,
+    -256, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -254,
+    -254, -254, -254, -254, -254, -253, -253, -253, -253, -252, -252, -252, -252, -251, -251, -251,
+    -251, -250, -250, -250, -249, -249, -249, -248, -248, -247, -247, -247, -246, -246, -245, -245,
+    -244, -244, -244, -243, -243, -242, -242, -241, -241, -240, -239, -239, -238, -238, -237, -237,
+    -236, -235, -235, -234, -234, -233, -232, -232, -231, -230, -230, -229, -228, -227, -227, -226,
+    -225, -225, -224, -223, -222, -221, -221, -220, -219, -218, -217, -217, -216, -215, -214, -213,
+    -212, -211, -211, -210, -209, -208, -207, -206, -205, -204, -203, -202, -201, -200, -199, -198,
+    -197, -196, -195, -194, -193, -192, -191, -190, -189, -188, -187, -186, -185, -184, -183, -182,
+    -181, -179, -178, -177, -176, -175, -174, -173, -171, -170, -169, -168, -167, -166, -164, -163,
+    -162, -161, -159, -158, -157, -156, -155, -153, -152, -151, -149, -148, -147, -146, -144, -143,
+    -142, -140, -139, -138, -136, -135, -134, -132, -131, -130, -128, -127, -126, -124, -123, -122,
+    -120, -119, -117, -116, -115, -113, -112, -110, -109, -108, -106, -105, -103, -102, -100, -99,
+    -97, -96, -95, -93, -92, -90, -89, -87, -86, -84, -83, -81, -80, -78, -77, -75,
+    -74, -72, -71, -69, -68, -66, -65, -63, -62, -60, -59, -57, -56, -54, -53, -51,
+    -49, -48, -46, -45, -43, -42, -40, -39, -37, -36, -34, -32, -31, -29, -28, -26,
+    -25, -23, -21, -20, -18, -17, -15, -14, -12, -10, -9, -7, -6, -4, -3, -1,
+};
+
+const uint32_t demo_recip_q16_tab[1024] = {
+    65536, 65536, 32768, 21845, 16384, 13107, 10922, 9362, 8192, 7281, 6553, 5957,
+    5461, 5041, 4681, 4369, 4096, 3855, 3640, 3449, 3276, 3120, 2978, 2849,
+    2730, 2621, 2520, 2427, 2340, 2259, 2184, 2114, 2048, 1985, 1927, 1872,
+    1820, 1771, 1724, 1680, 1638, 1598, 1560, 1524, 1489, 1456, 1424, 1394,
+    1365, 1337, 1310, 1285, 1260, 1236, 1213, 1191, 1170, 1149, 1129, 1110,
+    1092, 1074, 1057, 1040, 1024, 1008, 992, 978, 963, 949, 936, 923,
+    910, 897, 885, 873, 862, 851, 840, 829, 819, 809, 799, 789,
+    780, 771, 762, 753, 744, 736, 728, 720, 712, 704, 697, 689,
+    682, 675, 668, 661, 655, 648, 642, 636, 630, 624, 618, 612,
+    606, 601, 595, 590, 585, 579, 574, 569, 564, 560, 555, 550,
+    546, 541, 537, 532, 528, 524, 520, 516, 512, 508, 504, 500,
+    496, 492, 489, 485, 481, 478, 474, 471, 468, 464, 461, 458,
+    455, 451, 448, 445, 442, 439, 436, 434, 431, 428, 425, 422,
+    420, 417, 414, 412, 409, 407, 404, 402, 399, 397, 394, 392,
+    390, 387, 385, 383, 381, 378, 376, 374, 372, 370, 368, 366,
+    364, 362, 360, 358, 356, 354, 352, 350, 348, 346, 344, 343,
+    341, 339, 337, 336, 334, 332, 330, 329, 327, 326, 324, 322,
+    321, 319, 318, 316, 315, 313, 312, 310, 309, 307, 306, 304,
+    303, 302, 300, 299, 297, 296, 295, 293, 292, 291, 289, 288,
+    287, 286, 284, 283, 282, 281, 280, 278, 277, 276, 275, 274,
+    273, 271, 270, 269, 268, 267, 266, 265, 264, 263, 262, 261,
+    260, 259, 258, 257, 256, 255, 254, 253, 252, 251, 250, 249,
+    248, 247, 246, 245, 244, 243, 242, 241, 240, 240, 239, 238,
+    237, 236, 235, 234, 234, 233, 232, 231, 230, 229, 229, 228,
+    227, 226, 225, 225, 224, 223, 222, 222, 221, 220, 219, 219,
+    218, 217, 217, 216, 215, 214, 214, 213, 212, 212, 211, 210,
+    210, 209, 208, 208, 207, 206, 206, 205, 204, 204, 203, 202,
+    202, 201, 201, 200, 199, 199, 198, 197, 197, 196, 196, 195,
+    195, 194, 193, 193, 192, 192, 191, 191, 190, 189, 189, 188,
+    188, 187, 187, 186, 186, 185, 185, 184, 184, 183, 183, 182,
+    182, 181, 181, 180, 180, 179, 179, 178, 178, 177, 177, 176,
+    176, 175, 175, 174, 174, 173, 173, 172, 172, 172, 171, 171,
+    170, 170, 169, 169, 168, 168, 168, 167, 167, 166, 166, 165,
+    165, 165, 164, 164, 163, 163, 163, 162, 162, 161, 161, 161,
+    160, 160, 159, 159, 159, 158, 158, 157, 157, 157, 156, 156,
+    156, 155, 155, 154, 154, 154, 153, 153, 153, 152, 152, 152,
+    151, 151, 151, 150, 150, 149, 149, 149, 148, 148, 148, 147,
+    147, 147, 146, 146, 146, 145, 145, 145, 144, 144, 144, 144,
+    143, 143, 143, 142, 142, 142, 141, 141, 141, 140, 140, 140,
+    140, 139, 139, 139, 138, 138, 138, 137, 137, 137, 137, 136,
+    136, 136, 135, 135, 135, 135, 134, 134, 134, 134, 133, 133,
+    133, 132, 132, 132, 132, 131, 131, 131, 131, 130, 130, 130,
+    130, 129, 129, 129, 129, 128, 128, 128, 128, 127, 127, 127,
+    127, 126, 126, 126, 126, 125, 125, 125, 125, 124, 124, 124,
+    124, 123, 123, 123, 123, 122, 122, 122, 122, 122, 121, 121,
+    121, 121, 120, 120, 120, 120, 120, 119, 119, 119, 119, 118,
+    118, 118, 118, 118, 117, 117, 117, 117, 117, 116, 116, 116,
+    116, 115, 115, 115, 115, 115, 114, 114, 114, 114, 114, 113,
+    113, 113, 113, 113, 112, 112, 112, 112, 112, 112, 111, 111,
+    111, 111, 111, 110, 110, 110, 110, 110, 109, 109, 109, 109,
+    109, 109, 108, 108, 108, 108, 108, 107, 107, 107, 107, 107,
+    107, 106, 106, 106, 106, 106, 106, 105, 105, 105, 105, 105,
+    105, 104, 104, 104, 104, 104, 104, 103, 103, 103, 103, 103,
+    103, 102, 102, 102, 102, 102, 102, 101, 101, 101, 101, 101,
+    101, 100, 100, 100, 100, 100, 100, 100, 99, 99, 99, 99,
+    99, 99, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97,
+    97, 97, 97, 97, 96, 96, 96, 96, 96, 96, 96, 95,
+    95, 95, 95, 95, 95, 95, 94, 94, 94, 94, 94, 94,
+    94, 94, 93, 93, 93, 93, 93, 93, 93, 92, 92, 92,
+    92, 92, 92, 92, 92, 91, 91, 91, 91, 91, 91, 91,
+    91, 90, 90, 90, 90, 90, 90, 90, 90, 89, 89, 89,
+    89, 89, 89, 89, 89, 88, 88, 88, 88, 88, 88, 88,
+    88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 86,
+    86, 86, 86, 86, 86, 86, 86, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 83, 83, 83, 83, 83, 83, 83, 83, 83, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 69, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64,
+};
+
+const uint16_t demo_sqrt_q4_tab[1024] = {
+    0, 16, 22, 27, 32, 35, 39, 42, 45, 48, 50, 53, 55, 57, 59, 61,
+    64, 65, 67, 69, 71, 73, 75, 76, 78, 80, 81, 83, 84, 86, 87, 89,
+    90, 91, 93, 94, 96, 97, 98, 99, 101, 102, 103, 104, 106, 107, 108, 109,
+    110, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+    128, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+    143, 144, 144, 145, 146, 147, 148, 149, 150, 150, 151, 152, 153, 154, 155, 155,
+    156, 157, 158, 159, 160, 160, 161, 162, 163, 163, 164, 165, 166, 167, 167, 168,
+    169, 170, 170, 171, 172, 173, 173, 174, 175, 176, 176, 177, 178, 178, 179, 180,
+    181, 181, 182, 183, 183, 184, 185, 185, 186, 187, 187, 188, 189, 189, 190, 191,
+    192, 192, 193, 193, 194, 195, 195, 196, 197, 197, 198, 199, 199, 200, 201, 201,
+    202, 203, 203, 204, 204, 205, 206, 206, 207, 208, 208, 209, 209, 210, 211, 211,
+    212, 212, 213, 214, 214, 215, 215, 216, 217, 217, 218, 218, 219, 219, 220, 221,
+    221, 222, 222, 223, 224, 224, 225, 225, 226, 226, 227, 227, 228, 229, 229, 230,
+    230, 231, 231, 232, 232, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238,
+    239, 240, 240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 247,
+    247, 248, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255,
+    256, 256, 256, 257, 257, 258, 258, 259, 259, 260, 260, 261, 261, 262, 262, 263,
+    263, 264, 264, 265, 265, 266, 266, 267, 267, 268, 268, 269, 269, 270, 270, 271,
+    271, 272, 272, 272, 273, 273, 274, 274, 275, 275, 276, 276, 277, 277, 278, 278,
+    278, 279, 279, 280, 280, 281, 281, 282, 282, 283, 283, 283, 284, 284, 285, 285,
+    286, 286, 287, 287, 288, 288, 288, 289, 289, 290, 290, 291, 291, 291, 292, 292,
+    293, 293, 294, 294, 295, 295, 295, 296, 296, 297, 297, 298, 298, 298, 299, 299,
+    300, 300, 301, 301, 301, 302, 302, 303, 303, 304, 304, 304, 305, 305, 306, 306,
+    306, 307, 307, 308, 308, 309, 309, 309, 310, 310, 311, 311, 311, 312, 312, 313,
+    313, 313, 314, 314, 315, 315, 315, 316, 316, 317, 317, 317, 318, 318, 319, 319,
+    320, 320, 320, 321, 321, 321, 322, 322, 323, 323, 323, 324, 324, 325, 325, 325,
+    326, 326, 327, 327, 327, 328, 328, 329, 329, 329, 330, 330, 331, 331, 331, 332,
+    332, 332, 333, 333, 334, 334, 334, 335, 335, 336, 336, 336, 337, 337, 337, 338,
+    338, 339, 339, 339, 340, 340, 340, 341, 341, 342, 342, 342, 343, 343, 343, 344,
+    344, 345, 345, 345, 346, 346, 346, 347, 347, 347, 348, 348, 349, 349, 349, 350,
+    350, 350, 351, 351, 352, 352, 352, 353, 353, 353, 354, 354, 354, 355, 355, 355,
+    356, 356, 357, 357, 357, 358, 358, 358, 359, 359, 359, 360, 360, 360, 361, 361,
+    362, 362, 362, 363, 363, 363, 364, 364, 364, 365, 365, 365, 366, 366, 366, 367,
+    367, 368, 368, 368, 369, 369, 369, 370, 370, 370, 371, 371, 371, 372, 372, 372,
+    373, 373, 373, 374, 374, 374, 375, 375, 375, 376, 376, 376, 377, 377, 377, 378,
+    378, 378, 379, 379, 379, 380, 380, 380, 381, 381, 381, 382, 382, 382, 383, 383,
+    384, 384, 384, 384, 385, 385, 385, 386, 386, 386, 387, 387, 387, 388, 388, 388,
+    389, 389, 389, 390, 390, 390, 391, 391, 391, 392, 392, 392, 393, 393, 393, 394,
+    394, 394, 395, 395, 395, 396, 396, 396, 397, 397, 397, 398, 398, 398, 399, 399,
+    399, 400, 400, 400, 400, 401, 401, 401, 402, 402, 402, 403, 403, 403, 404, 404,
+    404, 405, 405, 405, 406, 406, 406, 406, 407, 407, 407, 408, 408, 408, 409, 409,
+    409, 410, 410, 410, 411, 411, 411, 411, 412, 412, 412, 413, 413, 413, 414, 414,
+    414, 415, 415, 415, 416, 416, 416, 416, 417, 417, 417, 418, 418, 418, 419, 419,
+    419, 419, 420, 420, 420, 421, 421, 421, 422, 422, 422, 423, 423, 423, 423, 424,
+    424, 424, 425, 425, 425, 426, 426, 426, 426, 427, 427, 427, 428, 428, 428, 429,
+    429, 429, 429, 430, 430, 430, 431, 431, 431, 432, 432, 432, 432, 433, 433, 433,
+    434, 434, 434, 434, 435, 435, 435, 436, 436, 436, 437, 437, 437, 437, 438, 438,
+    438, 439, 439, 439, 439, 440, 440, 440, 441, 441, 441, 441, 442, 442, 442, 443,
+    443, 443, 443, 444, 444, 444, 445, 445, 445, 445, 446, 446, 446, 447, 447, 447,
+    448, 448, 448, 448, 449, 449, 449, 449, 450, 450, 450, 451, 451, 451, 451, 452,
+    452, 452, 453, 453, 453, 453, 454, 454, 454, 455, 455, 455, 455, 456, 456, 456,
+    457, 457, 457, 457, 458, 458, 458, 459, 459, 459, 459, 460, 460, 460, 460, 461,
+    461, 461, 462, 462, 462, 462, 463, 463, 463, 464, 464, 464, 464, 465, 465, 465,
+    465, 466, 466, 466, 467, 467, 467, 467, 468, 468, 468, 468, 469, 469, 469, 470,
+    470, 470, 470, 471, 471, 471, 471, 472, 472, 472, 473, 473, 473, 473, 474, 474,
+    474, 474, 475, 475, 475, 475, 476, 476, 476, 477, 477, 477, 477, 478, 478, 478,
+    478, 479, 479, 479, 480, 480, 480, 480, 481, 481, 481, 481, 482, 482, 482, 482,
+    483, 483, 483, 483, 484, 484, 484, 485, 485, 485, 485, 486, 486, 486, 486, 487,
+    487, 487, 487, 488, 488, 488, 488, 489, 489, 489, 490, 490, 490, 490, 491, 491,
+    491, 491, 492, 492, 492, 492, 493, 493, 493, 493, 494, 494, 494, 494, 495, 495,
+    495, 496, 496, 496, 496, 497, 497, 497, 497, 498, 498, 498, 498, 499, 499, 499,
+    499, 500, 500, 500, 500, 501, 501, 501, 501, 502, 502, 502, 502, 503, 503, 503,
+    503, 504, 504, 504, 504, 505, 505, 505, 505, 506, 506, 506, 506, 507, 507, 507,
+    507, 508, 508, 508, 508, 509, 509, 509, 509, 510, 510, 510, 510, 511, 511, 511,
+};
+
+const uint8_t demo_atan_tab[257] = {
+    0, 1, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 10,
+    10, 11, 11, 12, 13, 13, 14, 15, 15, 16, 16, 17, 18, 18, 19, 20,
+    20, 21, 22, 22, 23, 23, 24, 25, 25, 26, 27, 27, 28, 28, 29, 30,
+    30, 31, 31, 32, 33, 33, 34, 34, 35, 36, 36, 37, 38, 38, 39, 39,
+    40, 41, 41, 42, 42, 43, 44, 44, 45, 45, 46, 46, 47, 48, 48, 49,
+    49, 50, 51, 51, 52, 52, 53, 53, 54, 55, 55, 56, 56, 57, 57, 58,
+    58, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 65, 65, 66, 66, 67,
+    67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 74, 74, 75, 75,
+    76, 76, 77, 77, 78, 78, 79, 79, 80, 80, 81, 81, 82, 82, 83, 83,
+    84, 84, 84, 85, 85, 86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91,
+    91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 96, 96, 96, 97, 97, 98,
+    98, 99, 99, 99, 100, 100, 101, 101, 102, 102, 102, 103, 103, 104, 104, 104,
+    105, 105, 106, 106, 106, 107, 107, 108, 108, 108, 109, 109, 110, 110, 110, 111,
+    111, 112, 112, 112, 113, 113, 113, 114, 114, 115, 115, 115, 116, 116, 116, 117,
+    117, 118, 118, 118, 119, 119, 119, 120, 120, 120, 121, 121, 121, 122, 122, 122,
+    123, 123, 123, 124, 124, 124, 125, 125, 125, 126, 126, 126, 127, 127, 127, 128,
+    128,
+};
+
@@ -0,0 +1,177 @@
+/*
+ * Filename: demo_palette.c
+ * THE PRISM OF INDICES
+ * 索引棱镜
+ *
+ * 拟合：节点初值取调色板在节点输入处的颜色，再逐节点在 ±PAL_REFINE 内搜索，
+ * 使相邻两段的最大误差最小 (坐标下降，两轮)。每通道约 4 万次插值，只在特效启动时执行一次。
+ */
+
+#include "demo_palette.h"
+#include "demo_perf.h"
+#include "demo_swar.h"
+
+#define PAL_NODES  16
+#define PAL_STEP   17 /* 节点 k 对应输入 k * 17 */
+#define PAL_REFINE 16 /* 节点微调的搜索半径 */
+#define PAL_PASSES 2
+
+static struct
+{
+    const char *name;   /* 最近一次选择模式的特效 */
+    int         err;    /* 拟合误差 (-1 表示未拟合) */
+    bool        gamma;  /* true: DE gamma；false: CPU 展开 */
+    uint32_t    fit_us; /* 拟合耗时 */
+} g_pal = {NULL, -1, false, 0};
+
+/* --- 拟合 --- */
+
+/* 索引 i 经 GE 写入帧缓冲、再由 DE 读出后的通道电平：全范围灰度，按帧缓冲的通道位数截断 */
+static inline int pal_level(int i, int mask)
+{
+    return i & mask;
+}
+
+static inline int pal_interp(const uint8_t *node, int lv)
+{
+    int k = lv / PAL_STEP;
+    int f = lv % PAL_STEP;
+    int a = node[MIN(k, PAL_NODES - 1)];
+    int b = node[MIN(k + 1, PAL_NODES - 1)];
+    return a + (b - a) * f / PAL_STEP;
+}
+
+/* 电平落在 [lo, hi] 内的索引的最大误差 */
+static int pal_error(const uint8_t *node, const uint8_t *lv, const uint8_t *ref, int lo, int hi)
+{
+    int err = 0;
+    for (int i = 0; i < DEMO_PALETTE_SIZE; i++)
+    {
+        if (lv[i] < lo || lv[i] > hi)
+            continue;
+        int e = ABS(pal_interp(node, lv[i]) - ref[i]);
+        err   = MAX(err, e);
+    }
+    return err;
+}
+
+static int pal_fit_channel(const uint8_t *lv, const uint8_t *ref, unsigned int *out)
+{
+    uint8_t node[PAL_NODES];
+
+    for (int k = 0; k < PAL_NODES; k++)
+        node[k] = ref[k * PAL_STEP];
+
+    for (int pass = 0; pass < PAL_PASSES; pass++)
+    {
+        for (int k = 0; k < PAL_NODES; k++)
+        {
+            /* 节点 k 只影响相邻两段 */
+            int lo   = (k - 1) * PAL_STEP;
+            int hi   = (k + 1) * PAL_STEP;
+            int cur  = node[k];
+            int best = cur;
+            int berr = pal_error(node, lv, ref, lo, hi);
+
+            for (int v = MAX(cur - PAL_REFINE, 0); v <= MIN(cur + PAL_REFINE, 255); v++)
+            {
+                node[k] = (uint8_t)v;
+                int e   = pal_error(node, lv, ref, lo, hi);
+                if (e < berr)
+                {
+                    berr = e;
+                    best = v;
+                }
+            }
+            node[k] = (uint8_t)best;
+        }
+    }
+
+    for (int k = 0; k < PAL_NODES; k++)
+        out[k] = node[k];
+    return pal_error(node, lv, ref, 0, 255);
+}
+
+int demo_palette_fit(const uint16_t *pal, int fb_format, struct aicfb_gamma_config *gamma)
+{
+    /* RGB565 帧缓冲只保留灰度的高 5 / 6 / 5 位 */
+    int     mask[3] = {0xFF, 0xFF, 0xFF};
+    uint8_t lv[DEMO_PALETTE_SIZE];
+    uint8_t ref[DEMO_PALETTE_SIZE];
+    int     err = 0;
+
+    if (fb_format == MPP_FMT_RGB_565)
+    {
+        mask[0] = 0xF8;
+        mask[1] = 0xFC;
+        mask[2] = 0xF8;
+    }
+
+    gamma->enable = 1;
+    for (int c = 0; c < 3; c++)
+    {
+        for (int i = 0; i < DEMO_PALETTE_SIZE; i++)
+        {
+            lv[i]  = (uint8_t)pal_level(i, mask[c]);
+            ref[i] = (uint8_t)(c == 0 ? RGB565_R(pal[i]) : c == 1 ? RGB565_G(pal[i]) : RGB565_B(pal[i]));
+        }
+        err = MAX(err, pal_fit_channel(lv, ref, gamma->gamma_lut[c]));
+    }
+    return err;
+}
+
+/* --- 模式选择 --- */
+
+bool demo_palette_setup(const struct effect_ops *op, int fb_format, struct aicfb_gamma_config *gamma)
+{
+    g_pal.name   = op->name;
+    g_pal.err    = -1;
+    g_pal.gamma  = false;
+    g_pal.fit_us = 0;
+
+#ifdef AIC_GE_DEMO_PALETTE_MODE
+    if (op->palette_discrete)
+    {
+        rt_kprintf("Palette: CPU expand (discrete indices, not interpolatable)\n");
+        return false;
+    }
+
+    uint64_t t0  = demo_perf_now_us();
+    g_pal.err    = demo_palette_fit(op->palette, fb_format, gamma);
+    g_pal.fit_us = (uint32_t)(demo_perf_now_us() - t0);
+    g_pal.gamma  = g_pal.err <= AIC_GE_DEMO_PALETTE_TOLERANCE;
+
+    rt_kprintf("Palette: %s (max error %d, tolerance %d, fit %u us)\n", g_pal.gamma ? "DE gamma" : "CPU expand",
+               g_pal.err, AIC_GE_DEMO_PALETTE_TOLERANCE, g_pal.fit_us);
+#endif
+    return g_pal.gamma;
+}
+
+void demo_palette_expand(const struct demo_tex *idx, const uint16_t *pal, struct demo_tex *dst)
+{
+    const uint8_t *s = (const uint8_t *)idx->vir;
+    uint8_t       *d = (uint8_t *)dst->vir;
+
+    for (int y = 0; y < dst->height; y++, s += idx->stride, d += dst->stride)
+        demo_px_lut8((uint16_t *)d, s, pal, dst->width);
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_palette(int argc, char **argv)
+{
+    if (!g_pal.name)
+    {
+        rt_kprintf("No palette effect has run yet.\n");
+        return 0;
+    }
+
+    rt_kprintf("--- Palette (tolerance %d) ---\n", AIC_GE_DEMO_PALETTE_TOLERANCE);
+    rt_kprintf("%s: %s, texture %d B/px\n", g_pal.name, g_pal.gamma ? "DE gamma" : "CPU expand", g_pal.gamma ? 1 : 2);
+    if (g_pal.err >= 0)
+        rt_kprintf("max error %d, fit %u us\n", g_pal.err, g_pal.fit_us);
+    else
+        rt_kprintf("palette mode disabled (AIC_GE_DEMO_PALETTE_MODE)\n");
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_palette, demo_palette, Show indexed palette mode of the last effect);
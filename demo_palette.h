@@ -0,0 +1,44 @@
+/*
+ * Filename: demo_palette.h
+ * THE PRISM OF INDICES
+ * 索引棱镜
+ *
+ * [Palette] 索引色模式：特效每像素只写 1 字节调色板索引 (YUV400 纹理)，
+ * 由 GE 按灰度缩放，再由 DE 的逐通道 gamma 表把灰度映射回调色板颜色。
+ * CPU 存储带宽与 cache clean 的数据量都减半。
+ *
+ * DE gamma 每通道只有 16 个节点 (节点 k 对应输入 k * 17，节点间线性插值)，
+ * 只能逼近分段平滑的调色板；引擎在特效启动时拟合节点并计算最大误差，
+ * 超出容限 (或未启用本模式) 时改由 CPU 以 demo_px_lut8 展开为 RGB565 纹理，
+ * 画面与直接写 RGB565 逐位一致。
+ *
+ * 误差模型假定 GE 将 YUV400 按全范围 (R = G = B = Y) 转为帧缓冲格式，
+ * 与主机替身一致；若板上 CSC 为有限范围，需修改 demo_palette.c 中的 pal_level。
+ */
+
+#ifndef _DEMO_PALETTE_H_
+#define _DEMO_PALETTE_H_
+
+#include "demo_engine.h"
+
+#define DEMO_PALETTE_SIZE 256
+
+/* 拟合的最大误差 (8 位色阶) 不超过此值时使用 DE gamma，否则回退为 CPU 展开 */
+#ifndef AIC_GE_DEMO_PALETTE_TOLERANCE
+#define AIC_GE_DEMO_PALETTE_TOLERANCE 24
+#endif
+
+/*
+ * 为带调色板的特效选择模式：返回 true 时 gamma 已填好，纹理应为 YUV400；
+ * 返回 false 时特效写入 CPU 索引缓冲，由 demo_palette_expand 展开。
+ * fb_format 为帧缓冲格式 (决定灰度经 GE 写入后保留的位数)。
+ */
+bool demo_palette_setup(const struct effect_ops *op, int fb_format, struct aicfb_gamma_config *gamma);
+
+/* 以 16 节点 gamma 拟合 256 项 RGB565 调色板，返回三个通道中的最大误差 */
+int demo_palette_fit(const uint16_t *pal, int fb_format, struct aicfb_gamma_config *gamma);
+
+/* CPU 展开：dst (RGB565) 的每一行 = pal[idx 的对应行] */
+void demo_palette_expand(const struct demo_tex *idx, const uint16_t *pal, struct demo_tex *dst);
+
+#endif /* _DEMO_PALETTE_H_ */
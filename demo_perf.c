@@ -5,6 +5,7 @@
  */
 
 #include "demo_perf.h"
+#include "demo_ge_batch.h"
 #include <rtthread.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,71 +18,257 @@
 #include "cpu_usage.h"
 #endif
 
+/*
+ * [Phase Timer] 高精度计时源
+ * 裸机 RISC-V (D13x, RV64) 直接读取 cycle 计数器，频率在每秒统计时按系统节拍校准；
+ * 主机 (Linux) 构建使用单调时钟的纳秒值。
+ */
+#if defined(__riscv) && !defined(__linux__)
+#define PERF_CYCLES_PER_US 480 /* D13CCS @ 480MHz，校准前的初值 */
+#define PERF_CALIBRATE     1
+static inline uint64_t perf_cycles(void)
+{
+    uint64_t c;
+    __asm__ volatile("rdcycle %0" : "=r"(c));
+    return c;
+}
+#else
+#include <time.h>
+#define PERF_CYCLES_PER_US 1000
+#define PERF_CALIBRATE     0
+static inline uint64_t perf_cycles(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+#endif
+
+/* OSD 行数：第 4 行显示当前瓶颈阶段 */
+#ifdef AIC_GE_DEMO_PERF_PHASE_OSD
+#define PERF_OSD_LINES 4
+#else
+#define PERF_OSD_LINES 3
+#endif
+
+static const char *const g_phase_names[DEMO_PHASE_NUM] = {"CPU", "CACHE", "GE", "SYNC", "OSD", "VSYNC", "FRAME"};
+
+/* 已离开特效的统计摘要 (按序号排序的单链表，仅为访问过的特效分配) */
+struct perf_effect_node
+{
+    struct perf_effect_node *next;
+    int                      index;
+    const char              *name;
+    struct demo_phase_stat   stat[DEMO_PHASE_NUM];
+};
+
+static struct perf_effect_node *g_effect_stats = RT_NULL;
+
+/*
+ * 链表只由渲染线程修改；msh 线程遍历打印时持有 g_effect_lock，渲染线程在链接 / 覆盖 / 释放节点时持有。
+ * "demo_perf reset" 只置请求标志，由渲染线程在帧末或切换特效时清空，不与 hist_add 竞争。
+ */
+static rt_mutex_t    g_effect_lock    = RT_NULL;
+static volatile bool g_perf_reset_req = false;
+
 /* 默认字体资产路径 */
+#ifndef FONT_ASSET_PATH
 #define FONT_ASSET_PATH "/data/ge_demos/font_24px.bin"
+#endif
 
 static struct performance_matrix g_perf;
 
-/* 遵循 SPEC.md 4.3: 载入点阵字体资产并确保内存合规 */
-static void load_font_asset(void)
+static void perf_osd_refresh(void);
+
+/*
+ * [Font v2] 点阵字体资产格式 (由 fonts/font_conv.py 生成，小端，各段 4 字节对齐)
+ * 字形以逐行水平行程存储，绘制时每个行程一次整段填充，不再逐位测试；
+ * 可选附带按 RGB565 / ARGB8888 预展开的字形像素，供图集光栅化整行拷贝。
+ */
+#define FONT_MAGIC      "GFNT"
+#define FONT_VERSION    2
+#define FONT_F_RGB565   0x1
+#define FONT_F_ARGB8888 0x2
+
+#define OSD_ATLAS_W 256 /* GE OSD 图集宽度 (像素)，字形逐行排布；字形宽度为 uint8_t，单个字形总能放进一行 */
+
+struct font_file_hdr
 {
-    int fd = open(FONT_ASSET_PATH, O_RDONLY);
-    if (fd < 0)
+    char     magic[4];
+    uint32_t version;
+    uint32_t size;       /* 文件总长 */
+    uint16_t height;     /* 行高 (位图高度) */
+    uint16_t baseline;   /* 基线距行顶的像素数 */
+    uint16_t first_char; /* 首字符编码 */
+    uint16_t char_count; /* 字符总数 */
+    uint16_t flags;      /* FONT_F_*：附带的预展开像素块 */
+    uint16_t reserved0;
+    uint32_t glyph_off;  /* struct font_glyph[char_count] */
+    uint32_t span_off;   /* struct font_span[span_count] */
+    uint32_t span_count;
+    uint32_t pix_off[2]; /* 预展开像素块 (RGB565 / ARGB8888)，0 表示不存在 */
+    uint32_t reserved1;
+};
+
+struct font_glyph
+{
+    uint8_t  width;      /* 位图宽度 */
+    uint8_t  advance;    /* 笔位置步进 */
+    int8_t   bearing;    /* 位图左边缘相对笔位置的偏移 */
+    uint8_t  reserved;
+    uint16_t span_first; /* 首个行程序号 */
+    uint16_t span_num;   /* 行程数 (按行递增) */
+    uint32_t pix;        /* 预展开像素块中的起始像素序号 */
+};
+
+struct font_span
+{
+    uint8_t y;
+    uint8_t x;
+    uint8_t len;
+};
+
+/* [off, off + count * elem) 是否落在 [0, size) 内：先比较偏移再做除法，32 位 size_t 下也不会回绕 */
+static bool font_range_ok(size_t off, size_t count, size_t elem, size_t size)
+{
+    return off <= size && count <= (size - off) / elem;
+}
+
+/* 校验并解析内存中的资产文件，成功后字体句柄直接指向 blob 内部 */
+static bool font_parse(const uint8_t *blob, size_t size)
+{
+    const struct font_file_hdr *hdr = (const struct font_file_hdr *)blob;
+
+    if (size < sizeof(*hdr) || memcmp(hdr->magic, FONT_MAGIC, 4) != 0)
     {
-        rt_kprintf("Demo Error: Failed to open font asset at %s\n", FONT_ASSET_PATH);
-        return;
+        /* v1 资产以 "FONT" 开头，没有行程与度量 */
+        if (size >= 4 && memcmp(blob, "FONT", 4) == 0)
+            rt_kprintf("Demo Error: v1 font asset, regenerate it with fonts/font_conv.py.\n");
+        else
+            rt_kprintf("Demo Error: Invalid font format.\n");
+        return false;
     }
-
-    /* 1. 验证幻数 */
-    char magic[4];
-    read(fd, magic, 4);
-    if (memcmp(magic, "FONT", 4) != 0)
+    if (hdr->version != FONT_VERSION)
     {
-        rt_kprintf("Demo Error: Invalid font format.\n");
-        close(fd);
-        return;
+        rt_kprintf("Demo Error: Unsupported font version %u (expected %d).\n", hdr->version, FONT_VERSION);
+        return false;
     }
 
-    read(fd, &g_perf.font_height, 2);
-    read(fd, &g_perf.char_count, 2);
-
-    /* 2. 分配控制表内存 (使用 mpp_alloc 统一管理) */
-    size_t offset_table_size = DEMO_ALIGN_SIZE(g_perf.char_count * sizeof(uint32_t));
-    g_perf.offsets           = mpp_alloc(offset_table_size);
-    if (!g_perf.offsets)
+    /* 内嵌段可能带有对齐填充，以文件头记录的长度为准 */
+    if (hdr->size > size || (hdr->glyph_off & 3) || hdr->height == 0 ||
+        !font_range_ok(hdr->glyph_off, hdr->char_count, sizeof(struct font_glyph), hdr->size) ||
+        !font_range_ok(hdr->span_off, hdr->span_count, sizeof(struct font_span), hdr->size))
     {
-        rt_kprintf("Demo Error: Offset table alloc failed.\n");
-        close(fd);
-        return;
+        rt_kprintf("Demo Error: Truncated font asset.\n");
+        return false;
     }
-    read(fd, g_perf.offsets, g_perf.char_count * sizeof(uint32_t));
 
-    /* 3. 分配点阵资产内存 (遵循 SPEC.md: 使用 mpp_phy_alloc 以支持 DMA) */
-    off_t current_pos = lseek(fd, 0, SEEK_CUR);
-    off_t total_size  = lseek(fd, 0, SEEK_END);
-    lseek(fd, current_pos, SEEK_SET);
+    /* 行程直接决定图集 (CMA) 与帧缓冲的写入位置：每个行程都须落在字形单元内，任何一处越界即拒绝整个文件 */
+    const struct font_glyph *glyphs  = (const struct font_glyph *)(blob + hdr->glyph_off);
+    const struct font_span  *spans   = (const struct font_span *)(blob + hdr->span_off);
+    size_t                   pixels  = 0;
+    size_t                   pix_max = hdr->size / 2; /* 像素块每像素至少 2 字节 */
+    bool                     pix_ok  = true;
+    for (int i = 0; i < hdr->char_count; i++)
+    {
+        const struct font_glyph *g  = &glyphs[i];
+        bool                     ok = g->span_first + g->span_num <= hdr->span_count;
 
-    size_t data_size = total_size - current_pos;
-    /* 对齐至 Cache Line (64-byte) */
-    size_t aligned_size = DEMO_ALIGN_SIZE(data_size);
+        for (int k = 0; ok && k < g->span_num; k++)
+        {
+            const struct font_span *s = &spans[g->span_first + k];
+            ok                        = s->y < hdr->height && s->x + s->len <= g->width;
+        }
+        if (!ok)
+        {
+            rt_kprintf("Demo Error: Corrupt font glyph %d.\n", i);
+            return false;
+        }
+        /* 预展开像素的序号范围同样先比较再相加，放不下时两个像素块都不可用 */
+        if (font_range_ok(g->pix, (size_t)g->width * hdr->height, 1, pix_max))
+            pixels = MAX(pixels, g->pix + (size_t)g->width * hdr->height);
+        else
+            pix_ok = false;
+    }
+
+    g_perf.font_data     = blob;
+    g_perf.font_glyphs   = glyphs;
+    g_perf.font_spans    = spans;
+    g_perf.font_height   = hdr->height;
+    g_perf.font_baseline = hdr->baseline;
+    g_perf.font_first    = hdr->first_char;
+    g_perf.char_count    = hdr->char_count;
 
-    unsigned int phy_addr = mpp_phy_alloc(aligned_size);
-    if (phy_addr)
+    /* 预展开像素块可选，越界或未对齐时忽略 */
+    static const uint16_t pix_flag[2] = {FONT_F_RGB565, FONT_F_ARGB8888};
+    static const uint8_t  pix_bpp[2]  = {2, 4};
+    for (int i = 0; i < 2; i++)
     {
-        g_perf.font_data = (uint8_t *)(unsigned long)phy_addr;
-        read(fd, g_perf.font_data, data_size);
+        uint32_t off    = hdr->pix_off[i];
+        bool     usable = pix_ok && (hdr->flags & pix_flag[i]) && off && !(off & 3) &&
+                      font_range_ok(off, pixels, pix_bpp[i], hdr->size);
 
-        /* 重要：执行 Cache Flush 确保物理内存与缓存一致性 (SPEC.md 4.3) */
-        aicos_dcache_clean_range(g_perf.font_data, aligned_size);
+        g_perf.font_pix[i] = usable ? blob + off : RT_NULL;
+    }
+    return true;
+}
 
-        rt_kprintf("Demo: High-res font loaded (CMA: %d bytes, height %d)\n", (int)aligned_size, g_perf.font_height);
+#ifdef AIC_GE_DEMO_FONT_EMBED
+extern const uint8_t __start_FontTab[];
+extern const uint8_t __stop_FontTab[];
+#endif
+
+/* 文件系统中的资产：整个文件一次读入堆内存 (字体只由 CPU 读取，图集另行放在 CMA) */
+static bool load_font_file(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+#ifndef AIC_GE_DEMO_FONT_EMBED
+        rt_kprintf("Demo Error: Failed to open font asset at %s\n", path);
+#endif
+        return false;
     }
+
+    off_t    size = lseek(fd, 0, SEEK_END);
+    uint8_t *blob = (size > 0) ? rt_malloc(size) : RT_NULL;
+    bool     ok   = false;
+
+    if (!blob)
+        rt_kprintf("Demo Error: Font alloc failed.\n");
+    else if (lseek(fd, 0, SEEK_SET) != 0 || read(fd, blob, size) != size)
+        rt_kprintf("Demo Error: Failed to read font asset %s\n", path);
     else
+        ok = font_parse(blob, size);
+    close(fd);
+
+    if (!ok)
+    {
+        rt_free(blob);
+        return false;
+    }
+    return true;
+}
+
+/* 文件系统中的资产优先 (覆盖)，否则原地使用固件内嵌的资产：不依赖文件系统挂载，也不拷贝 */
+static void load_font_asset(void)
+{
+    uint64_t t0 = demo_perf_now_us();
+
+    if (load_font_file(FONT_ASSET_PATH))
     {
-        rt_kprintf("Demo Error: Font CMA alloc failed.\n");
+        rt_kprintf("Demo: High-res font loaded from %s (height %d, %d glyphs, %u us)\n", FONT_ASSET_PATH,
+                   g_perf.font_height, g_perf.char_count, (uint32_t)(demo_perf_now_us() - t0));
+        return;
     }
 
-    close(fd);
+#ifdef AIC_GE_DEMO_FONT_EMBED
+    if (font_parse(__start_FontTab, __stop_FontTab - __start_FontTab))
+    {
+        rt_kprintf("Demo: High-res font embedded (height %d, %d glyphs, %u us)\n", g_perf.font_height,
+                   g_perf.char_count, (uint32_t)(demo_perf_now_us() - t0));
+    }
+#endif
 }
 
 void demo_perf_init(void)
@@ -89,8 +276,15 @@ void demo_perf_init(void)
     rt_memset(&g_perf, 0, sizeof(g_perf));
     g_perf.last_tick        = rt_tick_get();
     g_perf.last_report_tick = g_perf.last_tick;
+    g_perf.cycles_per_us    = PERF_CYCLES_PER_US;
+    g_perf.calib_cycles     = perf_cycles();
+    g_perf.effect_idx       = -1;
+
+    if (!g_effect_lock)
+        g_effect_lock = rt_mutex_create("perf", RT_IPC_FLAG_PRIO);
 
     load_font_asset();
+    perf_osd_refresh();
 }
 
 void demo_perf_update(void)
@@ -112,9 +306,290 @@ void demo_perf_update(void)
         g_perf.cpu_usage = 0.0f;
 #endif
         rt_memory_info(&g_perf.mem_total, &g_perf.mem_used, RT_NULL);
+
+#if PERF_CALIBRATE
+        /* 以系统节拍为基准校准 cycle 频率 (DVFS 或配置差异时保持准确) */
+        uint64_t cycles  = perf_cycles();
+        uint64_t elapsed = (uint64_t)delta * 1000000 / RT_TICK_PER_SECOND;
+        if (elapsed && cycles > g_perf.calib_cycles)
+            g_perf.cycles_per_us = MAX(1, (uint32_t)((cycles - g_perf.calib_cycles) / elapsed));
+        g_perf.calib_cycles = cycles;
+#endif
+
+        for (int i = 0; i < DEMO_PHASE_NUM; i++)
+            demo_perf_phase_stat(&g_perf.hist[i], &g_perf.osd_stat[i]);
+
+        perf_osd_refresh();
     }
 }
 
+/* --- [Phase Timer] 阶段计时与直方图 --- */
+
+/* 耗时 (us) -> 桶序号：< 16us 线性，其后每倍程 8 个桶 (相对误差 < 6.25%) */
+static int hist_bin(uint32_t us)
+{
+    if (us < DEMO_HIST_LINEAR)
+        return us;
+    int octave = 31 - __builtin_clz(us); /* >= 4 */
+    int bin    = DEMO_HIST_LINEAR + (octave - 4) * DEMO_HIST_SUB + ((us >> (octave - 3)) & (DEMO_HIST_SUB - 1));
+    return MIN(bin, DEMO_HIST_BINS - 1);
+}
+
+/* 桶序号 -> 桶中点 (us) */
+static uint32_t hist_value(int bin)
+{
+    if (bin < DEMO_HIST_LINEAR)
+        return bin;
+    int      octave = 4 + (bin - DEMO_HIST_LINEAR) / DEMO_HIST_SUB;
+    int      sub    = (bin - DEMO_HIST_LINEAR) % DEMO_HIST_SUB;
+    uint32_t width  = 1u << (octave - 3);
+    return (DEMO_HIST_SUB + sub) * width + width / 2;
+}
+
+static void hist_add(struct demo_phase_hist *hist, uint32_t us)
+{
+    hist->bins[hist_bin(us)]++;
+    hist->count++;
+    hist->sum_us += us;
+    if (us > hist->max_us)
+        hist->max_us = us;
+}
+
+static uint32_t hist_percentile(const struct demo_phase_hist *hist, int pct)
+{
+    uint32_t target = (uint32_t)(((uint64_t)hist->count * pct + 99) / 100);
+    uint32_t acc    = 0;
+    for (int i = 0; i < DEMO_HIST_BINS; i++)
+    {
+        acc += hist->bins[i];
+        if (acc >= target)
+            return MIN(hist_value(i), hist->max_us);
+    }
+    return hist->max_us;
+}
+
+void demo_perf_phase_stat(const struct demo_phase_hist *hist, struct demo_phase_stat *stat)
+{
+    rt_memset(stat, 0, sizeof(*stat));
+    if (hist->count == 0)
+        return;
+    stat->count = hist->count;
+    stat->mean  = (uint32_t)(hist->sum_us / hist->count);
+    stat->p50   = hist_percentile(hist, 50);
+    stat->p95   = hist_percentile(hist, 95);
+    stat->p99   = hist_percentile(hist, 99);
+    stat->max   = hist->max_us;
+}
+
+const struct demo_phase_hist *demo_perf_phase_hist(enum demo_phase phase)
+{
+    return &g_perf.hist[phase];
+}
+
+uint64_t demo_perf_now_us(void)
+{
+    return perf_cycles() / g_perf.cycles_per_us;
+}
+
+void demo_perf_phase_begin(enum demo_phase phase)
+{
+    uint64_t now   = perf_cycles();
+    int      depth = g_perf.phase_depth;
+    int      cap   = (int)(sizeof(g_perf.phase_stack) / sizeof(g_perf.phase_stack[0]));
+
+    /* 外层阶段暂停计时 */
+    if (depth > 0 && depth <= cap)
+        g_perf.frame_cycles[g_perf.phase_stack[depth - 1]] += now - g_perf.phase_start;
+
+    /* 超出嵌套深度的阶段不计时，但仍需与 end 配对 */
+    if (depth < cap)
+    {
+        g_perf.phase_stack[depth]  = (int8_t)phase;
+        g_perf.frame_hits         |= 1u << phase;
+    }
+    g_perf.phase_depth = depth + 1;
+    g_perf.phase_start = now;
+}
+
+void demo_perf_phase_end(void)
+{
+    uint64_t now   = perf_cycles();
+    int      depth = g_perf.phase_depth;
+    int      cap   = (int)(sizeof(g_perf.phase_stack) / sizeof(g_perf.phase_stack[0]));
+
+    if (depth == 0)
+        return;
+    if (depth <= cap)
+        g_perf.frame_cycles[g_perf.phase_stack[depth - 1]] += now - g_perf.phase_start;
+    g_perf.phase_depth = depth - 1;
+    g_perf.phase_start = now;
+}
+
+static void perf_list_lock(void)
+{
+    if (g_effect_lock)
+        rt_mutex_take(g_effect_lock, RT_WAITING_FOREVER);
+}
+
+static void perf_list_unlock(void)
+{
+    if (g_effect_lock)
+        rt_mutex_release(g_effect_lock);
+}
+
+/* 执行 msh 线程请求的清零 (仅渲染线程调用) */
+static void perf_apply_reset(void)
+{
+    if (!g_perf_reset_req)
+        return;
+
+    perf_list_lock();
+    while (g_effect_stats)
+    {
+        struct perf_effect_node *next = g_effect_stats->next;
+        rt_free(g_effect_stats);
+        g_effect_stats = next;
+    }
+    perf_list_unlock();
+
+    rt_memset(g_perf.hist, 0, sizeof(g_perf.hist));
+    g_perf_reset_req = false;
+}
+
+void demo_perf_frame_end(void)
+{
+    uint64_t now = perf_cycles();
+
+    perf_apply_reset();
+
+    if (g_perf.frame_start)
+    {
+        g_perf.frame_cycles[DEMO_PHASE_FRAME]  = now - g_perf.frame_start;
+        g_perf.frame_hits                     |= 1u << DEMO_PHASE_FRAME;
+    }
+    g_perf.frame_start = now;
+
+    for (int i = 0; i < DEMO_PHASE_NUM; i++)
+    {
+        if (g_perf.frame_hits & (1u << i))
+            hist_add(&g_perf.hist[i], (uint32_t)(g_perf.frame_cycles[i] / g_perf.cycles_per_us));
+        g_perf.frame_cycles[i] = 0;
+    }
+    g_perf.frame_hits = 0;
+}
+
+/* 瓶颈阶段：p95 最大的帧内阶段 */
+static int perf_bound_phase(const struct demo_phase_stat *stat)
+{
+    int bound = DEMO_PHASE_COMPUTE;
+    for (int i = DEMO_PHASE_COMPUTE; i < DEMO_PHASE_FRAME; i++)
+    {
+        if (stat[i].p95 > stat[bound].p95)
+            bound = i;
+    }
+    return bound;
+}
+
+/* 格式化第 line 行的状态文字 */
+static void perf_osd_text(int line, char *buf, size_t len)
+{
+    switch (line)
+    {
+    case 0: /* FPS */
+        rt_snprintf(buf, len, "FPS: %d.%d", (int)g_perf.fps, (int)(g_perf.fps * 10) % 10);
+        break;
+    case 1: /* CPU 占比 */
+        rt_snprintf(buf, len, "CPU: %d%%", (int)g_perf.cpu_usage);
+        break;
+    case 2: /* RAM 消耗 */
+        rt_snprintf(buf, len, "RAM: %d/%d KB", (int)(g_perf.mem_used / 1024), (int)(g_perf.mem_total / 1024));
+        break;
+    default: /* 当前瓶颈阶段及其 p95 */
+    {
+        int      bound = perf_bound_phase(g_perf.osd_stat);
+        uint32_t p95   = g_perf.osd_stat[bound].p95;
+        rt_snprintf(buf, len, "%s: %d.%dms", g_phase_names[bound], (int)(p95 / 1000), (int)(p95 % 1000) / 100);
+        break;
+    }
+    }
+}
+
+/* 重新格式化 OSD 文字 (统计刷新或切换特效时)，内容变化时递增 osd_gen */
+static void perf_osd_refresh(void)
+{
+    char buf[DEMO_OSD_TEXT_LEN];
+    bool changed = false;
+
+    for (int i = 0; i < PERF_OSD_LINES; i++)
+    {
+        perf_osd_text(i, buf, sizeof(buf));
+        if (strcmp(buf, g_perf.osd_text[i]) != 0)
+        {
+            strcpy(g_perf.osd_text[i], buf);
+            changed = true;
+        }
+    }
+    if (changed)
+        g_perf.osd_gen++;
+}
+
+/* 保存当前特效的摘要 (同一特效再次访问时覆盖为最近一次的数据) */
+static void perf_save_effect(void)
+{
+    if (g_perf.effect_idx < 0 || g_perf.hist[DEMO_PHASE_FRAME].count == 0)
+        return;
+
+    struct demo_phase_stat stat[DEMO_PHASE_NUM];
+    for (int i = 0; i < DEMO_PHASE_NUM; i++)
+        demo_perf_phase_stat(&g_perf.hist[i], &stat[i]);
+
+    /* 只有本线程修改链表，查找无需加锁 */
+    struct perf_effect_node **link = &g_effect_stats;
+    while (*link && (*link)->index < g_perf.effect_idx)
+        link = &(*link)->next;
+
+    struct perf_effect_node *node = *link;
+    if (node && node->index == g_perf.effect_idx)
+    {
+        perf_list_lock();
+        node->name = g_perf.effect_name;
+        rt_memcpy(node->stat, stat, sizeof(stat));
+        perf_list_unlock();
+        return;
+    }
+
+    /* 新节点先填写完整再链入，打印线程不会看到未初始化的字段 */
+    node = rt_malloc(sizeof(*node));
+    if (!node)
+        return;
+    node->next  = *link;
+    node->index = g_perf.effect_idx;
+    node->name  = g_perf.effect_name;
+    rt_memcpy(node->stat, stat, sizeof(stat));
+
+    perf_list_lock();
+    *link = node;
+    perf_list_unlock();
+}
+
+void demo_perf_effect_begin(int index, const char *name)
+{
+    perf_apply_reset();
+    perf_save_effect();
+
+    rt_memset(g_perf.hist, 0, sizeof(g_perf.hist));
+    rt_memset(g_perf.osd_stat, 0, sizeof(g_perf.osd_stat));
+    rt_memset(g_perf.frame_cycles, 0, sizeof(g_perf.frame_cycles));
+    g_perf.frame_hits  = 0;
+    g_perf.effect_idx  = index;
+    g_perf.effect_name = name;
+    perf_osd_refresh(); /* 瓶颈阶段行随统计一同清零 */
+
+    /* 首帧从此刻起算，切换与 init 的耗时不计入帧间隔 */
+    g_perf.frame_start = perf_cycles();
+    g_perf.phase_start = g_perf.frame_start;
+}
+
 static inline void update_dirty_region(int x, int y, int w, int h)
 {
     if (g_perf.dirty_w == 0 || g_perf.dirty_h == 0)
@@ -146,121 +621,417 @@ static inline void update_dirty_region(int x, int y, int w, int h)
     }
 }
 
-static inline void draw_pixel(uint8_t *fb_vir, int stride, int format, int x, int y, uint32_t color, int buf_w,
-                              int buf_h)
+/*
+ * [Font v2] 行程填充：每种像素格式一个内层循环，按字符串选择一次，
+ * 行程内不再有逐像素的格式分支与边界判断 (裁剪在行程级完成)。
+ */
+typedef void (*font_span_fn)(uint8_t *row, int x, int len, uint32_t color);
+
+static void font_span_565(uint8_t *row, int x, int len, uint32_t color)
+{
+    uint16_t *p = (uint16_t *)row + x;
+    while (len--)
+        *p++ = (uint16_t)color;
+}
+
+static void font_span_888(uint8_t *row, int x, int len, uint32_t color)
+{
+    uint8_t *p = row + x * 3;
+    while (len--)
+    {
+        p[0] = color & 0xFF;         /* B */
+        p[1] = (color >> 8) & 0xFF;  /* G */
+        p[2] = (color >> 16) & 0xFF; /* R */
+        p += 3;
+    }
+}
+
+static void font_span_8888(uint8_t *row, int x, int len, uint32_t color)
 {
+    uint32_t *p = (uint32_t *)row + x;
+    while (len--)
+        *p++ = color;
+}
+
+static font_span_fn font_span_select(int format)
+{
+    if (format == MPP_FMT_RGB_565)
+        return font_span_565;
+    if (format == MPP_FMT_RGB_888)
+        return font_span_888;
+    if (format == MPP_FMT_ARGB_8888 || format == MPP_FMT_XRGB_8888)
+        return font_span_8888;
+    return RT_NULL;
+}
+
+static inline const struct font_glyph *font_glyph(char c)
+{
+    int i = (unsigned char)c - g_perf.font_first;
+    if (!g_perf.font_data || i < 0 || i >= g_perf.char_count)
+        return RT_NULL;
+    return &g_perf.font_glyphs[i];
+}
+
+/* 行程渲染器：(x, y) 为笔位置 (行顶)，位图按 bearing 偏移 */
+static void draw_glyph_spans(uint8_t *fb_vir, int stride, font_span_fn fill, int x, int y,
+                             const struct font_glyph *g, uint32_t color, int buf_w, int buf_h)
+{
+    const struct font_span *s = &g_perf.font_spans[g->span_first];
+
+    x += g->bearing;
+    update_dirty_region(x, y, g->width, g_perf.font_height);
+
     /* [STRICT BOUNDARY] 绝不跨出微型 Buffer 边界 */
-    if (x >= 0 && x < buf_w && y >= 0 && y < buf_h)
+    for (int n = g->span_num; n > 0; n--, s++)
     {
-        if (format == MPP_FMT_RGB_565)
-        {
-            uint16_t *p = (uint16_t *)(fb_vir + y * stride + x * 2);
-            *p          = (uint16_t)color;
-        }
-        else if (format == MPP_FMT_RGB_888)
+        int py = y + s->y;
+        int x0 = MAX(x + s->x, 0);
+        int x1 = MIN(x + s->x + s->len, buf_w);
+        if (py >= 0 && py < buf_h && x0 < x1)
+            fill(fb_vir + py * stride, x0, x1 - x0, color);
+    }
+}
+
+/* 绘制高清字符串（带阴影增强对比度） */
+static int draw_string_highres(uint8_t *fb_vir, int stride, int format, int x, int y, const char *str, uint32_t color,
+                               int buf_w, int buf_h)
+{
+    font_span_fn fill = font_span_select(format);
+    int          pen  = x;
+
+    if (!fill)
+        return 0;
+
+    /* 1. 绘制阴影 (偏移 2 像素) */
+    for (const char *p = str; *p; p++)
+    {
+        const struct font_glyph *g = font_glyph(*p);
+        if (g)
         {
-            uint8_t *p = fb_vir + y * stride + x * 3;
-            p[0]       = color & 0xFF;         /* B */
-            p[1]       = (color >> 8) & 0xFF;  /* G */
-            p[2]       = (color >> 16) & 0xFF; /* R */
+            draw_glyph_spans(fb_vir, stride, fill, pen + 2, y + 2, g, 0x00000000, buf_w, buf_h);
+            pen += g->advance;
         }
-        else if (format == MPP_FMT_ARGB_8888 || format == MPP_FMT_XRGB_8888)
+    }
+
+    /* 2. 绘制主体文字 */
+    pen = x;
+    for (const char *p = str; *p; p++)
+    {
+        const struct font_glyph *g = font_glyph(*p);
+        if (g)
         {
-            uint32_t *p = (uint32_t *)(fb_vir + y * stride + x * 4);
-            *p          = color;
+            draw_glyph_spans(fb_vir, stride, fill, pen, y, g, color, buf_w, buf_h);
+            pen += g->advance;
         }
     }
+
+    return pen - x;
 }
 
-/* 高效 Bit-Blit 渲染器 */
-static void draw_char_bitblit(uint8_t *fb_vir, int stride, int format, int x, int y, char c, uint32_t color, int buf_w,
-                              int buf_h)
+/* --- [GE OSD] 字形图集与文字面板 --- */
+
+#ifdef AIC_GE_DEMO_GE_OSD
+
+/*
+ * 字形在载入后按面板格式光栅化一次，放入 CMA 图集 (黑底青字)。
+ * 每帧先用 GE 将字形从图集拷入文字面板，再以色键 (黑色透明) 把面板合成到目标：
+ * 叠加模式下阴影一遍以 DST_OUT 将字形覆盖处清为黑色，主体一遍直接覆盖，
+ * 与逐像素绘制 "先全部阴影、后全部主体" 的结果一致。
+ */
+#define OSD_PANEL_W 320 /* 面板宽度，超出部分截断 */
+#define OSD_GLYPHS  96  /* 可打印 ASCII */
+
+struct osd_glyph
 {
-    if (!g_perf.font_data || c < 32 || (c - 32) >= g_perf.char_count)
-        return;
+    uint16_t x;
+    uint16_t y;
+    uint8_t  w;
+};
+
+static struct
+{
+    bool             ready;  /* 图集与面板已构建 */
+    bool             failed; /* 构建失败，退回 CPU 绘制 */
+    int              format; /* 图集与面板的像素格式 */
+    int              bpp;
+    struct osd_glyph glyph[OSD_GLYPHS];
+    struct mpp_buf   atlas;
+    struct mpp_buf   panel;
+    char             text[PERF_OSD_LINES][DEMO_OSD_TEXT_LEN]; /* 面板中已渲染的文字 */
+    int              line_w[PERF_OSD_LINES];                  /* 各行像素宽度 (截断前) */
+} g_osd;
+
+static int osd_fmt_bpp(int format)
+{
+    if (format == MPP_FMT_RGB_565)
+        return 2;
+    if (format == MPP_FMT_RGB_888)
+        return 3;
+    return 4;
+}
 
-    uint32_t header_size = 8 + (g_perf.char_count * 4);
-    uint32_t offset      = g_perf.offsets[c - 32] - header_size;
-    uint8_t *data_ptr    = &g_perf.font_data[offset];
+static uint32_t osd_cyan(int format)
+{
+    if (format == MPP_FMT_RGB_565)
+        return 0x07FF;
+    if (format == MPP_FMT_RGB_888)
+        return 0x00FFFF;
+    return 0xFF00FFFF;
+}
 
-    uint8_t width  = *data_ptr++;
-    int     height = g_perf.font_height;
+static bool osd_buf_alloc(struct mpp_buf *buf, int w, int h, int format)
+{
+    int    stride = w * g_osd.bpp;
+    size_t size   = DEMO_ALIGN_SIZE(stride * h);
+
+    unsigned int phy = mpp_phy_alloc(size);
+    if (!phy)
+        return false;
 
-    update_dirty_region(x, y, width, height);
+    memset(buf, 0, sizeof(*buf));
+    buf->buf_type    = MPP_PHY_ADDR;
+    buf->phy_addr[0] = phy;
+    buf->stride[0]   = stride;
+    buf->size.width  = w;
+    buf->size.height = h;
+    buf->format      = format;
 
-    int bit_idx = 0;
-    for (int row = 0; row < height; row++)
+    memset((void *)(unsigned long)phy, 0, size);
+    aicos_dcache_clean_range((void *)(unsigned long)phy, size);
+    return true;
+}
+
+/* 在渲染线程中首次绘制时构建：图集按面板格式光栅化全部字形 */
+static bool osd_atlas_build(int format)
+{
+    int count = MIN(g_perf.char_count, OSD_GLYPHS);
+    int x = 0, y = 0;
+
+    g_osd.bpp = osd_fmt_bpp(format);
+
+    /* 1. 排布：逐行放置，行满换行 */
+    for (int i = 0; i < count; i++)
     {
-        for (int col = 0; col < width; col++)
+        uint8_t w = g_perf.font_glyphs[i].width;
+        if (x + w > OSD_ATLAS_W)
+        {
+            x = 0;
+            y += g_perf.font_height;
+        }
+        g_osd.glyph[i] = (struct osd_glyph){x, y, w};
+        x += w;
+    }
+
+    int panel_h = (PERF_OSD_LINES - 1) * (g_perf.font_height + 4) + g_perf.font_height;
+    if (!osd_buf_alloc(&g_osd.atlas, OSD_ATLAS_W, y + g_perf.font_height, format))
+        return false;
+    if (!osd_buf_alloc(&g_osd.panel, OSD_PANEL_W, panel_h, format))
+    {
+        mpp_phy_free(g_osd.atlas.phy_addr[0]);
+        return false;
+    }
+
+    /* 2. 光栅化 (仅此一次)：有同格式的预展开像素时整行拷贝并着色，否则按行程填充 */
+    uint8_t     *vir    = (uint8_t *)(unsigned long)g_osd.atlas.phy_addr[0];
+    int          atl_h  = g_osd.atlas.size.height;
+    int          stride = g_osd.atlas.stride[0];
+    int          h      = g_perf.font_height;
+    uint32_t     cyan   = osd_cyan(format);
+    const void  *pix    = (g_osd.bpp == 2) ? g_perf.font_pix[0] : (g_osd.bpp == 4) ? g_perf.font_pix[1] : RT_NULL;
+    font_span_fn fill   = font_span_select(format);
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct font_glyph *g   = &g_perf.font_glyphs[i];
+        const struct osd_glyph  *dst = &g_osd.glyph[i];
+
+        if (!pix)
+        {
+            draw_glyph_spans(vir, stride, fill, dst->x - g->bearing, dst->y, g, cyan, OSD_ATLAS_W, atl_h);
+            continue;
+        }
+        for (int row = 0; row < h; row++)
         {
-            if (data_ptr[bit_idx >> 3] & (0x80 >> (bit_idx & 7)))
+            uint8_t *line = vir + (dst->y + row) * stride + dst->x * g_osd.bpp;
+            if (g_osd.bpp == 2)
+            {
+                const uint16_t *src = (const uint16_t *)pix + g->pix + row * g->width;
+                for (int col = 0; col < g->width; col++)
+                    ((uint16_t *)line)[col] = src[col] & cyan;
+            }
+            else
             {
-                draw_pixel(fb_vir, stride, format, x + col, y + row, color, buf_w, buf_h);
+                const uint32_t *src = (const uint32_t *)pix + g->pix + row * g->width;
+                for (int col = 0; col < g->width; col++)
+                    ((uint32_t *)line)[col] = src[col] & cyan;
             }
-            bit_idx++;
         }
     }
+    aicos_dcache_clean_range(vir, DEMO_ALIGN_SIZE(g_osd.atlas.stride[0] * atl_h));
+
+    rt_kprintf("Demo: OSD glyph atlas %dx%d, panel %dx%d (CMA)\n", OSD_ATLAS_W, atl_h, OSD_PANEL_W, panel_h);
+    return true;
 }
 
-/* 绘制高清字符串（带阴影增强对比度） */
-static int draw_string_highres(uint8_t *fb_vir, int stride, int format, int x, int y, const char *str, uint32_t color,
-                               int buf_w, int buf_h)
+bool demo_perf_osd_ge(int format)
 {
-    int         start_x = x;
-    const char *p       = str;
+    if (g_osd.ready)
+        return g_osd.format == format;
+    if (g_osd.failed || !g_perf.font_data)
+        return false;
 
-    /* 1. 绘制阴影 (偏移 2 像素) */
-    while (*p)
+    if (!osd_atlas_build(format))
     {
-        char c = *p++;
-        if (c < 32 || (c - 32) >= g_perf.char_count)
-            continue;
+        rt_kprintf("Demo Error: OSD atlas CMA alloc failed, drawing text on CPU.\n");
+        g_osd.failed = true;
+        return false;
+    }
+    g_osd.format = format;
+    g_osd.ready  = true;
+    return true;
+}
+
+/* 将一行字形从图集拷入面板，返回行宽 (像素) */
+static int osd_panel_line(struct mpp_ge *ge, int y, const char *str)
+{
+    struct ge_bitblt blt = {0};
+    blt.src_buf          = g_osd.atlas;
+    blt.dst_buf          = g_osd.panel;
+    blt.src_buf.crop_en  = 1;
+    blt.dst_buf.crop_en  = 1;
+    blt.ctrl.alpha_en    = 1;
+    blt.ctrl.ck_en       = 1; /* 黑色透明：负 bearing 的字形与前一字形重叠时不互相擦除 */
+    blt.ctrl.ck_value    = 0;
 
-        uint32_t header_size = 8 + (g_perf.char_count * 4);
-        uint32_t offset      = g_perf.offsets[c - 32] - header_size;
-        uint8_t  width       = g_perf.font_data[offset];
+    int pen = 0;
+    for (const char *p = str; *p; p++)
+    {
+        const struct font_glyph *fg = font_glyph(*p);
+        int                      c  = (unsigned char)*p - g_perf.font_first;
+        if (!fg || c >= OSD_GLYPHS)
+            continue;
 
-        draw_char_bitblit(fb_vir, stride, format, x + 2, y + 2, c, 0x00000000, buf_w, buf_h);
-        x += width;
+        /* 按 bearing 放置，左右两侧按面板宽度裁剪 */
+        const struct osd_glyph *g  = &g_osd.glyph[c];
+        int                     x  = pen + fg->bearing;
+        int                     sx = g->x + MAX(-x, 0);
+        int                     dx = MAX(x, 0);
+        int                     w  = MIN(g->x + g->w - sx, OSD_PANEL_W - dx);
+        if (w > 0)
+        {
+            blt.src_buf.crop = (struct mpp_rect){sx, g->y, w, g_perf.font_height};
+            blt.dst_buf.crop = (struct mpp_rect){dx, y, w, g_perf.font_height};
+            ge_batch_bitblt(ge, &blt);
+        }
+        pen += fg->advance;
     }
+    return pen;
+}
 
-    /* 2. 绘制主体文字 */
-    x = start_x;
-    p = str;
-    while (*p)
+/* 将面板合成到目标的 (x, y) 处，按目标尺寸裁剪 */
+static void osd_panel_blit(struct mpp_ge *ge, unsigned long phy_addr, int stride, int buf_w, int buf_h, int x, int y,
+                           const struct ge_ctrl *ctrl)
+{
+    int w = MIN(OSD_PANEL_W, buf_w - x);
+    int h = MIN(g_osd.panel.size.height, buf_h - y);
+    if (w <= 0 || h <= 0)
+        return;
+
+    struct ge_bitblt blt    = {0};
+    blt.src_buf             = g_osd.panel;
+    blt.src_buf.crop_en     = 1;
+    blt.src_buf.crop        = (struct mpp_rect){0, 0, w, h};
+    blt.dst_buf.buf_type    = MPP_PHY_ADDR;
+    blt.dst_buf.phy_addr[0] = phy_addr;
+    blt.dst_buf.stride[0]   = stride;
+    blt.dst_buf.size.width  = buf_w;
+    blt.dst_buf.size.height = buf_h;
+    blt.dst_buf.format      = g_osd.format;
+    blt.dst_buf.crop_en     = 1;
+    blt.dst_buf.crop        = (struct mpp_rect){x, y, w, h};
+    blt.ctrl                = *ctrl;
+    ge_batch_bitblt(ge, &blt);
+}
+
+void demo_perf_compose(struct demo_ctx *ctx, unsigned long phy_addr, int stride, int buf_w, int buf_h, bool overlay)
+{
+    int start_x = 32;
+    int start_y = 20;
+    int line_h  = g_perf.font_height + 4;
+
+    g_perf.dirty_x = 0;
+    g_perf.dirty_y = 0;
+    g_perf.dirty_w = 0;
+    g_perf.dirty_h = 0;
+
+    /* 1. 面板是保留的：只重建文字变化的行 (清空该行后逐字拷入) */
+    struct ge_fillrect fill = {0};
+    fill.type               = GE_NO_GRADIENT;
+    fill.start_color        = 0;
+    fill.dst_buf            = g_osd.panel;
+    fill.dst_buf.crop_en    = 1;
+    fill.ctrl.alpha_en      = 1;
+
+    for (int i = 0; i < PERF_OSD_LINES; i++)
     {
-        char c = *p++;
-        if (c < 32 || (c - 32) >= g_perf.char_count)
-            continue;
+        if (strcmp(g_osd.text[i], g_perf.osd_text[i]) != 0)
+        {
+            fill.dst_buf.crop = (struct mpp_rect){0, i * line_h, OSD_PANEL_W, g_perf.font_height};
+            ge_batch_fillrect(ctx->ge, &fill);
+            g_osd.line_w[i] = osd_panel_line(ctx->ge, i * line_h, g_perf.osd_text[i]);
+            strcpy(g_osd.text[i], g_perf.osd_text[i]);
+            g_perf.osd_renders++;
+        }
+        update_dirty_region(start_x, start_y + i * line_h, g_osd.line_w[i] + 2, g_perf.font_height + 2);
+    }
 
-        uint32_t header_size = 8 + (g_perf.char_count * 4);
-        uint32_t offset      = g_perf.offsets[c - 32] - header_size;
-        uint8_t  width       = g_perf.font_data[offset];
+    /* 2. 合成到目标 */
+    struct ge_ctrl ctrl = {0};
+    if (overlay)
+    {
+        /* 阴影：色键剔除背景，字形覆盖处按 DST_OUT 清为 0 (偏移 2 像素) */
+        ctrl.ck_en       = 1;
+        ctrl.ck_value    = 0;
+        ctrl.alpha_en    = 0;
+        ctrl.alpha_rules = GE_PD_DST_OUT;
+        osd_panel_blit(ctx->ge, phy_addr, stride, buf_w, buf_h, start_x + 2, start_y + 2, &ctrl);
 
-        draw_char_bitblit(fb_vir, stride, format, x, y, c, color, buf_w, buf_h);
-        x += width;
+        /* 主体：色键剔除背景，直接覆盖 */
+        ctrl.alpha_en    = 1;
+        ctrl.alpha_rules = GE_PD_NONE;
+        osd_panel_blit(ctx->ge, phy_addr, stride, buf_w, buf_h, start_x, start_y, &ctrl);
+    }
+    else
+    {
+        /* 独立图层底色即为 0，阴影与背景同色，整块覆盖即可 (同时擦除上一帧) */
+        ctrl.alpha_en = 1;
+        osd_panel_blit(ctx->ge, phy_addr, stride, buf_w, buf_h, start_x, start_y, &ctrl);
     }
+}
+
+#else
 
-    return x - start_x;
+bool demo_perf_osd_ge(int format)
+{
+    return false;
 }
 
+void demo_perf_compose(struct demo_ctx *ctx, unsigned long phy_addr, int stride, int buf_w, int buf_h, bool overlay)
+{
+}
+
+#endif /* AIC_GE_DEMO_GE_OSD */
+
 void demo_perf_draw(struct demo_ctx *ctx, unsigned long phy_addr, int stride, int format, int buf_w, int buf_h)
 {
-    char     buf[64];
     uint32_t color_cyan;
     uint8_t *fb_vir = (uint8_t *)phy_addr;
 
     /*
-     * [HYBRID] 只有在叠加模式 (Stride == ctx->info.stride) 时才需要 Invalidate，
-     * 以对冲 GE 引擎在背景层留下的 Cache 脏数据（防鬼影）。
-     * 在隔离模式下，Buffer 是私有的，无需此操作。
+     * [HYBRID] GE 等待与 Cache 维护由引擎按缓冲所有权完成 (ge_fence)：
+     * 叠加模式下调用前已取回 demo_perf_osd_band() 行带并 invalidate，
+     * 绘制完毕后由引擎按 demo_perf_osd_dirty() 的脏行 clean。
      */
-    if (stride == ctx->info.stride)
-    {
-        unsigned long inv_start = (unsigned long)fb_vir + 16 * stride;
-        unsigned long inv_size  = (g_perf.font_height * 4) * stride;
-        aicos_dcache_invalid_range((unsigned long *)inv_start, inv_size);
-    }
 
     /* 重置脏区域 */
     g_perf.dirty_x = 0;
@@ -276,37 +1047,87 @@ void demo_perf_draw(struct demo_ctx *ctx, unsigned long phy_addr, int stride, in
     else
         color_cyan = 0xFF00FFFF;
 
-    /*
-     * 确保 GE 硬件操作完全结束，防止 GPU 与 CPU 同时操作同一缓冲区导致撕裂。
-     * 虽然特效 draw 函数内部通常有 sync，但在此进行二次确认是稳定性的保障。
-     */
-    mpp_ge_sync(ctx->ge);
-
     int start_x = 32; /* 向右微调，避免贴边 */
     int start_y = 20;
     int line_h  = g_perf.font_height + 4;
 
-    /* FPS 渲染 */
-    rt_snprintf(buf, sizeof(buf), "FPS: %d.%d", (int)g_perf.fps, (int)(g_perf.fps * 10) % 10);
-    draw_string_highres(fb_vir, stride, format, start_x, start_y, buf, color_cyan, buf_w, buf_h);
+    /* FPS / CPU / RAM (以及瓶颈阶段) 逐行渲染，文字已在统计刷新时格式化 */
+    for (int i = 0; i < PERF_OSD_LINES; i++)
+    {
+        draw_string_highres(fb_vir, stride, format, start_x, start_y + line_h * i, g_perf.osd_text[i], color_cyan,
+                            buf_w, buf_h);
+    }
+    g_perf.osd_renders += PERF_OSD_LINES;
+}
+
+uint32_t demo_perf_osd_gen(void)
+{
+    return g_perf.osd_gen;
+}
+
+void demo_perf_osd_band(int *y, int *h)
+{
+    *y = 16;
+    *h = g_perf.font_height * (PERF_OSD_LINES + 1);
+}
 
-    /* CPU 占比渲染 */
-    rt_snprintf(buf, sizeof(buf), "CPU: %d%%", (int)g_perf.cpu_usage);
-    draw_string_highres(fb_vir, stride, format, start_x, start_y + line_h, buf, color_cyan, buf_w, buf_h);
+void demo_perf_osd_dirty(int *y, int *h)
+{
+    *y = g_perf.dirty_y;
+    *h = (g_perf.dirty_w > 0) ? g_perf.dirty_h : 0;
+}
 
-    /* RAM 消耗渲染 */
-    rt_snprintf(buf, sizeof(buf), "RAM: %d/%d KB", (int)(g_perf.mem_used / 1024), (int)(g_perf.mem_total / 1024));
-    draw_string_highres(fb_vir, stride, format, start_x, start_y + line_h * 2, buf, color_cyan, buf_w, buf_h);
+/* --- Shell 控制指令集 --- */
 
-    /*
-     * [OPTIMIZED FIX] 局部 D-Cache Flush
-     * 仅刷新受 OSD 影响的脏区域。
-     */
-    if (g_perf.dirty_w > 0 && g_perf.dirty_h > 0)
+static void perf_print_stats(const struct demo_phase_stat *stat)
+{
+    rt_kprintf("%-6s %8s %8s %8s %8s %8s %8s\n", "phase", "frames", "mean", "p50", "p95", "p99", "max");
+    for (int i = 0; i < DEMO_PHASE_NUM; i++)
+    {
+        const struct demo_phase_stat *st = &stat[i];
+        if (st->count == 0)
+            continue;
+        rt_kprintf("%-6s %8u %8u %8u %8u %8u %8u\n", g_phase_names[i], st->count, st->mean, st->p50, st->p95, st->p99,
+                   st->max);
+    }
+}
+
+/* demo_perf [reset]：打印当前特效的阶段耗时 (us) 与已访问特效的摘要 */
+static int cmd_demo_perf(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        /* 由渲染线程在下一帧末执行，避免与 hist_add / perf_save_effect 竞争 */
+        g_perf_reset_req = true;
+        return 0;
+    }
+
+    struct demo_phase_stat stat[DEMO_PHASE_NUM];
+    for (int i = 0; i < DEMO_PHASE_NUM; i++)
+        demo_perf_phase_stat(&g_perf.hist[i], &stat[i]);
+
+    rt_kprintf("--- Phase Timing [%d] %s (us, %u cycles/us) ---\n", g_perf.effect_idx,
+               g_perf.effect_name ? g_perf.effect_name : "-", g_perf.cycles_per_us);
+    perf_print_stats(stat);
+    rt_kprintf("OSD: %u text updates, %u line renders\n", g_perf.osd_gen, g_perf.osd_renders);
+
+    perf_list_lock();
+    if (!g_effect_stats)
+    {
+        perf_list_unlock();
+        return 0;
+    }
+
+    rt_kprintf("--- Visited Effects (frame us / bound phase p95) ---\n");
+    rt_kprintf("%-4s %-32s %8s %8s %8s %6s %8s\n", "id", "name", "frames", "p50", "p99", "bound", "p95");
+    for (struct perf_effect_node *n = g_effect_stats; n; n = n->next)
     {
-        /* 刷新包含所有脏行的范围 */
-        unsigned long flush_start = (unsigned long)fb_vir + g_perf.dirty_y * stride;
-        unsigned long flush_size  = g_perf.dirty_h * stride;
-        aicos_dcache_clean_range((unsigned long *)flush_start, flush_size);
+        int                           bound = perf_bound_phase(n->stat);
+        const struct demo_phase_stat *f = &n->stat[DEMO_PHASE_FRAME];
+        rt_kprintf("%-4d %-32s %8u %8u %8u %6s %8u\n", n->index, n->name, f->count, f->p50, f->p99,
+                   g_phase_names[bound], n->stat[bound].p95);
     }
+    perf_list_unlock();
+    return 0;
 }
+MSH_CMD_EXPORT_ALIAS(cmd_demo_perf, demo_perf, Dump per-phase frame timing);
@@ -9,6 +9,57 @@
 
 #include "demo_engine.h"
 
+/*
+ * [Phase Timer] 帧内阶段划分
+ * 用于判断一帧的瓶颈位于 CPU 生成、Cache 维护、GE 提交、GE 等待、OSD 还是 VSync。
+ */
+enum demo_phase
+{
+    DEMO_PHASE_COMPUTE = 0, /* CPU 纹理生成 (传统 draw 中未细分的部分也计入此项) */
+    DEMO_PHASE_CACHE,       /* D-Cache clean / invalidate */
+    DEMO_PHASE_GE_SUBMIT,   /* GE 指令构建与 emit */
+    DEMO_PHASE_GE_SYNC,     /* 等待 GE 完成 */
+    DEMO_PHASE_OSD,         /* OSD 绘制 */
+    DEMO_PHASE_VSYNC,       /* 等待空闲帧缓冲 (受 VSync 节拍约束) */
+    DEMO_PHASE_FRAME,       /* 整帧间隔 (由 demo_perf_frame_end 统计) */
+    DEMO_PHASE_NUM,
+};
+
+/* 直方图：16 个 1us 线性桶 + 每倍程 8 个对数桶，覆盖 1us ~ 16s */
+#define DEMO_HIST_LINEAR  16
+#define DEMO_HIST_SUB     8
+#define DEMO_HIST_OCTAVES 20
+#define DEMO_HIST_BINS    (DEMO_HIST_LINEAR + DEMO_HIST_OCTAVES * DEMO_HIST_SUB)
+
+struct demo_phase_hist
+{
+    uint32_t bins[DEMO_HIST_BINS];
+    uint32_t count;  /* 样本数 (帧) */
+    uint64_t sum_us; /* 累计耗时 */
+    uint32_t max_us; /* 最大单帧耗时 */
+};
+
+/* 单个阶段的统计摘要 (单位 us) */
+struct demo_phase_stat
+{
+    uint32_t count;
+    uint32_t mean;
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max;
+};
+
+/* OSD 文字行 (上限) 与每行长度 */
+#define DEMO_OSD_LINES_MAX 4
+#define DEMO_OSD_TEXT_LEN  32
+
+/*
+ * [Font Embed] 将 v2 字体资产编译进固件的 "FontTab" 段，载入时原地使用。
+ * 由 fonts/font_conv.py --embed 生成 demo_font_data.c；文件系统中的资产 (FONT_ASSET_PATH) 优先。
+ */
+#define DEMO_FONT_EMBED(name) __attribute__((section("FontTab"), aligned(4), used)) static const uint8_t _font_##name[]
+
 /* 性能监控数据矩阵 */
 struct performance_matrix
 {
@@ -22,17 +73,40 @@ struct performance_matrix
     uint32_t  frame_count;
     rt_tick_t last_report_tick;
 
-    /* 字体资产句柄 */
-    uint8_t  *font_data;   /* 预渲染点阵数据 */
-    uint16_t  font_height; /* 字体全局高度 */
-    uint16_t  char_count;  /* 字符总数 */
-    uint32_t *offsets;     /* 字符偏移表 */
+    /* 字体资产句柄 (v2：逐行水平行程 + 度量，格式见 fonts/font_conv.py) */
+    const uint8_t           *font_data;     /* 资产文件整体 (内嵌段或文件副本) */
+    const struct font_glyph *font_glyphs;   /* 字形表 (char_count 项，自 font_first 起) */
+    const struct font_span  *font_spans;    /* 行程表 */
+    const void              *font_pix[2];   /* 预展开像素 (RGB565 / ARGB8888)，可为空 */
+    uint16_t                 font_height;   /* 字体全局高度 */
+    uint16_t                 font_baseline; /* 基线距行顶的像素数 */
+    uint16_t                 font_first;    /* 首字符编码 */
+    uint16_t                 char_count;    /* 字符总数 */
 
     /* 绘制脏区域记录：用于局部 Cache 刷新 */
     int dirty_x;
     int dirty_y;
     int dirty_w;
     int dirty_h;
+
+    /* [Retained OSD] 只在统计刷新时格式化文字，内容变化时 osd_gen 递增 */
+    char     osd_text[DEMO_OSD_LINES_MAX][DEMO_OSD_TEXT_LEN];
+    uint32_t osd_gen;
+    uint32_t osd_renders; /* 文字行光栅化次数 (CPU 绘制或面板重建) */
+
+    /* [Phase Timer] 高精度计时 */
+    uint32_t               cycles_per_us;                /* 计时源频率 (周期校准后更新) */
+    uint64_t               calib_cycles;                 /* 校准窗口起点 */
+    uint64_t               frame_start;                  /* 本帧起点 */
+    uint64_t               phase_start;                  /* 当前阶段起点 */
+    uint64_t               frame_cycles[DEMO_PHASE_NUM]; /* 本帧各阶段累计 */
+    uint32_t               frame_hits;                   /* 本帧出现过的阶段 (位掩码) */
+    int8_t                 phase_stack[4];               /* 阶段嵌套栈，内层计时时外层暂停 */
+    int                    phase_depth;
+    struct demo_phase_hist hist[DEMO_PHASE_NUM];     /* 当前特效的直方图 */
+    struct demo_phase_stat osd_stat[DEMO_PHASE_NUM]; /* 最近一次汇总 (供 OSD 显示) */
+    int                    effect_idx;               /* 当前特效序号 (-1 表示未开始) */
+    const char            *effect_name;
 };
 
 /**
@@ -55,4 +129,58 @@ void demo_perf_update(void);
  */
 void demo_perf_draw(struct demo_ctx *ctx, unsigned long phy_addr, int stride, int format, int buf_w, int buf_h);
 
+/*
+ * [GE OSD] 以 GE 合成 OSD (AIC_GE_DEMO_GE_OSD，仅限渲染线程)
+ * osd_ge:  按目标格式准备字形图集 (首次调用时构建)，不可用时返回 false，由调用方退回 demo_perf_draw
+ * compose: 只入队 GE 指令，不等待；目标须已移交 GE (ge_fence_ge_acquire)。
+ *          overlay 为 true 时带阴影叠加于画面，否则整块覆盖独立图层缓冲中的面板区域
+ */
+bool demo_perf_osd_ge(int format);
+void demo_perf_compose(struct demo_ctx *ctx, unsigned long phy_addr, int stride, int buf_w, int buf_h, bool overlay);
+
+/*
+ * OSD 行范围 (供引擎做所有权移交)
+ * osd_band:  叠加模式下 OSD 可能读写的行带，绘制前需取回并 invalidate
+ * osd_dirty: 上一次 demo_perf_draw 实际写过的行，h 为 0 表示未绘制
+ */
+void demo_perf_osd_band(int *y, int *h);
+void demo_perf_osd_dirty(int *y, int *h);
+
+/* OSD 文字代数：与上次绘制时相同则画面内容不变，独立图层可跳过整个 OSD */
+uint32_t demo_perf_osd_gen(void);
+
+/**
+ * [Phase Timer] 阶段计时 (仅限渲染线程调用)
+ * begin/end 必须成对出现，可嵌套：内层阶段计时期间外层阶段暂停，
+ * 因此特效可以在引擎计入 COMPUTE 的 draw() 内部进一步细分 GE/Cache 耗时。
+ */
+void demo_perf_phase_begin(enum demo_phase phase);
+void demo_perf_phase_end(void);
+
+/**
+ * 结束一帧：将本帧各阶段耗时计入直方图 (每帧调用一次)
+ */
+void demo_perf_frame_end(void);
+
+/**
+ * 切换统计对象：保存上一个特效的摘要并清空直方图
+ * index: 特效序号；name: 特效名称
+ */
+void demo_perf_effect_begin(int index, const char *name);
+
+/**
+ * 当前特效某阶段的直方图 (只读)
+ */
+const struct demo_phase_hist *demo_perf_phase_hist(enum demo_phase phase);
+
+/**
+ * 高精度时间戳 (us)，与阶段计时同源
+ */
+uint64_t demo_perf_now_us(void);
+
+/**
+ * 从直方图计算统计摘要
+ */
+void demo_perf_phase_stat(const struct demo_phase_hist *hist, struct demo_phase_stat *stat);
+
 #endif /* _DEMO_PERF_H_ */
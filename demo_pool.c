@@ -0,0 +1,215 @@
+/*
+ * Filename: demo_pool.c
+ * THE RESERVOIR
+ * 蓄水池
+ *
+ * 档位：尺寸先按 DEMO_ALIGN_SIZE 对齐，再向上取整到 "最高位 / 8" 的步长，
+ * 浪费不超过 12.5%，同时让 QVGA / VGA 各格式的纹理落入少数几个档位。
+ * 块的元数据存放在堆上，CMA 内存本身只交给 GE 与 CPU 使用。
+ */
+
+#include "demo_pool.h"
+#include "demo_bench.h"
+#include "mpp_mem.h"
+#include <string.h>
+
+#define POOL_CLASSES 24 /* 同时缓存的档位数上限 */
+
+struct pool_blk
+{
+    unsigned int     phy;
+    uint32_t         size; /* 档位尺寸 */
+    struct pool_blk *next;
+};
+
+struct pool_class
+{
+    uint32_t         size;
+    struct pool_blk *free;
+};
+
+static struct
+{
+    struct pool_class      cls[POOL_CLASSES];
+    struct pool_blk       *live; /* 借出中的块 */
+    struct demo_pool_stats stats;
+} g_pool;
+
+static uint32_t pool_class_size(size_t size)
+{
+    uint32_t s    = DEMO_ALIGN_SIZE((uint32_t)size);
+    uint32_t step = 64;
+
+    while ((step << 4) <= s)
+        step <<= 1;
+    return (s + step - 1) & ~(step - 1);
+}
+
+static struct pool_class *pool_find_class(uint32_t size, bool create)
+{
+    for (int i = 0; i < POOL_CLASSES; i++)
+    {
+        if (g_pool.cls[i].size == size)
+            return &g_pool.cls[i];
+    }
+    if (!create)
+        return NULL;
+    for (int i = 0; i < POOL_CLASSES; i++)
+    {
+        if (!g_pool.cls[i].free)
+        {
+            g_pool.cls[i].size = size;
+            return &g_pool.cls[i];
+        }
+    }
+    return NULL;
+}
+
+static void pool_track_live(struct pool_blk *blk)
+{
+    blk->next   = g_pool.live;
+    g_pool.live = blk;
+
+    g_pool.stats.live_bytes += blk->size;
+    g_pool.stats.live_peak  = MAX(g_pool.stats.live_peak, g_pool.stats.live_bytes);
+    g_pool.stats.total_peak = MAX(g_pool.stats.total_peak, g_pool.stats.live_bytes + g_pool.stats.cached_bytes);
+}
+
+unsigned int demo_pool_alloc(size_t size)
+{
+    uint32_t           csize = pool_class_size(size);
+    struct pool_class *cls   = pool_find_class(csize, false);
+
+    /* 1. 命中缓存 */
+    if (cls && cls->free)
+    {
+        struct pool_blk *blk = cls->free;
+        cls->free            = blk->next;
+        g_pool.stats.cached_bytes -= blk->size;
+        g_pool.stats.hits++;
+        pool_track_live(blk);
+        return blk->phy;
+    }
+
+    /* 2. 向 CMA 申请，失败时先清空缓存再试一次 (缓存的其他档位可能正占着连续空间) */
+    struct pool_blk *blk = rt_malloc(sizeof(*blk));
+    if (!blk)
+        return 0;
+
+    unsigned int phy = mpp_phy_alloc(csize);
+    if (!phy && g_pool.stats.cached_bytes)
+    {
+        g_pool.stats.trims++;
+        demo_pool_trim();
+        phy = mpp_phy_alloc(csize);
+    }
+    if (!phy)
+    {
+        g_pool.stats.failures++;
+        rt_free(blk);
+        return 0;
+    }
+
+    blk->phy  = phy;
+    blk->size = csize;
+    g_pool.stats.misses++;
+    pool_track_live(blk);
+    return phy;
+}
+
+unsigned int demo_pool_zalloc(size_t size)
+{
+    unsigned int phy = demo_pool_alloc(size);
+    if (phy)
+    {
+        uint32_t csize = pool_class_size(size);
+        memset((void *)(unsigned long)phy, 0, csize);
+        aicos_dcache_clean_range((void *)(unsigned long)phy, csize);
+    }
+    return phy;
+}
+
+void demo_pool_free(unsigned int phy)
+{
+    if (!phy)
+        return;
+
+    struct pool_blk **pp = &g_pool.live;
+    while (*pp && (*pp)->phy != phy)
+        pp = &(*pp)->next;
+
+    struct pool_blk *blk = *pp;
+    if (!blk)
+    {
+        /* 不是池借出的块 (如直接 mpp_phy_alloc 所得)，原样归还 */
+        rt_kprintf("Demo Pool: 0x%08x not from pool, freeing directly.\n", phy);
+        mpp_phy_free(phy);
+        return;
+    }
+    *pp = blk->next;
+    g_pool.stats.live_bytes -= blk->size;
+
+    /* 超出缓存上限或档位表已满时直接归还 CMA */
+    struct pool_class *cls = NULL;
+    if (g_pool.stats.cached_bytes + blk->size <= AIC_GE_DEMO_TEX_POOL_KB * 1024)
+        cls = pool_find_class(blk->size, true);
+    if (!cls)
+    {
+        mpp_phy_free(blk->phy);
+        rt_free(blk);
+        return;
+    }
+
+    blk->next = cls->free;
+    cls->free = blk;
+    g_pool.stats.cached_bytes += blk->size;
+}
+
+void demo_pool_trim(void)
+{
+    for (int i = 0; i < POOL_CLASSES; i++)
+    {
+        struct pool_class *cls = &g_pool.cls[i];
+        while (cls->free)
+        {
+            struct pool_blk *blk = cls->free;
+            cls->free            = blk->next;
+            mpp_phy_free(blk->phy);
+            rt_free(blk);
+        }
+    }
+    g_pool.stats.cached_bytes = 0;
+}
+
+const struct demo_pool_stats *demo_pool_get_stats(void)
+{
+    return &g_pool.stats;
+}
+
+/* demo_bench 的 CMA 用量：特效与引擎纹理均经池借出，借出中的字节即特效占用的 CMA (缓存块不属于任何特效) */
+long demo_cma_used(void)
+{
+    return (long)g_pool.stats.live_bytes;
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_pool(int argc, char **argv)
+{
+    const struct demo_pool_stats *st = &g_pool.stats;
+
+    rt_kprintf("--- Texture Pool (cap %d KB) ---\n", AIC_GE_DEMO_TEX_POOL_KB);
+    rt_kprintf("live %u KB (peak %u KB), cached %u KB, high-water %u KB\n", st->live_bytes / 1024,
+               st->live_peak / 1024, st->cached_bytes / 1024, st->total_peak / 1024);
+    rt_kprintf("hits %u, misses %u, trims %u, failures %u\n", st->hits, st->misses, st->trims, st->failures);
+    for (int i = 0; i < POOL_CLASSES; i++)
+    {
+        int n = 0;
+        for (struct pool_blk *b = g_pool.cls[i].free; b; b = b->next)
+            n++;
+        if (n)
+            rt_kprintf("  class %7u B: %d free\n", g_pool.cls[i].size, n);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_pool, demo_pool, Show texture pool stats);
@@ -0,0 +1,49 @@
+/*
+ * Filename: demo_pool.h
+ * THE RESERVOIR
+ * 蓄水池
+ *
+ * 引擎托管的 CMA 纹理池：特效在 init 中借出、在 deinit 中归还，
+ * 归还的块按尺寸档位缓存，供下一个特效直接复用，避免长时间轮播时反复
+ * mpp_phy_alloc / mpp_phy_free 造成的 CMA 碎片与切换卡顿。
+ */
+
+#ifndef _DEMO_POOL_H_
+#define _DEMO_POOL_H_
+
+#include "demo_engine.h"
+
+/* 池中缓存的空闲块总量上限 (KB)，超出部分直接归还 CMA */
+#ifndef AIC_GE_DEMO_TEX_POOL_KB
+#define AIC_GE_DEMO_TEX_POOL_KB 1024
+#endif
+
+struct demo_pool_stats
+{
+    uint32_t live_bytes;   /* 借出中的字节 (按档位尺寸计) */
+    uint32_t live_peak;    /* 借出量峰值 */
+    uint32_t cached_bytes; /* 池中空闲的字节 */
+    uint32_t total_peak;   /* 借出 + 缓存的峰值，即池占用的 CMA 高水位 */
+    uint32_t hits;         /* 由缓存满足的申请 */
+    uint32_t misses;       /* 向 CMA 新申请的次数 */
+    uint32_t trims;        /* CMA 申请失败后清空缓存重试的次数 */
+    uint32_t failures;     /* 清空缓存后仍失败的次数 */
+};
+
+/*
+ * 借出一块至少 size 字节的 CMA 内存，返回物理地址 (失败返回 0)。
+ * alloc 的内容未初始化 (可能残留上一个使用者的数据)，zalloc 清零并 clean。
+ * 地址与长度均按 DEMO_ALIGN_SIZE 对齐。仅限渲染线程调用。
+ */
+unsigned int demo_pool_alloc(size_t size);
+unsigned int demo_pool_zalloc(size_t size);
+
+/* 归还 (phy 为 0 时忽略)；调用者须保证 GE 不再访问该块 */
+void demo_pool_free(unsigned int phy);
+
+/* 将池中所有空闲块归还 CMA */
+void demo_pool_trim(void);
+
+const struct demo_pool_stats *demo_pool_get_stats(void);
+
+#endif /* _DEMO_POOL_H_ */
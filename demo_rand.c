@@ -0,0 +1,278 @@
+/*
+ * Filename: demo_rand.c
+ * THE DICE OF THE DEMIURGE
+ * 造物主的骰子
+ */
+
+#include "demo_rand.h"
+#include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_perf.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* --- 批量填充 --- */
+
+void demo_rand_fill(struct demo_rand *r, void *buf, size_t len)
+{
+    uint8_t *d = (uint8_t *)buf;
+
+    for (; len >= 4; len -= 4, d += 4)
+    {
+        uint32_t v = demo_rand_next(r);
+        memcpy(d, &v, 4);
+    }
+    if (len)
+    {
+        uint32_t v = demo_rand_next(r);
+        memcpy(d, &v, len);
+    }
+}
+
+void demo_rand_fill_mask(struct demo_rand *r, uint32_t *words, int n, int p)
+{
+    if (p <= 0 || p >= 256)
+    {
+        memset(words, p <= 0 ? 0 : 0xFF, (size_t)n * 4);
+        return;
+    }
+
+    /* 低于最低置位的各位只会与全零掩码相与，直接跳过 */
+    int lo = __builtin_ctz((unsigned int)p);
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t m = 0;
+        for (int b = lo; b < 8; b++)
+        {
+            uint32_t w = demo_rand_next(r);
+            m          = (p >> b) & 1 ? (m | w) : (m & w);
+        }
+        words[i] = m;
+    }
+}
+
+uint32_t demo_rand_mask16(struct demo_rand *r, uint32_t p16)
+{
+    uint32_t open = 0xFFFFFFFFu; /* 尚未分出大小的位 */
+    uint32_t m    = 0;
+
+    if (p16 == 0 || p16 >= 65536)
+        return p16 ? 0xFFFFFFFFu : 0;
+
+    /* 随机数 U 的第 b 位依次与 p16 的第 b 位比较：p 位为 1 而 U 位为 0 即 U < p (置 1)，反之即 U > p */
+    for (int b = 15; b >= 0 && open; b--)
+    {
+        uint32_t w = demo_rand_next(r);
+        if ((p16 >> b) & 1)
+        {
+            m |= open & ~w;
+            open &= w;
+        }
+        else
+        {
+            open &= ~w;
+        }
+    }
+    return m; /* 仍未分出的位即 U == p，不置位 */
+}
+
+/* --- 自检 --- */
+
+#define CHECK_N 65536
+
+static int check_range(void)
+{
+    static const uint32_t bound[] = {1, 2, 3, 7, 240, 320, 1000, 65537, 0xFFFFFFFFu};
+    struct demo_rand      r;
+    int                   ret = 0;
+
+    demo_rand_seed(&r, 0);
+    for (int k = 0; k < (int)(sizeof(bound) / sizeof(bound[0])); k++)
+    {
+        uint32_t hi = 0;
+        for (int i = 0; i < CHECK_N; i++)
+        {
+            uint32_t v = demo_rand_range(&r, bound[k]);
+            if (v >= bound[k])
+            {
+                rt_kprintf("range(%u) returned %u\n", bound[k], v);
+                return -1;
+            }
+            hi = MAX(hi, v);
+        }
+        /* 样本足够多时应取到上界附近 */
+        if (bound[k] <= 1000 && hi != bound[k] - 1)
+        {
+            rt_kprintf("range(%u) never reached %u (max %u)\n", bound[k], bound[k] - 1, hi);
+            ret = -1;
+        }
+    }
+
+    int lo = 0, hi = 0;
+    for (int i = 0; i < CHECK_N; i++)
+    {
+        int v = demo_rand_between(&r, -20, 19);
+        lo    = MIN(lo, v);
+        hi    = MAX(hi, v);
+    }
+    if (lo != -20 || hi != 19)
+    {
+        rt_kprintf("between(-20, 19) spans [%d, %d]\n", lo, hi);
+        ret = -1;
+    }
+    rt_kprintf("range / between: %s\n", ret ? "FAIL" : "ok");
+    return ret;
+}
+
+/* 均匀性：16 个桶的计数偏离期望不超过 5% */
+static int check_uniform(void)
+{
+    struct demo_rand r;
+    int              hist[16] = {0};
+    int              ret      = 0;
+
+    demo_rand_seed(&r, 1);
+    for (int i = 0; i < CHECK_N * 4; i++)
+        hist[demo_rand_bits(&r, 4)]++;
+    for (int i = 0; i < 16; i++)
+        if (ABS(hist[i] - CHECK_N / 4) > CHECK_N / 80)
+            ret = -1;
+
+    /* 相邻流的首个输出不应相关：统计最高位相同的比例 */
+    int same = 0;
+    for (uint32_t s = 0; s < 1024; s++)
+    {
+        struct demo_rand a, b;
+        demo_rand_seed(&a, s);
+        demo_rand_seed(&b, s + 1);
+        same += !((demo_rand_next(&a) ^ demo_rand_next(&b)) >> 31);
+    }
+    if (ABS(same - 512) > 80)
+        ret = -1;
+
+    rt_kprintf("uniformity: %s (adjacent streams agree %d/1024)\n", ret ? "FAIL" : "ok", same);
+    return ret;
+}
+
+static int check_mask(void)
+{
+    static const int p[] = {0, 1, 16, 77, 128, 200, 255, 256};
+    static uint32_t  words[256];
+    struct demo_rand r;
+    int              ret = 0;
+
+    demo_rand_seed(&r, 2);
+    for (int k = 0; k < (int)(sizeof(p) / sizeof(p[0])); k++)
+    {
+        int ones = 0;
+        demo_rand_fill_mask(&r, words, 256, p[k]);
+        for (int i = 0; i < 256; i++)
+            ones += __builtin_popcount(words[i]);
+
+        /* 8192 位：期望 32 * p，容差约 4 个标准差 */
+        int expect = 32 * p[k];
+        int tol    = 4 * (int)demo_isqrt((uint32_t)(expect * (256 - p[k]) / 256)) + 1;
+        if (ABS(ones - expect) > tol)
+        {
+            rt_kprintf("mask p=%d: %d ones, expected %d +- %d\n", p[k], ones, expect, tol);
+            ret = -1;
+        }
+    }
+
+    /* 稀疏掩码：262144 位，p16 取到 1/65536 的量级 */
+    static const uint32_t p16[] = {0, 1, 15, 300, 4096, 40000, 65535, 65536};
+    for (int k = 0; k < (int)(sizeof(p16) / sizeof(p16[0])); k++)
+    {
+        int ones = 0;
+        for (int i = 0; i < 8192; i++)
+            ones += __builtin_popcount(demo_rand_mask16(&r, p16[k]));
+
+        int expect = (int)(p16[k] * 4);
+        int tol    = 4 * (int)demo_isqrt((uint32_t)((uint64_t)expect * (65536 - p16[k]) / 65536)) + 1;
+        if (ABS(ones - expect) > tol)
+        {
+            rt_kprintf("mask16 p=%u: %d ones, expected %d +- %d\n", p16[k], ones, expect, tol);
+            ret = -1;
+        }
+    }
+
+    /* 同一种子两次填充逐位一致，尾部不足 4 字节时不越界 */
+    uint8_t a[67], b[68];
+    demo_rand_seed(&r, 3);
+    demo_rand_fill(&r, a, sizeof(a));
+    b[67] = 0xA5;
+    demo_rand_seed(&r, 3);
+    demo_rand_fill(&r, b, sizeof(a));
+    if (memcmp(a, b, sizeof(a)) || b[67] != 0xA5)
+        ret = -1;
+
+    rt_kprintf("fill / mask: %s\n", ret ? "FAIL" : "ok");
+    return ret;
+}
+
+/* --- 基准 (每次 QVGA 帧规模的随机数) --- */
+
+#define BENCH_N    (DEMO_QVGA_W * DEMO_QVGA_H)
+#define BENCH_REPS 8
+
+static volatile uint32_t g_bench_sink;
+
+static void rand_bench(void)
+{
+    static uint32_t  buf[BENCH_N / 32];
+    struct demo_rand r;
+    uint32_t         acc = 0;
+    uint64_t         t[7];
+
+    demo_rand_seed(&r, 4);
+    t[0] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        for (int i = 0; i < BENCH_N; i++)
+            acc += (uint32_t)(rand() % 3);
+    t[1] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        for (int i = 0; i < BENCH_N; i++)
+            acc += demo_rand_range(&r, 3);
+    t[2] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        for (int i = 0; i < BENCH_N; i++)
+            acc += demo_rand_next(&r);
+    t[3] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        demo_rand_fill(&r, buf, BENCH_N / 8);
+    t[4] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        demo_rand_fill_mask(&r, buf, BENCH_N / 32, 77);
+    t[5] = demo_perf_now_us();
+    for (int k = 0; k < BENCH_REPS; k++)
+        for (int i = 0; i < BENCH_N / 32; i++)
+            acc += demo_rand_mask16(&r, 15);
+    t[6] = demo_perf_now_us();
+    g_bench_sink = acc + buf[0];
+
+    rt_kprintf("%-16s %8s   %s\n", "kernel", "us", "(per QVGA frame)");
+    rt_kprintf("%-16s %8u\n", "rand() % 3", (uint32_t)((t[1] - t[0]) / BENCH_REPS));
+    rt_kprintf("%-16s %8u\n", "demo_rand_range", (uint32_t)((t[2] - t[1]) / BENCH_REPS));
+    rt_kprintf("%-16s %8u\n", "demo_rand_next", (uint32_t)((t[3] - t[2]) / BENCH_REPS));
+    rt_kprintf("%-16s %8u\n", "fill 1 bit/px", (uint32_t)((t[4] - t[3]) / BENCH_REPS));
+    rt_kprintf("%-16s %8u\n", "mask p=77/256", (uint32_t)((t[5] - t[4]) / BENCH_REPS));
+    rt_kprintf("%-16s %8u\n", "mask16 p=15", (uint32_t)((t[6] - t[5]) / BENCH_REPS));
+}
+
+/* --- Shell 控制指令集 --- */
+
+static int cmd_demo_rand(int argc, char **argv)
+{
+    int ret = 0;
+
+    rt_kprintf("--- demo_rand (xorshift32, seed %d) ---\n", AIC_GE_DEMO_RAND_SEED);
+    ret |= check_range();
+    ret |= check_uniform();
+    ret |= check_mask();
+    rt_kprintf("%s\n", ret ? "FAIL" : "PASS");
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        rand_bench();
+    return ret;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_rand, demo_rand, Check deterministic PRNG streams [bench]);
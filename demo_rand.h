@@ -0,0 +1,103 @@
+/*
+ * Filename: demo_rand.h
+ * THE DICE OF THE DEMIURGE
+ * 造物主的骰子
+ *
+ * 确定性伪随机流：每个特效持有自己的 xorshift32 状态 (4 字节)，由显式种子初始化，
+ * 取代热循环中的 libc rand() —— 后者在 newlib 上经过可重入结构与锁，逐像素调用开销可观，
+ * 且序列依赖于其他特效此前消耗了多少随机数，基准与黄金图像无法逐帧复现。
+ *
+ * 选用 xorshift32 而非 PCG：PCG32 的 64 位乘法在 RV32 上要展开为多条指令，
+ * 而 xorshift32 只有三次移位异或；其低位质量对画面噪声已足够。
+ * 有界取值用乘高位 ((u64)x * n >> 32) 代替取模，没有除法，取的也是质量更好的高位。
+ *
+ * 种子 = 特效自选的流编号 ^ AIC_GE_DEMO_RAND_SEED，经 32 位混合函数打散，
+ * 不同流 (即使编号相邻) 的序列互不相关。
+ */
+
+#ifndef _DEMO_RAND_H_
+#define _DEMO_RAND_H_
+
+#include "demo_utils.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* 全局种子：修改后所有特效的随机序列整体更换，保持不变则每次运行逐帧一致 */
+#ifndef AIC_GE_DEMO_RAND_SEED
+#define AIC_GE_DEMO_RAND_SEED 1
+#endif
+
+struct demo_rand
+{
+    uint32_t s; /* 非零 */
+};
+
+/* --- 播种 --- */
+
+static inline void demo_rand_seed(struct demo_rand *r, uint32_t stream)
+{
+    /* murmur3 fmix32：双射，只有 0 映射到 0 */
+    uint32_t h = stream ^ (uint32_t)AIC_GE_DEMO_RAND_SEED;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    r->s = h ? h : 0x9E3779B9u;
+}
+
+/* --- 取值 --- */
+
+/* 32 位均匀随机数 (周期 2^32 - 1) */
+static inline uint32_t demo_rand_next(struct demo_rand *r)
+{
+    uint32_t x = r->s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    r->s = x;
+    return x;
+}
+
+/* [0, n)，n 不超过 2^32 - 1；偏差不超过 n / 2^32 */
+static inline uint32_t demo_rand_range(struct demo_rand *r, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)demo_rand_next(r) * n) >> 32);
+}
+
+/* [lo, hi] 闭区间 */
+static inline int demo_rand_between(struct demo_rand *r, int lo, int hi)
+{
+    return lo + (int)demo_rand_range(r, (uint32_t)(hi - lo + 1));
+}
+
+/* 高 k 位 (1 <= k <= 32) */
+static inline uint32_t demo_rand_bits(struct demo_rand *r, int k)
+{
+    return demo_rand_next(r) >> (32 - k);
+}
+
+/* 把已取得的 16 位随机数映射到 [0, n)，用于一次 next 拆成多个字段 */
+static inline uint32_t demo_rand_scale16(uint32_t v16, uint32_t n)
+{
+    return (v16 * n) >> 16;
+}
+
+/* --- 批量填充 --- */
+
+/* 填充 len 字节随机数据 (每次 next 产出 4 字节) */
+void demo_rand_fill(struct demo_rand *r, void *buf, size_t len);
+
+/*
+ * 填充 n 个 32 位掩码字，每一位独立地以 p / 256 的概率置 1 (0 <= p <= 256)。
+ * 按 p 的二进制位由低到高逐次与 / 或一个随机字，每字最多 8 次 next，与位数无关。
+ */
+void demo_rand_fill_mask(struct demo_rand *r, uint32_t *words, int n, int p);
+
+/*
+ * 单个 32 位掩码字，每一位独立地以 p16 / 65536 的概率置 1 (0 <= p16 <= 65536)，用于突变等稀疏事件。
+ * 自高位向低位把随机位与 p16 逐位比较，全部 32 位都已分出大小即提前结束：p16 很小时平均约 6 次 next。
+ */
+uint32_t demo_rand_mask16(struct demo_rand *r, uint32_t p16);
+
+#endif /* _DEMO_RAND_H_ */
@@ -0,0 +1,357 @@
+/*
+ * Filename: demo_swar.c
+ * THE LOOM OF LANES
+ * 多道织机
+ *
+ * 整行版本的 RGB565 核心，以及与标量写法对照的自检与微基准
+ * (板上与主机 ./build/ge_demo_host demo_swar 均可运行)。
+ */
+
+#include "demo_swar.h"
+#include "demo_perf.h"
+#include "demo_rand.h"
+#include <string.h>
+
+#define PX_ALIGNED(p) (((uintptr_t)(p) & (sizeof(demo_pxw_t) - 1)) == 0)
+
+/* --- 整行版本 --- */
+
+void demo_px_add_sat_buf(uint16_t *dst, const uint16_t *src, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(dst); n--, dst++, src++)
+        *dst = (uint16_t)demo_px_add_sat(*dst, *src);
+
+    demo_pxw_t *w = (demo_pxw_t *)dst;
+    if (PX_ALIGNED(src))
+    {
+        const demo_pxw_t *s = (const demo_pxw_t *)src;
+        for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES, w++, s++)
+            *w = demo_px_add_sat(*w, *s);
+        src = (const uint16_t *)s;
+    }
+    dst = (uint16_t *)w;
+
+    for (; n > 0; n--, dst++, src++)
+        *dst = (uint16_t)demo_px_add_sat(*dst, *src);
+}
+
+void demo_px_sub_sat_buf(uint16_t *buf, uint16_t c, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(buf); n--, buf++)
+        *buf = (uint16_t)demo_px_sub_sat(*buf, c);
+
+    demo_pxw_t *w  = (demo_pxw_t *)buf;
+    demo_pxw_t  cw = DEMO_PX_REP(c);
+    for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES, w++)
+        *w = demo_px_sub_sat(*w, cw);
+    buf = (uint16_t *)w;
+
+    for (; n > 0; n--, buf++)
+        *buf = (uint16_t)demo_px_sub_sat(*buf, c);
+}
+
+void demo_px_shr_buf(uint16_t *buf, int shift, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(buf); n--, buf++)
+        *buf = (uint16_t)demo_px_shr(*buf, shift);
+
+    demo_pxw_t *w = (demo_pxw_t *)buf;
+    for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES, w++)
+        *w = demo_px_shr(*w, shift);
+    buf = (uint16_t *)w;
+
+    for (; n > 0; n--, buf++)
+        *buf = (uint16_t)demo_px_shr(*buf, shift);
+}
+
+void demo_px_blend_buf(uint16_t *dst, const uint16_t *a, const uint16_t *b, unsigned k, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(dst); n--)
+        *dst++ = (uint16_t)demo_px_blend(*a++, *b++, k);
+
+    if (PX_ALIGNED(a) && PX_ALIGNED(b))
+    {
+        demo_pxw_t       *w  = (demo_pxw_t *)dst;
+        const demo_pxw_t *wa = (const demo_pxw_t *)a;
+        const demo_pxw_t *wb = (const demo_pxw_t *)b;
+        for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES)
+            *w++ = demo_px_blend(*wa++, *wb++, k);
+        dst = (uint16_t *)w;
+        a   = (const uint16_t *)wa;
+        b   = (const uint16_t *)wb;
+    }
+
+    for (; n > 0; n--)
+        *dst++ = (uint16_t)demo_px_blend(*a++, *b++, k);
+}
+
+void demo_px_lut8(uint16_t *dst, const uint8_t *idx, const uint16_t *pal, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(dst); n--)
+        *dst++ = pal[*idx++];
+
+    /* 查表仍逐像素，但拼成整字后一次写出，写入次数减为 1 / LANES */
+    demo_pxw_t *w = (demo_pxw_t *)dst;
+    for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES, idx += DEMO_PX_LANES)
+    {
+        demo_pxw_t v = 0;
+        for (int i = DEMO_PX_LANES - 1; i >= 0; i--)
+            v = (v << 16) | pal[idx[i]];
+        *w++ = v;
+    }
+    dst = (uint16_t *)w;
+
+    for (; n > 0; n--)
+        *dst++ = pal[*idx++];
+}
+
+void demo_px_fill(uint16_t *dst, uint16_t c, int n)
+{
+    for (; n > 0 && !PX_ALIGNED(dst); n--)
+        *dst++ = c;
+
+    demo_pxw_t *w  = (demo_pxw_t *)dst;
+    demo_pxw_t  cw = DEMO_PX_REP(c);
+    for (; n >= DEMO_PX_LANES; n -= DEMO_PX_LANES)
+        *w++ = cw;
+    dst = (uint16_t *)w;
+
+    for (; n > 0; n--)
+        *dst++ = c;
+}
+
+/* --- 标量参照 (与移植前各特效中的写法一致) --- */
+
+static uint16_t ref_add_sat(uint16_t back, uint16_t front)
+{
+    int r = MIN(((back >> 11) & 0x1F) + ((front >> 11) & 0x1F), 0x1F);
+    int g = MIN(((back >> 5) & 0x3F) + ((front >> 5) & 0x3F), 0x3F);
+    int b = MIN((back & 0x1F) + (front & 0x1F), 0x1F);
+    return (r << 11) | (g << 5) | b;
+}
+
+static uint16_t ref_sub_sat(uint16_t a, uint16_t c)
+{
+    int r = MAX(((a >> 11) & 0x1F) - ((c >> 11) & 0x1F), 0);
+    int g = MAX(((a >> 5) & 0x3F) - ((c >> 5) & 0x3F), 0);
+    int b = MAX((a & 0x1F) - (c & 0x1F), 0);
+    return (r << 11) | (g << 5) | b;
+}
+
+static uint16_t ref_blend(uint16_t a, uint16_t b, unsigned k)
+{
+    int r  = (((a >> 11) & 0x1F) * k + ((b >> 11) & 0x1F) * (32 - k)) >> 5;
+    int g  = (((a >> 5) & 0x3F) * k + ((b >> 5) & 0x3F) * (32 - k)) >> 5;
+    int bl = ((a & 0x1F) * k + (b & 0x1F) * (32 - k)) >> 5;
+    return (r << 11) | (g << 5) | bl;
+}
+
+/* 三分支逐通道衰减 (0016 移植前) */
+static uint16_t ref_decay(uint16_t color)
+{
+    if (color != 0)
+    {
+        if ((color & 0x001F) > 0)
+            color -= 0x0001;
+        if ((color & 0x07E0) > 0x0020)
+            color -= 0x0020;
+        if ((color & 0xF800) > 0x0800)
+            color -= 0x0800;
+    }
+    return color;
+}
+
+/* --- 自检 --- */
+
+static struct demo_rand g_swar_rng;
+
+static uint16_t swar_rand(void)
+{
+    return (uint16_t)demo_rand_bits(&g_swar_rng, 16);
+}
+
+/* 整字内各道独立：随机打包 LANES 个像素，与逐像素参照比较 */
+static int check_lanes(void)
+{
+    int bad = 0;
+
+    for (int iter = 0; iter < 200000; iter++)
+    {
+        uint16_t   a[4], b[4];
+        demo_pxw_t wa = 0, wb = 0;
+        unsigned   k  = iter % 33;
+        int        sh = iter % 6;
+
+        for (int i = DEMO_PX_LANES - 1; i >= 0; i--)
+        {
+            /* 一半样本各通道取 0 或满值，覆盖饱和边界 */
+            a[i] = swar_rand();
+            if (iter & 1)
+                a[i] = (uint16_t)demo_px_spread(a[i] & 0x8410);
+            b[i] = swar_rand();
+            wa   = (wa << 16) | a[i];
+            wb   = (wb << 16) | b[i];
+        }
+
+        demo_pxw_t add = demo_px_add_sat(wa, wb);
+        demo_pxw_t sub = demo_px_sub_sat(wa, wb);
+        demo_pxw_t shr = demo_px_shr(wa, sh);
+        demo_pxw_t scl = demo_px_scale(wa, k);
+        demo_pxw_t bln = demo_px_blend(wa, wb, k);
+
+        for (int i = 0; i < DEMO_PX_LANES; i++)
+        {
+            int s = i * 16;
+            bad += (uint16_t)(add >> s) != ref_add_sat(a[i], b[i]);
+            bad += (uint16_t)(sub >> s) != ref_sub_sat(a[i], b[i]);
+            bad += (uint16_t)(shr >> s) != (((a[i] >> 11) >> sh) << 11 | (((a[i] >> 5) & 0x3F) >> sh) << 5 |
+                                            ((a[i] & 0x1F) >> sh));
+            bad += (uint16_t)(scl >> s) != ref_blend(a[i], 0, k);
+            bad += (uint16_t)(bln >> s) != ref_blend(a[i], b[i], k);
+        }
+    }
+    rt_kprintf("lanes  %d mismatches (%d px / word)\n", bad, DEMO_PX_LANES);
+    return bad ? -1 : 0;
+}
+
+/* 整行版本：覆盖各种首尾对齐 */
+static int check_buffers(void)
+{
+    static uint16_t a[67], b[67], c[67];
+    static uint8_t  idx[67];
+    static uint16_t pal[256];
+    int             bad = 0;
+
+    for (int i = 0; i < 256; i++)
+        pal[i] = swar_rand();
+
+    for (int off = 0; off < 4; off++)
+    {
+        for (int n = 0; n < 64; n++)
+        {
+            for (int i = 0; i < 67; i++)
+            {
+                a[i]   = swar_rand();
+                b[i]   = swar_rand();
+                idx[i] = (uint8_t)swar_rand();
+            }
+
+            memcpy(c, a, sizeof(c));
+            demo_px_add_sat_buf(c + off, b + off, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? ref_add_sat(a[i], b[i]) : a[i]);
+
+            memcpy(c, a, sizeof(c));
+            demo_px_sub_sat_buf(c + off, 0x0821, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? ref_sub_sat(a[i], 0x0821) : a[i]);
+
+            memcpy(c, a, sizeof(c));
+            demo_px_shr_buf(c + off, 1, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? ((a[i] >> 1) & 0x7BEF) : a[i]);
+
+            memcpy(c, a, sizeof(c));
+            demo_px_blend_buf(c + off, a + off, b + off, 11, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? ref_blend(a[i], b[i], 11) : a[i]);
+
+            memcpy(c, a, sizeof(c));
+            demo_px_lut8(c + off, idx + off, pal, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? pal[idx[i]] : a[i]);
+
+            memcpy(c, a, sizeof(c));
+            demo_px_fill(c + off, 0x1234, n);
+            for (int i = 0; i < 67; i++)
+                bad += c[i] != ((i >= off && i < off + n) ? 0x1234 : a[i]);
+        }
+    }
+    rt_kprintf("bufs   %d mismatches\n", bad);
+    return bad ? -1 : 0;
+}
+
+/* --- 微基准：QVGA 一帧，标量写法 vs SWAR --- */
+
+#define BENCH_N    (DEMO_QVGA_W * DEMO_QVGA_H)
+#define BENCH_REPS 20
+
+static uint16_t g_bench_a[BENCH_N] __attribute__((aligned(8)));
+static uint16_t g_bench_b[BENCH_N] __attribute__((aligned(8)));
+static uint8_t  g_bench_idx[BENCH_N];
+static uint16_t g_bench_pal[256];
+
+/* 防止编译器把重复的整帧运算合并或消除 */
+static volatile uint32_t g_bench_sink;
+
+static uint32_t bench_sum(void)
+{
+    uint32_t h = 0;
+    for (int i = 0; i < BENCH_N; i += 97)
+        h = h * 31 + g_bench_a[i];
+    return h;
+}
+
+#define BENCH(label, scalar, swar)                                                                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        uint64_t t0 = demo_perf_now_us();                                                                              \
+        for (int r = 0; r < BENCH_REPS; r++)                                                                           \
+        {                                                                                                              \
+            scalar;                                                                                                    \
+            g_bench_sink += g_bench_a[r];                                                                              \
+        }                                                                                                              \
+        uint64_t t1 = demo_perf_now_us();                                                                              \
+        for (int r = 0; r < BENCH_REPS; r++)                                                                           \
+        {                                                                                                              \
+            swar;                                                                                                      \
+            g_bench_sink += g_bench_a[r];                                                                              \
+        }                                                                                                              \
+        uint64_t t2 = demo_perf_now_us();                                                                              \
+        rt_kprintf("%-8s %8u %8u   x%u.%02u\n", label, (uint32_t)((t1 - t0) / BENCH_REPS),                         \
+                   (uint32_t)((t2 - t1) / BENCH_REPS), (uint32_t)((t1 - t0) / MAX(t2 - t1, 1)),                      \
+                   (uint32_t)((t1 - t0) * 100 / MAX(t2 - t1, 1) % 100));                                             \
+    } while (0)
+
+static void swar_bench(void)
+{
+    for (int i = 0; i < BENCH_N; i++)
+    {
+        g_bench_a[i]   = swar_rand();
+        g_bench_b[i]   = swar_rand() & 0x18C3; /* 小增量，接近粒子叠加的取值 */
+        g_bench_idx[i] = (uint8_t)swar_rand();
+    }
+    for (int i = 0; i < 256; i++)
+        g_bench_pal[i] = swar_rand();
+
+    rt_kprintf("%-8s %8s %8s   %s\n", "kernel", "scalar", "swar", "(us / QVGA frame)");
+
+    BENCH("add_sat", for (int i = 0; i < BENCH_N; i++) g_bench_a[i] = ref_add_sat(g_bench_a[i], g_bench_b[i]),
+          demo_px_add_sat_buf(g_bench_a, g_bench_b, BENCH_N));
+    BENCH("decay", for (int i = 0; i < BENCH_N; i++) g_bench_a[i] = ref_decay(g_bench_a[i]),
+          demo_px_sub_sat_buf(g_bench_a, 0x0821, BENCH_N));
+    BENCH("halve", for (int i = 0; i < BENCH_N; i++) g_bench_a[i] = (g_bench_a[i] >> 1) & 0x7BEF,
+          demo_px_shr_buf(g_bench_a, 1, BENCH_N));
+    BENCH("blend", for (int i = 0; i < BENCH_N; i++) g_bench_a[i] = ref_blend(g_bench_a[i], g_bench_b[i], 20),
+          demo_px_blend_buf(g_bench_a, g_bench_a, g_bench_b, 20, BENCH_N));
+    BENCH("lut8", for (int i = 0; i < BENCH_N; i++) g_bench_a[i] = g_bench_pal[g_bench_idx[i]],
+          demo_px_lut8(g_bench_a, g_bench_idx, g_bench_pal, BENCH_N));
+
+    g_bench_sink += bench_sum();
+}
+
+static int cmd_demo_swar(int argc, char **argv)
+{
+    int ret = 0;
+
+    demo_rand_seed(&g_swar_rng, 0);
+    rt_kprintf("--- RGB565 SWAR kernels vs scalar ---\n");
+    ret |= check_lanes();
+    ret |= check_buffers();
+    rt_kprintf("%s\n", ret ? "FAIL" : "PASS");
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        swar_bench();
+    return ret;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_demo_swar, demo_swar, Check RGB565 SWAR kernels [bench]);
@@ -0,0 +1,139 @@
+/*
+ * Filename: demo_swar.h
+ * THE LOOM OF LANES
+ * 多道织机
+ *
+ * RGB565 像素核心库 (SWAR：SIMD Within A Register)。
+ * 一个寄存器字同时处理 2 (32 位) 或 4 (64 位，RV64) 个像素，通道间以掩码隔离进位，
+ * 饱和加 / 减、移位衰减、按比例缩放与混合均无分支；另有调色板展开与填充的整行版本。
+ *
+ * 单像素的内联版本与整字版本共用同一实现 (像素放在字的最低 16 位即可)，
+ * 特效中零散的逐像素 RMW (粒子、雾化) 也可直接调用，结果与逐通道的标量写法逐位一致。
+ *
+ * [Hook] 体系结构可在包含本文件前预定义 DEMO_PX_ARCH_ADD_SAT / DEMO_PX_ARCH_SUB_SAT
+ * (签名同 demo_px_add_sat / demo_px_sub_sat) 以替换通用实现，例如工具链支持
+ * RISC-V P 扩展 (__riscv_p) 时的 16 位 SIMD 指令序列。
+ */
+
+#ifndef _DEMO_SWAR_H_
+#define _DEMO_SWAR_H_
+
+#include "demo_utils.h"
+#include <stdint.h>
+
+/* 寄存器字：RV64 / 64 位主机 4 像素，其余 2 像素 */
+#if (defined(__riscv_xlen) && __riscv_xlen == 64) || (!defined(__riscv) && __SIZEOF_POINTER__ == 8)
+typedef uint64_t demo_pxw_t;
+#else
+typedef uint32_t demo_pxw_t;
+#endif
+
+#define DEMO_PX_LANES  ((int)(sizeof(demo_pxw_t) / 2))
+#define DEMO_PX_REP(c) ((demo_pxw_t)0x0001000100010001ull * (uint16_t)(c)) /* 常量复制到每个像素道 */
+
+/* 通道掩码：各通道最高位 / 红蓝 / 绿 */
+#define DEMO_PX_MSB   DEMO_PX_REP(0x8410)
+#define DEMO_PX_RB    DEMO_PX_REP(0xF81F)
+#define DEMO_PX_G     DEMO_PX_REP(0x07E0)
+#define DEMO_PX_MSB_R (DEMO_PX_REP(0x8010)) /* 红、蓝通道的最高位 (均为 5 位) */
+#define DEMO_PX_MSB_G (DEMO_PX_REP(0x0400))
+
+/* 由各通道最高位上的标志展开为整通道掩码：(c << 1) - (c >> (宽度 - 1)) */
+static inline demo_pxw_t demo_px_spread(demo_pxw_t c)
+{
+    demo_pxw_t rb = c & DEMO_PX_MSB_R;
+    demo_pxw_t g  = c & DEMO_PX_MSB_G;
+    return ((rb << 1) - (rb >> 4)) | ((g << 1) - (g >> 5));
+}
+
+/* --- 饱和加：各通道相加，溢出时取满值 (变白而不是翻转) --- */
+
+static inline demo_pxw_t demo_px_add_sat(demo_pxw_t a, demo_pxw_t b)
+{
+#ifdef DEMO_PX_ARCH_ADD_SAT
+    return DEMO_PX_ARCH_ADD_SAT(a, b);
+#else
+    /* 先去掉各通道最高位再相加，进位不会跨通道；最高位按异或补回，进位输出即溢出标志 */
+    demo_pxw_t s = ((a & ~DEMO_PX_MSB) + (b & ~DEMO_PX_MSB)) ^ ((a ^ b) & DEMO_PX_MSB);
+    demo_pxw_t c = ((a & b) | ((a | b) & ~s)) & DEMO_PX_MSB;
+    return s | demo_px_spread(c);
+#endif
+}
+
+/* --- 饱和减：各通道相减，不足时取 0 --- */
+
+static inline demo_pxw_t demo_px_sub_sat(demo_pxw_t a, demo_pxw_t b)
+{
+#ifdef DEMO_PX_ARCH_SUB_SAT
+    return DEMO_PX_ARCH_SUB_SAT(a, b);
+#else
+    /* 被减数各通道最高位置 1、减数清 0，借位不会跨通道；借位输出即下溢标志 */
+    demo_pxw_t d = ((a | DEMO_PX_MSB) - (b & ~DEMO_PX_MSB)) ^ ((a ^ ~b) & DEMO_PX_MSB);
+    demo_pxw_t w = ((~a & b) | (~(a ^ b) & d)) & DEMO_PX_MSB;
+    return d & ~demo_px_spread(w);
+#endif
+}
+
+/* --- 移位衰减：各通道右移 n 位 (n = 1 时即 (c >> 1) & 0x7BEF) --- */
+
+static inline demo_pxw_t demo_px_shr(demo_pxw_t a, int n)
+{
+    uint16_t keep = (uint16_t)(((0xF800 >> n) & 0xF800) | ((0x07E0 >> n) & 0x07E0) | (0x001F >> n));
+    return (a >> n) & DEMO_PX_REP(keep);
+}
+
+/*
+ * --- 缩放与混合：k 取 0 ~ 32 (32 = 1.0) ---
+ * 将每个像素展开为 0000 0GGG GGG0 0000 RRRR R000 000B BBBB (32 位槽，绿色移到高半字)，
+ * 各通道之间留出 5 位空隙，乘以 k 不会越界；奇偶像素分两组处理。
+ */
+#define DEMO_PX_LO     ((demo_pxw_t)0x0000FFFF0000FFFFull)
+#define DEMO_PX_SPREAD ((demo_pxw_t)0x07E0F81F07E0F81Full)
+
+static inline demo_pxw_t demo_px_unpack(demo_pxw_t a)
+{
+    return (a | (a << 16)) & DEMO_PX_SPREAD;
+}
+
+static inline demo_pxw_t demo_px_pack(demo_pxw_t e)
+{
+    e &= DEMO_PX_SPREAD;
+    return (e | (e >> 16)) & DEMO_PX_LO;
+}
+
+static inline demo_pxw_t demo_px_scale(demo_pxw_t a, unsigned k)
+{
+    demo_pxw_t even = demo_px_unpack(a & DEMO_PX_LO);
+    demo_pxw_t odd  = demo_px_unpack((a >> 16) & DEMO_PX_LO);
+    return demo_px_pack((even * k) >> 5) | (demo_px_pack((odd * k) >> 5) << 16);
+}
+
+/* a * k + b * (32 - k)，k 取 0 ~ 32 */
+static inline demo_pxw_t demo_px_blend(demo_pxw_t a, demo_pxw_t b, unsigned k)
+{
+    demo_pxw_t ae = demo_px_unpack(a & DEMO_PX_LO);
+    demo_pxw_t ao = demo_px_unpack((a >> 16) & DEMO_PX_LO);
+    demo_pxw_t be = demo_px_unpack(b & DEMO_PX_LO);
+    demo_pxw_t bo = demo_px_unpack((b >> 16) & DEMO_PX_LO);
+
+    demo_pxw_t even = (ae * k + be * (32 - k)) >> 5;
+    demo_pxw_t odd  = (ao * k + bo * (32 - k)) >> 5;
+    return demo_px_pack(even) | (demo_px_pack(odd) << 16);
+}
+
+/* --- 整行版本 (demo_swar.c)：任意 2 字节对齐的缓冲，首尾不足一字的像素逐个处理 --- */
+
+/* dst[i] = sat(dst[i] + src[i]) */
+void demo_px_add_sat_buf(uint16_t *dst, const uint16_t *src, int n);
+/* buf[i] = sat(buf[i] - c) */
+void demo_px_sub_sat_buf(uint16_t *buf, uint16_t c, int n);
+/* buf[i] 各通道右移 shift 位 */
+void demo_px_shr_buf(uint16_t *buf, int shift, int n);
+/* dst[i] = a[i] * k + b[i] * (32 - k) */
+void demo_px_blend_buf(uint16_t *dst, const uint16_t *a, const uint16_t *b, unsigned k, int n);
+/* dst[i] = pal[idx[i]]，以整字写出 */
+void demo_px_lut8(uint16_t *dst, const uint8_t *idx, const uint16_t *pal, int n);
+/* dst[i] = c，以整字写出 */
+void demo_px_fill(uint16_t *dst, uint16_t c, int n);
+
+#endif /* _DEMO_SWAR_H_ */
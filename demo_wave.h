@@ -0,0 +1,59 @@
+/*
+ * Filename: demo_wave.h
+ * THE TENSION OF THE SURFACE
+ * 液面张力
+ *
+ * 二维波动方程 (高度场) 解算器，每帧一步：
+ *     h' = (上 + 下 + 左 + 右) / 2 - h_prev，再 h' -= h' >> damping
+ * 最外一圈固定为 0 (反射边界)。
+ *
+ * 高度以偏置形式存为 uint16 (h + DEMO_WAVE_BIAS，范围 [0, 2 * BIAS))，
+ * 四邻之和不超出 16 位、差值可借位前置，于是一个寄存器字可同时解算 2 (32 位) 或 4 (RV64) 个格点，
+ * 各道之间无进位串扰，只需整字的加减与移位。中间结果超出范围的字 (极少出现) 改用标量逐格饱和。
+ * 范围内结果与 int16 标量写法逐位一致。
+ *
+ * 解算与着色融合：每算完一行立即把该行映射为 8 位调色板索引写入纹理，
+ * 高度场只被完整遍历一次，工作集为相邻三行的源高度与一行目标 (QVGA 下约 2.5 KB)，常驻 L1。
+ */
+
+#ifndef _DEMO_WAVE_H_
+#define _DEMO_WAVE_H_
+
+#include "demo_engine.h"
+
+#define DEMO_WAVE_BIAS 0x2000 /* 高度范围 [-BIAS, BIAS)，峰值应远小于此 (0017 约 1500) */
+
+struct demo_wave_stats
+{
+    uint32_t steps;     /* 已解算的步数 */
+    uint32_t saturated; /* 最近一步中走标量饱和路径的字数 */
+    uint32_t step_us;   /* 最近一步 (含着色) 的耗时 */
+};
+
+struct demo_wave
+{
+    int       width, height; /* 格点数，width 须为 4 的倍数 */
+    int       damping;       /* 阻尼移位 */
+    uint16_t *buf[2];        /* 偏置高度，buf[cur] 为最新一步 */
+    int       cur;
+
+    struct demo_wave_stats stats;
+};
+
+/* 分配两帧高度场 (rt_malloc) 并清零，失败返回 -1。可在预备线程中调用 */
+int  demo_wave_init(struct demo_wave *w, int width, int height, int damping);
+void demo_wave_deinit(struct demo_wave *w);
+
+/* 整个高度场归零 (特效重新 init 时调用) */
+void demo_wave_reset(struct demo_wave *w);
+
+/* 把最新高度场中的一点设为 h (饱和到范围内)，作为下一步的扰动源；最外一圈不可写 */
+void demo_wave_poke(struct demo_wave *w, int x, int y, int h);
+
+/*
+ * 推进一步，并把新高度场写为 8 位索引：idx = CLAMP(sea + (h >> shift), 0, 255)。
+ * dst 为 width x height 的索引纹理 (地址与 stride 按 4 字节对齐)，sea 在 [0, 255] 内，shift 不超过 13。
+ */
+void demo_wave_step(struct demo_wave *w, uint8_t *dst, int stride, int sea, int shift);
+
+#endif /* _DEMO_WAVE_H_ */
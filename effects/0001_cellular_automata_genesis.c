@@ -27,6 +27,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_swar.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -64,7 +66,7 @@ static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请 CMA 显存 (必须物理连续)
     // 使用 DEMO_ALIGN_SIZE 确保内存大小对齐 Cache Line，符合 SPEC 规范
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 1: CMA alloc failed! Universe collapsed.");
@@ -104,6 +106,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
      */
     uint16_t *p = g_tex_vir_addr;
     int       t = g_tick;
+    uint8_t   row[TEX_WIDTH];
 
     // 动态缩放因子，让纹理产生呼吸感
     int zoom = ZOOM_BASE + (t & ZOOM_RANGE);
@@ -123,11 +126,13 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             int val = ((zx ^ zy) + t) ^ zy_t;
 
             // 引入扰动
-            val = (val & 0xFF) + ((x * y) >> DISTORT_SHIFT);
-
-            // 查表上色
-            *p++ = g_palette[val & 0xFF];
+            val    = (val & 0xFF) + ((x * y) >> DISTORT_SHIFT);
+            row[x] = (uint8_t)val;
         }
+
+        // 查表上色 (整字写出)
+        demo_px_lut8(p, row, g_palette, TEX_WIDTH);
+        p += TEX_WIDTH;
     }
 
     /*
@@ -184,7 +189,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
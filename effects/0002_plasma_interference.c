@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_perf.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -72,7 +74,7 @@ static uint16_t g_palette[LUT_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 内存分配
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 2: CMA Alloc Failed.");
@@ -157,12 +159,15 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
      * === CRITICAL: Cache Flush ===
      * 确保 GE 读到的是最新计算的波形
      */
+    demo_perf_phase_begin(DEMO_PHASE_CACHE);
     aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    demo_perf_phase_end();
 
     /*
      * === PHASE 2: GE Hardware Scaling ===
      * 将 320x240 的波形图平滑放大到全屏
      */
+    demo_perf_phase_begin(DEMO_PHASE_GE_SUBMIT);
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
@@ -198,7 +203,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     }
 
     mpp_ge_emit(ctx->ge);
+    demo_perf_phase_end();
+
+    demo_perf_phase_begin(DEMO_PHASE_GE_SYNC);
     mpp_ge_sync(ctx->ge);
+    demo_perf_phase_end();
 
     g_tick++;
 }
@@ -207,7 +216,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -27,6 +27,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_lut.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -64,30 +66,19 @@ static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+/* LUT 缓存参数：任一项变化都会使 /data 中的缓存失效 */
+static const struct
 {
-    // 1. CMA 显存分配 (用于 GE 缩放源)
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 3: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+    int w, h;
+    int depth_scale;
+} g_lut_params = {TEX_WIDTH, TEX_HEIGHT, DEPTH_SCALE};
 
-    // 2. 深度表内存分配 (320x240 = 75KB, 使用普通 RAM)
-    g_depth_lut = (uint8_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT);
-    if (!g_depth_lut)
-    {
-        LOG_E("Night 3: LUT Alloc Failed.");
-        mpp_phy_free(g_tex_phy_addr);
-        return -1;
-    }
-
-    // 3. 预计算深度表 (Square Tunnel Logic)
+/* 预计算深度表 (Square Tunnel Logic) */
+static void build_depth_lut(void *buf, size_t size)
+{
     int      center_x = TEX_WIDTH / 2;
     int      center_y = TEX_HEIGHT / 2;
-    uint8_t *p_depth  = g_depth_lut;
+    uint8_t *p_depth  = (uint8_t *)buf;
 
     for (int y = 0; y < TEX_HEIGHT; y++)
     {
@@ -111,8 +102,24 @@ static int effect_init(struct demo_ctx *ctx)
             *p_depth++ = (uint8_t)(depth & 0xFF);
         }
     }
+}
+
+/* 预备阶段 (可能运行于预备线程)：深度表与调色板只由 CPU 读取，深度表缓存于 /data */
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 1. 深度表内存分配 (320x240 = 75KB, 使用普通 RAM)
+    g_depth_lut = (uint8_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT);
+    if (!g_depth_lut)
+    {
+        LOG_E("Night 3: LUT Alloc Failed.");
+        return -1;
+    }
+
+    // 2. 载入或预计算深度表
+    demo_lut_fetch("0003_depth", &g_lut_params, sizeof(g_lut_params), g_depth_lut, TEX_WIDTH * TEX_HEIGHT,
+                   build_depth_lut);
 
-    // 4. 生成迷幻调色板 (Electric Blue -> Purple)
+    // 3. 生成迷幻调色板 (Electric Blue -> Purple)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // R: 0~128~0
@@ -132,6 +139,28 @@ static int effect_init(struct demo_ctx *ctx)
 
         g_palette[i] = RGB2RGB565(r, g, b);
     }
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    if (g_depth_lut)
+    {
+        rt_free(g_depth_lut);
+        g_depth_lut = NULL;
+    }
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // CMA 显存分配 (用于 GE 缩放源)
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    if (g_tex_phy_addr == 0)
+    {
+        LOG_E("Night 3: CMA Alloc Failed.");
+        return -1;
+    }
+    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
     g_tick = 0;
     rt_kprintf("Night 3: Infinite Corridor (Pixel-Perfect) loaded.\n");
@@ -216,22 +245,19 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
-    if (g_depth_lut)
-    {
-        rt_free(g_depth_lut);
-        g_depth_lut = NULL;
-    }
 }
 
 struct effect_ops effect_0003 = {
-    .name   = "NO.3 INFINITE CORRIDOR",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name      = "NO.3 INFINITE CORRIDOR",
+    .init      = effect_init,
+    .draw      = effect_draw,
+    .deinit    = effect_deinit,
+    .prepare   = effect_prepare,
+    .unprepare = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0003);
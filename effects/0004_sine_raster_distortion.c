@@ -28,6 +28,7 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -75,7 +76,7 @@ static uint16_t metal_lut[PALETTE_SIZE];
 
 static int effect_init(struct demo_ctx *ctx)
 {
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 4: CMA Alloc Failed.");
@@ -250,7 +251,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -25,81 +25,75 @@
  * Hardware Feature:
  * 1. GE Scaler (Hardware Stretch) - 将 320x240 QVGA 纹理放大至 640x480
  * 2. CPU Fix-Point Math (Q12) - 利用定点数加速复平面迭代运算
+ * 3. DE Gamma Palette (索引色) - 纹理只写 1 字节迭代索引，由 DE gamma 还原为火焰色
  */
 
 #include "demo_engine.h"
-#include "mpp_mem.h"
+#include "demo_math.h"
 #include "aic_hal_ge.h"
 #include <math.h>
+#include <string.h>
 
 /* --- Configuration Parameters --- */
 
 /* 纹理规格 */
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
 
 /* 分形算法参数 (Z = Z^2 + C) */
-#define MAX_ITER         16 // 最大迭代次数 (画质与性能的平衡点)
-#define ESCAPE_RADIUS    4  // 逃逸半径平方 (2.0^2)
+#ifndef AIC_GE_DEMO_JULIA_ITER
+#define AIC_GE_DEMO_JULIA_ITER 64 // 画质旋钮：最大迭代次数 (16 ~ 250)
+#endif
+#define MAX_ITER         AIC_GE_DEMO_JULIA_ITER
+#define ESCAPE_RADIUS    4 // 逃逸半径平方 (2.0^2)
 #define ESCAPE_THRESHOLD (ESCAPE_RADIUS * Q12_ONE)
 
+/* Mariani-Silver 矩形细分：边长不超过 MS_MIN 的矩形逐像素计算 */
+#define MS_MIN 6
+
+/* 纹理中尚未计算的像素 (迭代次数不超过 250) */
+#define ITER_UNKNOWN 0xFF
+
 /* 视窗参数 */
 #define VIEW_SCALE_BASE 3000 // 基础缩放 (Q12)
 #define VIEW_PAN_X      (TEX_WIDTH / 2)
 #define VIEW_PAN_Y      (TEX_HEIGHT / 2)
 
-/* --- Global State --- */
-
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
+/* 180° 对称：(x, y) 与 (2 * PAN_X - x, 2 * PAN_Y - y) 的迭代次数相同，只计算上半部 (含中线) */
+#define HALF_ROWS (VIEW_PAN_Y + 1)
 
-/* 正弦查找表 (Q12定点数, 4096=1.0) */
-static int sin_lut[512];
+/* --- Global State --- */
 
-/* --- Implementation --- */
+static int g_tick = 0;
 
-static int effect_init(struct demo_ctx *ctx)
-{
-    // 1. 申请 CMA (Continuous Memory Allocator) 内存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 5: Critical Error - CMA Alloc Failed!");
-        return -1;
-    }
+/*
+ * 索引色：纹理每像素写 1 字节，引擎以 DE gamma (或 CPU 展开) 映射为 g_palette。
+ * 收敛的核心为索引 0 (黑)，逃逸于第 i 次迭代的像素映射到火焰坐标 240 * sqrt(i / MAX_ITER)，
+ * 迭代上限提高后低迭代区的亮度与原先 16 次时相近，新增的迭代用于刻画边界。
+ * 与核心相邻的火焰起点同为黑色，调色板整体呈分段线性，便于 16 节点 gamma 逼近。
+ */
+#define FIRE_INDEX_BASE 15
 
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+static uint8_t  g_iter_index[256]; /* 迭代次数 -> 调色板索引 */
+static uint16_t g_palette[256];
 
-    // 2. 初始化数学表 (Q12 format)
-    for (int i = 0; i < 512; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / 256.0f) * (float)Q12_ONE);
-    }
+/* 每帧的映射表与参数 */
+static int g_col_re[TEX_WIDTH];  /* 列 -> 实部 (Q12) */
+static int g_row_im[HALF_ROWS];  /* 行 -> 虚部 (Q12) */
+static int g_c_re, g_c_im;       /* 常数 C (Q12) */
+static int g_trap_re, g_trap_im; /* 吸引不动点 (Q12) */
+static int g_trap_r2;            /* 吸引域内圆盘半径的平方 (Q12)，0 表示不可用 */
 
-    g_tick = 0;
-    rt_kprintf("Night 5: Hybrid Pipeline Ready. TexAddr: 0x%08x\n", g_tex_phy_addr);
-    return 0;
-}
+static uint8_t *g_iter; /* 本帧写入的纹理 (先存迭代次数，最后就地转为索引) */
 
-#define GET_SIN(idx) (sin_lut[(idx) & 511])
-#define GET_COS(idx) (sin_lut[((idx) + 128) & 511])
+/* --- Implementation --- */
 
 /*
- * 快速颜色映射
- * 将迭代次数 (0 ~ MAX_ITER) 映射为热烈的 RGB565 火焰色
+ * 调色板颜色
+ * 将火焰坐标 (0 ~ 255) 映射为热烈的 RGB565 火焰色
  */
-static inline uint16_t map_color_fire(int iter)
+static uint16_t map_color_fire(int i)
 {
-    // 逃逸阈值截断 (虽然理论上 iter 不会超过 MAX_ITER * 2 这里的调用范围)
-    if (iter >= 31)
-        return 0x0000; // 黑色核心
-
-    // 将 0-31 扩展到 0-255 用于计算 RGB
-    int i = iter * 8;
     int r, g, b;
 
     // 生成从深红 -> 橙色 -> 黄色 -> 白色的渐变
@@ -132,11 +126,157 @@ static inline uint16_t map_color_fire(int iter)
     return RGB2RGB565(r, g, b);
 }
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+static int effect_init(struct demo_ctx *ctx)
+{
+    // 迭代次数 -> 索引 (MAX_ITER 即未逃逸的核心)
+    for (int i = 0; i < MAX_ITER; i++)
+        g_iter_index[i] = FIRE_INDEX_BASE + demo_isqrt(i * 240 * 240 / MAX_ITER);
+    g_iter_index[MAX_ITER] = 0;
+
+    // 索引 -> 火焰色
+    for (int i = 0; i < 256; i++)
+        g_palette[i] = map_color_fire(MAX(i - FIRE_INDEX_BASE, 0));
+
+    g_tick = 0;
+    rt_kprintf("Night 5: Hybrid Pipeline Ready (%d iterations).\n", MAX_ITER);
+    return 0;
+}
+
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
+
+/* 坐标映射：v(n) = n * step (step 为 Q24)，按绝对值计算保证 v(-n) == -v(n)，对称性逐位成立 */
+static inline int map_axis(int n, int64_t step)
+{
+    int v = (int)(((int64_t)ABS(n) * step) >> Q12_SHIFT);
+    return n < 0 ? -v : v;
+}
+
+/*
+ * 内部陷阱：C 位于主心形线内时，不动点 a = (1 - sqrt(1 - 4C)) / 2 是吸引的 (|2a| < 1)。
+ * f(z) - a = (z - a)(z + a)，故 |z - a| < r 且 r + |2a| < 1 时迭代收缩、永不逃逸，
+ * 轨道一旦落入该圆盘即可判定为核心。每帧以浮点求一次。
+ */
+static void update_trap(void)
+{
+    float cr = (float)g_c_re / Q12_ONE;
+    float ci = (float)g_c_im / Q12_ONE;
+
+    // sqrt(1 - 4C) 取主值
+    float wr = 1.0f - 4.0f * cr;
+    float wi = -4.0f * ci;
+    float m  = sqrtf(wr * wr + wi * wi);
+    float sr = sqrtf((m + wr) * 0.5f);
+    float si = copysignf(sqrtf(MAX(m - wr, 0.0f) * 0.5f), wi);
+
+    float ar  = (1.0f - sr) * 0.5f;
+    float ai  = -si * 0.5f;
+    float lam = 2.0f * sqrtf(ar * ar + ai * ai);
+
+    g_trap_r2 = 0;
+    if (lam < 1.0f)
+    {
+        float r   = 0.9f * (1.0f - lam); // 留出定点舍入的余量
+        g_trap_re = (int)(ar * Q12_ONE);
+        g_trap_im = (int)(ai * Q12_ONE);
+        g_trap_r2 = (int)(r * r * Q12_ONE);
+    }
+}
+
+/* 逃逸时间：返回逃逸前的迭代次数，不逃逸返回 MAX_ITER */
+static int julia_iter(int z_re, int z_im)
+{
+    // 周期检测 (Brent)：参照点在第 8、16、32... 次迭代时更新
+    int p_re  = z_re;
+    int p_im  = z_im;
+    int check = 8;
+
+    for (int i = 0; i < MAX_ITER; i++)
+    {
+        // Q12 * Q12 = Q24, 需要右移 12 位回到 Q12
+        int z_re2 = (z_re * z_re) >> Q12_SHIFT;
+        int z_im2 = (z_im * z_im) >> Q12_SHIFT;
+
+        // 检查是否逃逸
+        if (z_re2 + z_im2 > ESCAPE_THRESHOLD)
+            return i;
+
+        // Z = Z^2 + C，(z_re * z_im) >> 11 等价于 (z_re * z_im * 2) >> 12
+        int new_re = z_re2 - z_im2 + g_c_re;
+        z_im       = ((z_re * z_im) >> 11) + g_c_im;
+        z_re       = new_re;
+
+        // 定点迭代是确定的映射：回到参照点即进入循环，永不逃逸 (与迭代到上限的结果一致)
+        if (z_re == p_re && z_im == p_im)
+            return MAX_ITER;
+        if (i == check)
+        {
+            p_re    = z_re;
+            p_im    = z_im;
+            check <<= 1;
+        }
+
+        // 落入吸引不动点的收缩圆盘
+        if (g_trap_r2)
+        {
+            int dr = z_re - g_trap_re;
+            int di = z_im - g_trap_im;
+            if (((dr * dr + di * di) >> Q12_SHIFT) < g_trap_r2)
+                return MAX_ITER;
+        }
+    }
+    return MAX_ITER;
+}
+
+static inline int julia_pixel(int x, int y)
 {
-    if (!g_tex_vir_addr)
+    uint8_t *p = &g_iter[y * TEX_WIDTH + x];
+    if (*p == ITER_UNKNOWN)
+        *p = (uint8_t)julia_iter(g_col_re[x], g_row_im[y]);
+    return *p;
+}
+
+/*
+ * Mariani-Silver：矩形 [x0, x1) x [y0, y1) 的边框迭代次数全部相同时，
+ * 内部直接填充 (连通的等迭代区域内不会有岛)，否则四分递归。
+ * 边框像素缓存在纹理中，相邻矩形共享的边不会重复计算。
+ */
+static void julia_rect(int x0, int y0, int x1, int y1)
+{
+#ifdef AIC_GE_DEMO_JULIA_SUBDIV
+    if (x1 - x0 > MS_MIN && y1 - y0 > MS_MIN)
+    {
+        int  it      = julia_pixel(x0, y0);
+        bool uniform = true;
+
+        for (int x = x0; x < x1 && uniform; x++)
+            uniform = julia_pixel(x, y0) == it && julia_pixel(x, y1 - 1) == it;
+        for (int y = y0 + 1; y < y1 - 1 && uniform; y++)
+            uniform = julia_pixel(x0, y) == it && julia_pixel(x1 - 1, y) == it;
+
+        if (uniform)
+        {
+            for (int y = y0 + 1; y < y1 - 1; y++)
+                memset(&g_iter[y * TEX_WIDTH + x0 + 1], it, x1 - x0 - 2);
+            return;
+        }
+
+        int xm = (x0 + x1) / 2;
+        int ym = (y0 + y1) / 2;
+        julia_rect(x0, y0, xm, ym);
+        julia_rect(xm, y0, x1, ym);
+        julia_rect(x0, ym, xm, y1);
+        julia_rect(xm, ym, x1, y1);
         return;
+    }
+#endif
+    for (int y = y0; y < y1; y++)
+        for (int x = x0; x < x1; x++)
+            julia_pixel(x, y);
+}
 
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
+{
     /*
      * === PHASE 1: CPU 计算 (Texture Generation) ===
      * 生成动态 Julia 集
@@ -144,72 +284,61 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
      */
 
     // 动态参数 C，随时间画圆，驱动分形变化
-    int c_re = GET_COS(g_tick) * 3 / 4;
-    int c_im = GET_SIN(g_tick * 2) * 3 / 4;
+    g_c_re = GET_COS(g_tick) * 3 / 4;
+    g_c_im = GET_SIN(g_tick * 2) * 3 / 4;
+    update_trap();
 
     // 缩放系数 (呼吸效果)
     int zoom = VIEW_SCALE_BASE + (GET_SIN(g_tick / 2) >> 2); // Q12
 
-    uint16_t *p_pixel = g_tex_vir_addr;
-
-    // 遍历纹理像素
-    for (int y = 0; y < TEX_HEIGHT; y++)
+    // 将纹理坐标映射到复平面 (-1.5 ~ 1.5)：每帧只为每列 / 每行计算一次，逐像素不再做除法
+    int64_t step_re = ((int64_t)3 << 36) / ((int64_t)TEX_WIDTH * zoom);  // Q24
+    int64_t step_im = ((int64_t)3 << 36) / ((int64_t)TEX_HEIGHT * zoom); // Q24
+    for (int x = 0; x < TEX_WIDTH; x++)
+        g_col_re[x] = map_axis(x - VIEW_PAN_X, step_re);
+    for (int y = 0; y < HALF_ROWS; y++)
+        g_row_im[y] = map_axis(y - VIEW_PAN_Y, step_im);
+
+    // 上半部 (含中线)：细分求解
+    g_iter = (uint8_t *)tex->vir;
+    memset(g_iter, ITER_UNKNOWN, HALF_ROWS * TEX_WIDTH);
+    julia_rect(0, 0, TEX_WIDTH, HALF_ROWS);
+
+    // 下半部：由 180° 对称复制，第 0 列的镜像在纹理之外，单独计算
+    for (int y = HALF_ROWS; y < TEX_HEIGHT; y++)
     {
-        for (int x = 0; x < TEX_WIDTH; x++)
-        {
-            // 将屏幕坐标映射到复平面 (-1.5 ~ 1.5)
-            // z = (coord - center) * range / width / zoom
-            // 使用 Q12 定点数乘法
-            // x_factor: 3 * Q12 / width -> 预计算可进一步优化，但这里保持逻辑清晰
-            int z_re = ((x - VIEW_PAN_X) * 3 * Q12_ONE) / TEX_WIDTH * Q12_ONE / zoom;
-            int z_im = ((y - VIEW_PAN_Y) * 3 * Q12_ONE) / TEX_HEIGHT * Q12_ONE / zoom;
-
-            int i;
-            // 迭代计算
-            for (i = 0; i < MAX_ITER; i++)
-            {
-                // Q12 * Q12 = Q24, 需要右移 12 位回到 Q12
-                int z_re2 = (z_re * z_re) >> Q12_SHIFT;
-                int z_im2 = (z_im * z_im) >> Q12_SHIFT;
-
-                // 检查是否逃逸
-                if (z_re2 + z_im2 > ESCAPE_THRESHOLD)
-                    break;
-
-                // Z = Z^2 + C
-                // 新的虚部 = 2 * z_re * z_im + c_im
-                // (z_re * z_im) >> 11 等价于 (z_re * z_im * 2) >> 12
-                int new_re = z_re2 - z_im2 + c_re;
-                int new_im = ((z_re * z_im) >> 11) + c_im;
-
-                z_re = new_re;
-                z_im = new_im;
-            }
-
-            // 写入像素 (平滑着色技巧：iter * 2 增加颜色分辨率)
-            *p_pixel++ = map_color_fire(i * 2);
-        }
+        const uint8_t *src = &g_iter[(2 * VIEW_PAN_Y - y) * TEX_WIDTH];
+        uint8_t       *dst = &g_iter[y * TEX_WIDTH];
+
+        dst[0] = (uint8_t)julia_iter(g_col_re[0], -g_row_im[2 * VIEW_PAN_Y - y]);
+        for (int x = 1; x < TEX_WIDTH; x++)
+            dst[x] = src[2 * VIEW_PAN_X - x];
     }
 
-    /*
-     * === CRITICAL: Cache Coherency ===
-     * CPU 刚刚写完了数据，必须强制将 D-Cache 刷入 DRAM
-     */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    // 迭代次数 -> 调色板索引 (颜色由引擎经调色板还原)
+    for (int i = 0; i < TEX_WIDTH * TEX_HEIGHT; i++)
+        g_iter[i] = g_iter_index[g_iter[i]];
 
-    /*
-     * === PHASE 2: GE 硬件缩放 (Stretch Blit) ===
-     * 将 320x240 的纹理放大铺满 640x480 的屏幕
-     */
+    /* Cache 刷新由引擎在 compute 之后统一完成 */
+    g_tick++;
+}
+
+/*
+ * === PHASE 2: GE 硬件缩放 (Stretch Blit) ===
+ * 将 320x240 的纹理放大铺满 640x480 的屏幕
+ * 只 emit 不 sync：引擎会让 CPU 在 GE 缩放期间计算下一帧
+ */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     // 源：Texture
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     // 目标：Screen Framebuffer
@@ -235,28 +364,17 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         LOG_E("GE Error: %d", ret);
     }
 
-    // 这是一条大指令，直接同步等待
     mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
-
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
 }
 
 struct effect_ops effect_0005 = {
-    .name   = "NO.5 THE FRACTAL DREAM",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name    = "NO.5 THE FRACTAL DREAM",
+    .init    = effect_init,
+    .compute = effect_compute,
+    .submit  = effect_submit,
+    .tex_w   = TEX_WIDTH,
+    .tex_h   = TEX_HEIGHT,
+    .palette = g_palette,
 };
 
 REGISTER_EFFECT(effect_0005);
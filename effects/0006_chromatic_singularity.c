@@ -29,10 +29,13 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_rand.h"
+#include "demo_swar.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
-#include <stdlib.h> // for rand
 #include <string.h>
 
 /* --- Configuration Parameters --- */
@@ -74,7 +77,6 @@ typedef struct
 static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 static int          g_tick         = 0;
-static int          sin_lut[LUT_SIZE]; // Q12
 static Particle     g_particles[PARTICLE_COUNT];
 
 /* --- Implementation --- */
@@ -82,7 +84,7 @@ static Particle     g_particles[PARTICLE_COUNT];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 内存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 6: CMA Alloc Failed.");
@@ -93,13 +95,9 @@ static int effect_init(struct demo_ctx *ctx)
     // 2. 清零 (初始化为黑色背景)
     memset(g_tex_vir_addr, 0, TEX_SIZE);
 
-    // 3. 数学表 (Q12 定点数，用于粒子轨迹计算)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 4. 初始化粒子群 (The Swarm)
+    // 3. 初始化粒子群 (The Swarm)
+    struct demo_rand rng;
+    demo_rand_seed(&rng, 6);
     for (int i = 0; i < PARTICLE_COUNT; i++)
     {
         // 相位分散，避免所有粒子同步
@@ -107,8 +105,8 @@ static int effect_init(struct demo_ctx *ctx)
         g_particles[i].phase_y = (i * 17) % LUT_SIZE;
 
         // 频率：制造一些谐波关系，但也保留随机性
-        g_particles[i].inc_x = 2 + (i % 5) + (rand() % 3);
-        g_particles[i].inc_y = 3 + (i % 4) + (rand() % 3);
+        g_particles[i].inc_x = 2 + (i % 5) + (int)demo_rand_range(&rng, 3);
+        g_particles[i].inc_y = 3 + (i % 4) + (int)demo_rand_range(&rng, 3);
 
         // 颜色：基于索引生成彩虹光谱
         // 让颜色随 i 渐变，形成群组感
@@ -127,30 +125,16 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK]) // COS = SIN(idx + 90 deg)
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1) // COS = SIN(idx + 90 deg)
 
 /*
  * 饱和加法 (Saturated Add)
- * 将两个 RGB565 颜色相加，确保不溢出（变白而不是翻转）
+ * 将两个 RGB565 颜色相加，确保不溢出（变白而不是翻转）；无分支，见 demo_swar.h
  */
 static inline uint16_t blend_add(uint16_t back, uint16_t front)
 {
-    // 拆分通道
-    int r_b = (back >> 11) & 0x1F; // 5-bit R
-    int g_b = (back >> 5) & 0x3F;  // 6-bit G
-    int b_b = back & 0x1F;         // 5-bit B
-
-    int r_f = (front >> 11) & 0x1F;
-    int g_f = (front >> 5) & 0x3F;
-    int b_f = front & 0x1F;
-
-    // 饱和处理
-    int r = MIN(r_b + r_f, 0x1F);
-    int g = MIN(g_b + g_f, 0x3F);
-    int b = MIN(b_b + b_f, 0x1F);
-
-    return (r << 11) | (g << 5) | b;
+    return (uint16_t)demo_px_add_sat(back, front);
 }
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
@@ -160,26 +144,13 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
     /*
      * === PHASE 1: 全屏衰减 (Trails) ===
-     * 使用 32位操作加速 16位像素处理
+     * 使用 SWAR 整字操作加速 16位像素处理
      * 每 DECAY_FREQ 帧衰减一次，让拖尾更长
      */
     if (g_tick % DECAY_FREQ == 0)
     {
-        uint32_t *p32   = (uint32_t *)g_tex_vir_addr;
-        int       count = TEX_SIZE / 4; // 2 pixels per 32-bit word
-
-        // 0x7BEF7BEF = (RGB565_HALF_MASK) | (RGB565_HALF_MASK << 16)
-        // 将亮度减半：R, G, B 各通道右移 1 位
-        uint32_t mask = 0x7BEF7BEF; // 0111101111101111
-                                    // R mask: 0111100000000000
-                                    // G mask: 0000011111100000
-                                    // B mask: 0000000000011111
-
-        while (count--)
-        {
-            *p32 = (*p32 >> DECAY_SHIFT) & mask;
-            p32++;
-        }
+        // R, G, B 各通道右移 DECAY_SHIFT 位 (每个寄存器字 2~4 像素)
+        demo_px_shr_buf(g_tex_vir_addr, DECAY_SHIFT, TEX_WIDTH * TEX_HEIGHT);
     }
 
     /*
@@ -276,7 +247,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -68,11 +70,10 @@ static uint16_t    *g_tex_vir_addr = NULL;
 static int          g_tick         = 0;
 
 /*
- * 两个查找表：
- * 1. sin_lut: 用于波形计算 (Q8 定点数)
+ * 查找表：
+ * 1. 正弦: 共享的 demo_sin_q8 (Q8 定点数)，用于波形计算
  * 2. g_palette: 用于将波形能量映射为绚丽的颜色 (256色 -> RGB565)
  */
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[256];
 
 /* --- Implementation --- */
@@ -80,7 +81,7 @@ static uint16_t g_palette[256];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 内存分配
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 7: CMA Alloc Failed.");
@@ -88,14 +89,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化正弦表 (Q8 定点数, 256 = 1.0)
-    // 这种精度对于 Plasma 这种模糊效果足够了，且运算更快
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI * 2.0f / 256.0f) * 256.0f);
-    }
-
-    // 3. 初始化调色板 (Psychedelic Colors)
+    // 2. 初始化调色板 (Psychedelic Colors)
     // 生成一条连续的、高饱和度的色带
     for (int i = 0; i < 256; i++)
     {
@@ -114,7 +108,7 @@ static int effect_init(struct demo_ctx *ctx)
 }
 
 // 快速查表宏
-#define SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define SIN(idx) demo_sin_q8((idx) << 2)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -214,7 +208,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_lut.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -58,7 +60,7 @@ static uint16_t    *g_tex_vir_addr = NULL;
 static int          g_tick         = 0;
 
 /*
- * 查找表 (存放在 Heap 中)
+ * 查找表 (存放在 Heap 中，两张表共用一次分配)
  * 距离表：存储纹理 V 坐标 (纵向深度)
  * 角度表：存储纹理 U 坐标 (横向旋转)
  */
@@ -67,32 +69,21 @@ static uint16_t *g_angle_lut = NULL;
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+/* LUT 缓存参数：任一项变化都会使 /data 中的缓存失效 */
+static const struct
 {
-    // 1. 分配 CMA 显存 (用于 GE 缩放源)
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 8: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+    int   w, h;
+    int   tex_size;
+    float depth;
+} g_lut_params = {TEX_WIDTH, TEX_HEIGHT, TUNNEL_TEX_SIZE, DEPTH_FACTOR};
 
-    // 2. 分配 LUT 内存 (普通 RAM 即可，CPU 读取)
-    // 320 * 240 * 2 bytes * 2 tables = 约 300KB
-    g_dist_lut  = (uint16_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT * sizeof(uint16_t));
-    g_angle_lut = (uint16_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT * sizeof(uint16_t));
-
-    if (!g_dist_lut || !g_angle_lut)
-    {
-        LOG_E("Night 8: LUT alloc failed.");
-        mpp_phy_free(g_tex_phy_addr);
-        return -1;
-    }
-
-    // 3. 预计算 LUT (核心数学逻辑)
-    int center_x = TEX_WIDTH / 2;
-    int center_y = TEX_HEIGHT / 2;
+/* 预计算 LUT (核心数学逻辑)：buf 依次存放距离表与角度表 */
+static void build_tunnel_lut(void *buf, size_t size)
+{
+    uint16_t *dist_lut  = (uint16_t *)buf;
+    uint16_t *angle_lut = dist_lut + TEX_WIDTH * TEX_HEIGHT;
+    int       center_x  = TEX_WIDTH / 2;
+    int       center_y  = TEX_HEIGHT / 2;
 
     for (int y = 0; y < TEX_HEIGHT; y++)
     {
@@ -105,17 +96,57 @@ static int effect_init(struct demo_ctx *ctx)
             // A. 距离计算 (Distance -> Z -> Texture V)
             // Z = Constant / Radius
             // 乘以 tex_size 将坐标映射到纹理空间
-            float dist         = DEPTH_FACTOR * TUNNEL_TEX_SIZE / sqrtf((float)(dx * dx + dy * dy));
-            g_dist_lut[offset] = (uint16_t)((int)dist % TUNNEL_TEX_SIZE);
+            float dist       = DEPTH_FACTOR * TUNNEL_TEX_SIZE / sqrtf((float)(dx * dx + dy * dy));
+            dist_lut[offset] = (uint16_t)((int)dist % TUNNEL_TEX_SIZE);
 
             // B. 角度计算 (Angle -> Rotation -> Texture U)
             // atan2 返回 -PI ~ PI
             // (angle / PI + 1.0) / 2.0  -> 0.0 ~ 1.0
-            float angle         = atan2f((float)dy, (float)dx); // -PI ~ PI
-            int   u             = (int)(TUNNEL_TEX_SIZE * (angle / PI + 1.0f) / 2.0f);
-            g_angle_lut[offset] = (uint16_t)(u % TUNNEL_TEX_SIZE);
+            float angle       = atan2f((float)dy, (float)dx); // -PI ~ PI
+            int   u           = (int)(TUNNEL_TEX_SIZE * (angle / PI + 1.0f) / 2.0f);
+            angle_lut[offset] = (uint16_t)(u % TUNNEL_TEX_SIZE);
         }
     }
+}
+
+/* 预备阶段 (可能运行于预备线程)：76800 次 sqrtf / atan2f 是切换卡顿的主要来源，结果缓存于 /data */
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 分配 LUT 内存 (普通 RAM 即可，CPU 读取)，两张表合为一块以便整块读写
+    // 320 * 240 * 2 bytes * 2 tables = 约 300KB
+    size_t lut_size = TEX_WIDTH * TEX_HEIGHT * sizeof(uint16_t) * 2;
+    g_dist_lut      = (uint16_t *)rt_malloc(lut_size);
+    if (!g_dist_lut)
+    {
+        LOG_E("Night 8: LUT alloc failed.");
+        return -1;
+    }
+    g_angle_lut = g_dist_lut + TEX_WIDTH * TEX_HEIGHT;
+
+    demo_lut_fetch("0008_tunnel", &g_lut_params, sizeof(g_lut_params), g_dist_lut, lut_size, build_tunnel_lut);
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    if (g_dist_lut)
+    {
+        rt_free(g_dist_lut);
+        g_dist_lut  = NULL;
+        g_angle_lut = NULL;
+    }
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // 分配 CMA 显存 (用于 GE 缩放源)
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    if (g_tex_phy_addr == 0)
+    {
+        LOG_E("Night 8: CMA Alloc Failed.");
+        return -1;
+    }
+    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
     g_tick = 0;
     rt_kprintf("Night 8: Space-time folded.\n");
@@ -213,27 +244,19 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
-    if (g_dist_lut)
-    {
-        rt_free(g_dist_lut);
-        g_dist_lut = NULL;
-    }
-    if (g_angle_lut)
-    {
-        rt_free(g_angle_lut);
-        g_angle_lut = NULL;
-    }
 }
 
 struct effect_ops effect_0008 = {
-    .name   = "NO.8 CYLINDRICAL HORIZON",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name      = "NO.8 CYLINDRICAL HORIZON",
+    .init      = effect_init,
+    .draw      = effect_draw,
+    .deinit    = effect_deinit,
+    .prepare   = effect_prepare,
+    .unprepare = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0008);
@@ -27,6 +27,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -65,7 +67,6 @@ static uint16_t    *g_tex_vir_addr = NULL;
 static int          g_tick         = 0;
 
 /* LUTs */
-static int      sin_lut[LUT_SIZE]; // Q12
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -73,7 +74,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 9: CMA Alloc Failed.");
@@ -81,13 +82,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化调色板：高对比度的霓虹色
+    // 2. 初始化调色板：高对比度的霓虹色
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // 使用更平滑的色彩过渡
@@ -112,8 +107,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -227,7 +222,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -23,46 +23,57 @@
  * 分离只是距离的幻觉，万物在底层相连。
  *
  * Hardware Feature:
- * 1. CPU Field Calculation (场论计算) - 每个像素计算到多个源点的距离平方反比和
+ * 1. CPU Field Calculation (场论计算) - 每个像素计算到多个源点的距离平方反比和 (查表 + 分块剔除 + SWAR 累加)
  * 2. GE Scaler (硬件缩放) - 将低分热力场放大至全屏，平滑化等势线
+ * 3. Indexed Texture (索引色) - 纹理只写 1 字节场强，由引擎经调色板还原
  */
 
 #include "demo_engine.h"
-#include "mpp_mem.h"
+#include "demo_math.h"
+#include "demo_swar.h"
 #include "aic_hal_ge.h"
-#include <math.h>
+#include <string.h>
 
 /* --- Configuration Parameters --- */
 
 /* 纹理规格 */
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
 
 /* 算法参数 */
-#define BALL_COUNT     3     // 磁球数量
-#define FIELD_STRENGTH 30000 // 场强系数 (强度 = STRENGTH / dist^2)
+#define BALL_DEFAULT   24    // 默认磁球数量
+#define BALL_MAX       32    // 磁球数量上限
+#define FIELD_ENERGY   90000 // 总场强：每个球的场强系数为 FIELD_ENERGY / 球数 (3 球时即原先的 30000)
 #define AMP_MARGIN     40    // 运动边界余量 (防止球心跑出屏幕太远)
+#define FIELD_MIN_BALL 3     // 场强表按此球数 (最大场强) 分配
+
+/*
+ * 分块剔除：强度 = strength / dist^2 取整，dist^2 > strength 时贡献恰为 0。
+ * 球到分块矩形的最近距离超出该半径时整块跳过，结果与逐像素累加逐位一致。
+ */
+#define TILE      16
+#define TILES_X   (TEX_WIDTH / TILE)
+#define TILES_Y   (TEX_HEIGHT / TILE)
+#define TILE_DIAG 23 // ceil(TILE * sqrt(2))
+#define TILE_WORDS (TILE / DEMO_PX_LANES)
+
+/* 场强表覆盖分块内可能出现的最大 dist^2：(影响半径 + 分块对角线)^2 */
+#define LUT_RADIUS(s) ((int)demo_isqrt(s) + 1 + TILE_DIAG)
+#define LUT_SIZE_MAX  (LUT_RADIUS(FIELD_ENERGY / FIELD_MIN_BALL) * LUT_RADIUS(FIELD_ENERGY / FIELD_MIN_BALL))
 
-/* 查找表参数 */
-#define LUT_SIZE     512
-#define LUT_MASK     511
 #define PALETTE_SIZE 256
 
 /* --- Global State --- */
 
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
+static int g_tick = 0;
 
 /*
- * 预计算查找表
- * 1. sin_lut: 用于球体运动轨迹 (Q12)
- * 2. g_palette: 256级热力图，映射场强度到颜色
+ * 预计算查找表 (prepare 中构建)
+ * 1. g_field_lut: dist^2 -> min(strength / dist^2, 255)，以查表代替逐像素的整数除法
+ * 2. g_palette: 256级热力图，映射场强度到颜色 (纹理只写 1 字节强度，由引擎经调色板还原)
  */
-static int      sin_lut[LUT_SIZE];
+static uint8_t *g_field_lut      = NULL;
+static int      g_field_strength = 0; /* 场强表对应的场强系数 */
 static uint16_t g_palette[PALETTE_SIZE];
 
 typedef struct
@@ -70,25 +81,40 @@ typedef struct
     int x, y;
 } Ball;
 
-static Ball g_balls[BALL_COUNT];
+static Ball g_balls[BALL_MAX];
+static int  g_ball_count = BALL_DEFAULT;
+
+/* 基准测试的负载档位 (球数) */
+static const int g_bench_loads[] = {3, 8, 16, 24, 32, 0};
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+static void build_field_lut(int count)
 {
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 10: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+    int strength = FIELD_ENERGY / count;
+    int size     = LUT_RADIUS(strength) * LUT_RADIUS(strength);
+
+    if (strength == g_field_strength)
+        return;
+
+    // dist^2 = 0 时按 1 计算，让核心更亮
+    g_field_lut[0] = (uint8_t)MIN(strength, 255);
+    for (int d2 = 1; d2 < size; d2++)
+        g_field_lut[d2] = (uint8_t)MIN(strength / d2, 255);
+    g_field_strength = strength;
+}
 
-    // 1. 初始化正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 1. 场强表 (按最大场强分配，约 38KB，使用普通 RAM)
+    g_field_lut = (uint8_t *)rt_malloc(LUT_SIZE_MAX);
+    if (!g_field_lut)
     {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
+        LOG_E("Night 10: LUT Alloc Failed.");
+        return -1;
     }
+    g_field_strength = 0;
+    build_field_lut(BALL_DEFAULT);
 
     // 2. 初始化调色板：深蓝 -> 紫 -> 红 -> 黄 -> 白 (热力图风格)
     for (int i = 0; i < PALETTE_SIZE; i++)
@@ -126,92 +152,151 @@ static int effect_init(struct demo_ctx *ctx)
 
         g_palette[i] = RGB2RGB565(r, g, b);
     }
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    if (g_field_lut)
+    {
+        rt_free(g_field_lut);
+        g_field_lut = NULL;
+    }
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    g_ball_count = BALL_DEFAULT;
+    build_field_lut(g_ball_count);
 
     g_tick = 0;
-    rt_kprintf("Night 10: Magnetic fields active.\n");
+    rt_kprintf("Night 10: Magnetic fields active (%d balls).\n", g_ball_count);
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+/* 基准测试切换负载 (两帧之间由渲染线程调用) */
+static void effect_set_load(struct demo_ctx *ctx, int load)
+{
+    g_ball_count = CLAMP(load, FIELD_MIN_BALL, BALL_MAX);
+    build_field_lut(g_ball_count);
+}
+
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+/* 各通道 16 位的累加器饱和到 255 (累加和不超过 BALL_MAX * 255，不会跨道) */
+static inline demo_pxw_t field_saturate(demo_pxw_t acc)
 {
-    if (!g_tex_vir_addr)
-        return;
+    demo_pxw_t over = (((acc & DEMO_PX_REP(0xFF00)) >> 8) + DEMO_PX_REP(0x00FF)) & DEMO_PX_REP(0x0100);
+    return (acc | (over - (over >> 8))) & DEMO_PX_REP(0x00FF);
+}
 
+/* 计算一个分块：active 为与该块相交的球，stride 为纹理行距 */
+static void field_tile(uint8_t *dst, int stride, int x0, int y0, const int *active, int n)
+{
+    for (int y = y0; y < y0 + TILE; y++, dst += stride)
+    {
+        demo_pxw_t acc[TILE_WORDS] = {0};
+
+        for (int k = 0; k < n; k++)
+        {
+            const Ball    *b   = &g_balls[active[k]];
+            int            dy  = y - b->y;
+            const uint8_t *lut = g_field_lut + dy * dy; // lut[dx^2] 即 dist^2 处的强度
+            int            dx  = x0 - b->x;
+
+            // SWAR 累加：每个寄存器字同时累加 2~4 个像素的 16 位强度
+            for (int w = 0; w < TILE_WORDS; w++)
+            {
+                demo_pxw_t v = 0;
+                for (int l = 0; l < DEMO_PX_LANES; l++, dx++)
+                    v |= (demo_pxw_t)lut[dx * dx] << (16 * l);
+                acc[w] += v;
+            }
+        }
+
+        // 饱和到 255 后作为调色板索引写出
+        uint8_t *p = dst;
+        for (int w = 0; w < TILE_WORDS; w++)
+        {
+            demo_pxw_t s = field_saturate(acc[w]);
+            for (int l = 0; l < DEMO_PX_LANES; l++)
+                *p++ = (uint8_t)(s >> (16 * l));
+        }
+    }
+}
+
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
+{
     /*
      * === PHASE 1: 更新球体位置 ===
-     * 使用李萨如曲线让球体在屏幕内平滑游走
+     * 使用李萨如曲线让球体在屏幕内平滑游走 (前 3 个球的频率与原先一致)
      */
     int center_x = TEX_WIDTH / 2;
     int center_y = TEX_HEIGHT / 2;
     int amp_x    = center_x - AMP_MARGIN;
     int amp_y    = center_y - AMP_MARGIN;
 
-    for (int i = 0; i < BALL_COUNT; i++)
+    for (int i = 0; i < g_ball_count; i++)
     {
-        int t = g_tick + i * 170;
+        int t  = g_tick + i * 170;
+        int fx = 1 + i % 3;
+        int fy = 2 + (i + i / 3) % 3;
         // x = center + amp * sin(...)
         // 使用 Q12 乘法然后右移恢复整数
-        g_balls[i].x = center_x + ((GET_COS(t * (i + 1)) * amp_x) >> Q12_SHIFT);
-        g_balls[i].y = center_y + ((GET_SIN(t * (i + 2) / 2) * amp_y) >> Q12_SHIFT);
+        g_balls[i].x = center_x + ((GET_COS(t * fx) * amp_x) >> Q12_SHIFT);
+        g_balls[i].y = center_y + ((GET_SIN(t * fy / 2) * amp_y) >> Q12_SHIFT);
     }
 
     /*
      * === PHASE 2: 场强度计算 (Metaball Isosurface) ===
-     * 遍历每个像素，计算它受到的总“热量”
+     * 逐分块筛选有贡献的球，再对块内像素累加 strength / dist^2 (查表)
      */
-    uint16_t *p_pixel = g_tex_vir_addr;
-
-    // 优化：将常数提取
-    // 场强度公式：Intensity = Radius / Distance^2
+    uint8_t *tex_vir = (uint8_t *)tex->vir;
 
-    for (int y = 0; y < TEX_HEIGHT; y++)
+    for (int ty = 0; ty < TILES_Y; ty++)
     {
-        // 预计算每个球的 dy^2
-        int dy2[BALL_COUNT];
-        for (int k = 0; k < BALL_COUNT; k++)
+        for (int tx = 0; tx < TILES_X; tx++)
         {
-            int dy = y - g_balls[k].y;
-            dy2[k] = dy * dy;
-        }
+            int x0 = tx * TILE;
+            int y0 = ty * TILE;
+            int active[BALL_MAX];
+            int n = 0;
 
-        for (int x = 0; x < TEX_WIDTH; x++)
-        {
-            int intensity = 0;
-
-            for (int k = 0; k < BALL_COUNT; k++)
+            for (int k = 0; k < g_ball_count; k++)
             {
-                int dx = x - g_balls[k].x;
-                // 距离平方
-                int dist_sq = dx * dx + dy2[k];
-
-                // 避免除零，且让核心更亮
-                if (dist_sq < 1)
-                    dist_sq = 1;
-
-                intensity += (FIELD_STRENGTH / dist_sq);
+                // 球心到分块矩形的最近距离
+                int dx = MAX(MAX(x0 - g_balls[k].x, g_balls[k].x - (x0 + TILE - 1)), 0);
+                int dy = MAX(MAX(y0 - g_balls[k].y, g_balls[k].y - (y0 + TILE - 1)), 0);
+                if (dx * dx + dy * dy <= g_field_strength)
+                    active[n++] = k;
             }
 
-            // 映射到调色板 (0~255)
-            intensity  = MIN(intensity, 255);
-            *p_pixel++ = g_palette[intensity];
+            uint8_t *dst = tex_vir + y0 * tex->stride + x0;
+            if (n == 0)
+            {
+                for (int y = 0; y < TILE; y++)
+                    memset(dst + y * tex->stride, 0, TILE);
+                continue;
+            }
+            field_tile(dst, tex->stride, x0, y0, active, n);
         }
     }
 
-    /* === CRITICAL: Cache Flush === */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    g_tick++;
+}
 
-    /* === PHASE 3: GE Hardware Scaling === */
+/* === PHASE 3: GE Hardware Scaling (只 emit，由引擎负责 sync) === */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     blt.dst_buf.buf_type    = MPP_PHY_ADDR;
@@ -237,26 +322,20 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     }
 
     mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
-
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
 }
 
 struct effect_ops effect_0010 = {
-    .name   = "NO.10 THE MAGNETIC FLUID",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name        = "NO.10 THE MAGNETIC FLUID",
+    .init        = effect_init,
+    .compute     = effect_compute,
+    .submit      = effect_submit,
+    .tex_w       = TEX_WIDTH,
+    .tex_h       = TEX_HEIGHT,
+    .palette     = g_palette,
+    .prepare     = effect_prepare,
+    .unprepare   = effect_unprepare,
+    .bench_loads = g_bench_loads,
+    .set_load    = effect_set_load,
 };
 
 REGISTER_EFFECT(effect_0010);
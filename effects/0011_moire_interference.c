@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -65,17 +67,16 @@ static int          g_tick         = 0;
 
 /*
  * 预计算查找表
- * sin_lut: 用于波源的运动轨迹 (Q12)
+ * 正弦: 共享的 demo_sin_q12，用于波源的运动轨迹 (Q12)
  * g_palette: 用于将干涉值映射为刺眼的电光色
  */
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
 
 static int effect_init(struct demo_ctx *ctx)
 {
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 11: CMA Alloc Failed.");
@@ -83,13 +84,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 1. 初始化正弦表 (Q12: 4096 = 1.0)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 2. 初始化调色板：电光幻影
+    // 1. 初始化调色板：电光幻影
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // 使用非线性映射创造锐利的边缘
@@ -122,8 +117,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -228,7 +223,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_lut.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -59,7 +61,7 @@ static uint16_t    *g_tex_vir_addr = NULL;
 static int          g_tick         = 0;
 
 /*
- * 极坐标查找表 (Coordinate LUTs)
+ * 极坐标查找表 (Coordinate LUTs，两张表共用一次分配)
  * 存储屏幕上每个点对应的纹理坐标 (U, V)
  * U = Angle (0~255), V = Radius (0~255)
  */
@@ -71,34 +73,21 @@ static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+/* LUT 缓存参数：任一项变化都会使 /data 中的缓存失效 */
+static const struct
 {
-    // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 12: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+    int   w, h;
+    float symmetry;
+    float radius_scale;
+} g_lut_params = {TEX_WIDTH, TEX_HEIGHT, SYMMETRY, RADIUS_SCALE};
 
-    // 2. LUT 内存分配 (普通堆内存)
-    // 320 * 240 * 1 bytes * 2 tables = 150KB
-    g_lut_angle  = (uint8_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT);
-    g_lut_radius = (uint8_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT);
-
-    if (!g_lut_angle || !g_lut_radius)
-    {
-        LOG_E("Night 12: LUT Alloc Failed.");
-        mpp_phy_free(g_tex_phy_addr);
-        return -1;
-    }
-
-    // 3. 预计算极坐标映射 (Polar Transformation)
+/* 预计算极坐标映射 (Polar Transformation)：buf 依次存放角度表与半径表 */
+static void build_polar_lut(void *buf, size_t size)
+{
     int      cx    = TEX_WIDTH / 2;
     int      cy    = TEX_HEIGHT / 2;
-    uint8_t *p_ang = g_lut_angle;
-    uint8_t *p_rad = g_lut_radius;
+    uint8_t *p_ang = (uint8_t *)buf;
+    uint8_t *p_rad = p_ang + TEX_WIDTH * TEX_HEIGHT;
 
     for (int y = 0; y < TEX_HEIGHT; y++)
     {
@@ -124,8 +113,36 @@ static int effect_init(struct demo_ctx *ctx)
             *p_rad++ = (uint8_t)(v & 0xFF);
         }
     }
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    if (g_lut_angle)
+    {
+        rt_free(g_lut_angle);
+        g_lut_angle  = NULL;
+        g_lut_radius = NULL;
+    }
+}
+
+/* 预备阶段 (可能运行于预备线程)：极坐标表与调色板只由 CPU 读取，极坐标表缓存于 /data */
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 1. LUT 内存分配 (普通堆内存)，两张表合为一块以便整块读写
+    // 320 * 240 * 1 bytes * 2 tables = 150KB
+    size_t lut_size = TEX_WIDTH * TEX_HEIGHT * 2;
+    g_lut_angle     = (uint8_t *)rt_malloc(lut_size);
+    if (!g_lut_angle)
+    {
+        LOG_E("Night 12: LUT Alloc Failed.");
+        return -1;
+    }
+    g_lut_radius = g_lut_angle + TEX_WIDTH * TEX_HEIGHT;
+
+    // 2. 载入或预计算极坐标映射
+    demo_lut_fetch("0012_polar", &g_lut_params, sizeof(g_lut_params), g_lut_angle, lut_size, build_polar_lut);
 
-    // 4. 初始化迷幻调色板
+    // 3. 初始化迷幻调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // HSL 风格生成
@@ -144,6 +161,19 @@ static int effect_init(struct demo_ctx *ctx)
 
         g_palette[i] = RGB2RGB565(r, g, b);
     }
+    return 0;
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // CMA 显存
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    if (g_tex_phy_addr == 0)
+    {
+        LOG_E("Night 12: CMA Alloc Failed.");
+        return -1;
+    }
+    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
     g_tick = 0;
     rt_kprintf("Night 12: Space folded into polar coordinates.\n");
@@ -232,27 +262,19 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
-    if (g_lut_angle)
-    {
-        rt_free(g_lut_angle);
-        g_lut_angle = NULL;
-    }
-    if (g_lut_radius)
-    {
-        rt_free(g_lut_radius);
-        g_lut_radius = NULL;
-    }
 }
 
 struct effect_ops effect_0012 = {
-    .name   = "NO.12 THE KALEIDOSCOPIC VOID",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name      = "NO.12 THE KALEIDOSCOPIC VOID",
+    .init      = effect_init,
+    .draw      = effect_draw,
+    .deinit    = effect_deinit,
+    .prepare   = effect_prepare,
+    .unprepare = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0012);
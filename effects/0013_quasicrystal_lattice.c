@@ -29,6 +29,7 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -84,7 +85,7 @@ static Wave g_waves[WAVE_COUNT];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 13: CMA Alloc Failed.");
@@ -253,7 +254,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
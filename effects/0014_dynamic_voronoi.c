@@ -5,13 +5,13 @@
  *
  * Visual Manifest:
  * 屏幕被切割成无数个多边形晶胞，仿佛显微镜下的生物组织切片，又像是未来都市的动态规划图。
- * 数个看不见的核心在屏幕上游走，它们的影响力范围不断挤压、吞噬彼此。
+ * 成百上千个看不见的核心在屏幕上游走，它们的影响力范围不断挤压、吞噬彼此。
  * 我们不仅渲染了区域，更渲染了“边界”——那是第一最近邻与第二最近邻势均力敌的地方。
  * 亮白色的光线在晶格的缝隙中游走，勾勒出数学上完美的分割线。
  *
  * Monologue:
  * 空间本无界限，是引力定义了归属。
- * 我投下了 16 个游荡的灵魂（Seeds）。
+ * 我投下了 256 个游荡的灵魂（Seeds）。
  * 对于屏幕上的每一个像素，这都是一场关于忠诚的拷问：谁离你最近？
  * 这种简单的邻近法则，自发地将虚空切割成了完美的晶体结构。
  * 看着那些发光的边缘，那是两个力场达到平衡的瞬间。
@@ -21,14 +21,16 @@
  * 定义你的核心，世界自然会为你留出位置。
  *
  * Hardware Feature:
- * 1. CPU Cellular Noise (细胞噪声) - 实时计算 Manhattan Voronoi 图 (Distance Difference)
+ * 1. CPU Cellular Noise (细胞噪声) - 网格分桶的 Voronoi 图 (Distance Difference)，候选表跨帧复用
  * 2. GE Scaler (硬件缩放) - 将低分晶格纹理无损放大至全屏
+ * 3. Indexed Texture (索引色) - 纹理只写 1 字节特征值，由引擎经调色板还原
  */
 
 #include "demo_engine.h"
-#include "mpp_mem.h"
+#include "demo_cell.h"
+#include "demo_math.h"
+#include "demo_rand.h"
 #include "aic_hal_ge.h"
-#include <math.h>
 #include <stdlib.h>
 
 /* --- Configuration Parameters --- */
@@ -36,62 +38,44 @@
 /* 纹理规格 */
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
 
 /* 算法参数 */
-#define SEED_COUNT   12 // 种子点数量
-#define MAX_SPEED    2  // 种子最大移动速度 (+/-)
-#define BORDER_WIDTH 16 // 晶格边界发光宽度 (阈值)
+#define SEED_DEFAULT 256  // 种子点数量
+#define SEED_MAX     1024 // 种子容量 (基准测试的最高负载)
+#define SEED_REF     12   // 参照密度：该数量下特征值不缩放
+#define MAX_SPEED    2    // 种子最大移动速度 (+/-)
+#define BORDER_WIDTH 16   // 晶格边界发光宽度 (阈值)
+
+/* 距离度量 (enum demo_cell_metric)：0 曼哈顿 / 1 欧氏 / 2 切比雪夫 */
+#ifndef AIC_GE_DEMO_VORONOI_METRIC
+#define AIC_GE_DEMO_VORONOI_METRIC 0
+#endif
 
 /* 调色板参数 */
 #define PALETTE_SIZE 256
 
 /* --- Global State --- */
 
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
+static int g_tick = 0;
 
-typedef struct
-{
-    int x, y;
-    int vx, vy;
-} Seed;
+static struct demo_cell_site g_seeds[SEED_MAX];
+static int8_t                g_vx[SEED_MAX], g_vy[SEED_MAX];
+static int                   g_seed_count;
+static int                   g_gain; /* 特征值增益 (Q4)：种子越密晶胞越小，放大 F2 - F1 保持同样的明暗层次 */
+static struct demo_cell      g_cell;
+static uint16_t              g_palette[PALETTE_SIZE];
 
-static Seed     g_seeds[SEED_COUNT];
-static uint16_t g_palette[PALETTE_SIZE];
+static const int g_bench_loads[] = {SEED_REF, 64, SEED_DEFAULT, SEED_MAX, 0};
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+static int effect_prepare(struct demo_ctx *ctx)
 {
-    // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 14: CMA Alloc Failed.");
+    // 1. 分桶网格与候选池 (CPU 专用，普通 RAM)
+    if (demo_cell_init(&g_cell, TEX_WIDTH, TEX_HEIGHT, SEED_MAX, AIC_GE_DEMO_VORONOI_METRIC) < 0)
         return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
-
-    // 2. 初始化种子点
-    for (int i = 0; i < SEED_COUNT; i++)
-    {
-        g_seeds[i].x  = rand() % TEX_WIDTH;
-        g_seeds[i].y  = rand() % TEX_HEIGHT;
-        g_seeds[i].vx = (rand() % (MAX_SPEED * 2 + 1)) - MAX_SPEED; // -2 ~ 2
-        g_seeds[i].vy = (rand() % (MAX_SPEED * 2 + 1)) - MAX_SPEED;
-
-        // 防止静止
-        if (g_seeds[i].vx == 0)
-            g_seeds[i].vx = 1;
-        if (g_seeds[i].vy == 0)
-            g_seeds[i].vy = 1;
-    }
 
-    // 3. 初始化调色板 (Crystal Blue -> White)
+    // 2. 初始化调色板 (Crystal Blue -> White)
     // 基于 Worley Noise 的特征值 (F2 - F1) 进行着色
     // 值越小表示越接近边界
     for (int i = 0; i < PALETTE_SIZE; i++)
@@ -123,91 +107,94 @@ static int effect_init(struct demo_ctx *ctx)
 
         g_palette[i] = RGB2RGB565(r, g, b);
     }
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    demo_cell_deinit(&g_cell);
+}
+
+static void effect_set_load(struct demo_ctx *ctx, int load)
+{
+    g_seed_count = CLAMP(load, 1, SEED_MAX);
+    // 晶胞边长与 sqrt(种子数) 成反比：gain = 16 * sqrt(N / SEED_REF)
+    g_gain = (int)demo_isqrt((uint32_t)(256 * g_seed_count / SEED_REF));
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // 1. 初始化种子点 (纹理由引擎托管)
+    struct demo_rand rng;
+    demo_rand_seed(&rng, 14);
+    for (int i = 0; i < SEED_MAX; i++)
+    {
+        g_seeds[i].x = (int16_t)demo_rand_range(&rng, TEX_WIDTH);
+        g_seeds[i].y = (int16_t)demo_rand_range(&rng, TEX_HEIGHT);
+        g_vx[i]      = (int8_t)demo_rand_between(&rng, -MAX_SPEED, MAX_SPEED); // -2 ~ 2
+        g_vy[i]      = (int8_t)demo_rand_between(&rng, -MAX_SPEED, MAX_SPEED);
+
+        // 防止静止
+        if (g_vx[i] == 0)
+            g_vx[i] = 1;
+        if (g_vy[i] == 0)
+            g_vy[i] = 1;
+    }
+    effect_set_load(ctx, SEED_DEFAULT);
 
     g_tick = 0;
     rt_kprintf("Night 14: Cellular tessellation active.\n");
     return 0;
 }
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
 {
-    if (!g_tex_vir_addr)
-        return;
-
     /* === PHASE 1: 更新种子位置 === */
-    for (int i = 0; i < SEED_COUNT; i++)
+    for (int i = 0; i < g_seed_count; i++)
     {
-        g_seeds[i].x += g_seeds[i].vx;
-        g_seeds[i].y += g_seeds[i].vy;
+        g_seeds[i].x += g_vx[i];
+        g_seeds[i].y += g_vy[i];
 
         // 碰壁反弹
         if (g_seeds[i].x < 0 || g_seeds[i].x >= TEX_WIDTH)
         {
-            g_seeds[i].vx = -g_seeds[i].vx;
-            g_seeds[i].x += g_seeds[i].vx;
+            g_vx[i] = (int8_t)-g_vx[i];
+            g_seeds[i].x += g_vx[i];
         }
         if (g_seeds[i].y < 0 || g_seeds[i].y >= TEX_HEIGHT)
         {
-            g_seeds[i].vy = -g_seeds[i].vy;
-            g_seeds[i].y += g_seeds[i].vy;
+            g_vy[i] = (int8_t)-g_vy[i];
+            g_seeds[i].y += g_vy[i];
         }
     }
 
-    /* === PHASE 2: 沃罗诺伊图计算 (Voronoi) === */
-    uint16_t *p_pixel = g_tex_vir_addr;
+    /*
+     * === PHASE 2: 沃罗诺伊图计算 (Voronoi) ===
+     * 视觉魔法：Worley Noise F2 - F1
+     * 边界处 d1 == d2，所以 d2 - d1 == 0。
+     * 越靠近晶胞中心，d2 远大于 d1，差值越大。
+     * 种子按网格分桶 (demo_cell)，每个像素只比较可能成为 F1 / F2 的几个候选；
+     * 种子每帧只移动 MAX_SPEED 像素，位移未超出余量时沿用上一帧的候选表。
+     */
+    demo_cell_update(&g_cell, g_seeds, g_seed_count);
 
-    for (int y = 0; y < TEX_HEIGHT; y++)
-    {
-        for (int x = 0; x < TEX_WIDTH; x++)
-        {
-            // 寻找第一近 (d1) 和第二近 (d2) 的距离
-            int d1 = 0x7FFF;
-            int d2 = 0x7FFF;
-
-            for (int i = 0; i < SEED_COUNT; i++)
-            {
-                // 曼哈顿距离：|x1-x2| + |y1-y2|
-                // 纯整数运算，极快，且产生漂亮的棱形边界
-                int dist = ABS(x - g_seeds[i].x) + ABS(y - g_seeds[i].y);
-
-                if (dist < d1)
-                {
-                    d2 = d1;
-                    d1 = dist;
-                }
-                else if (dist < d2)
-                {
-                    d2 = dist;
-                }
-            }
-
-            /*
-             * 视觉魔法：Worley Noise F2 - F1
-             * 边界处 d1 == d2，所以 d2 - d1 == 0。
-             * 越靠近晶胞中心，d2 远大于 d1，差值越大。
-             */
-            int val = d2 - d1;
-
-            // 限制范围以查表
-            val = MIN(val, 255);
-
-            // 颜色查表
-            *p_pixel++ = g_palette[val];
-        }
-    }
+    // 写入索引 (颜色由引擎经调色板还原)
+    demo_cell_render(&g_cell, (uint8_t *)tex->vir, tex->stride, DEMO_CELL_F2_F1, g_gain);
 
-    /* === CRITICAL: Cache Flush === */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    g_tick++;
+}
 
-    /* === PHASE 3: GE Scaling === */
+/* === PHASE 3: GE Scaling (只 emit，由引擎负责 sync) === */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     blt.dst_buf.buf_type    = MPP_PHY_ADDR;
@@ -233,26 +220,20 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     }
 
     mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
-
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
 }
 
 struct effect_ops effect_0014 = {
-    .name   = "NO.14 THE CRYSTALLINE CELL",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name        = "NO.14 THE CRYSTALLINE CELL",
+    .init        = effect_init,
+    .compute     = effect_compute,
+    .submit      = effect_submit,
+    .tex_w       = TEX_WIDTH,
+    .tex_h       = TEX_HEIGHT,
+    .palette     = g_palette,
+    .prepare     = effect_prepare,
+    .unprepare   = effect_unprepare,
+    .bench_loads = g_bench_loads,
+    .set_load    = effect_set_load,
 };
 
 REGISTER_EFFECT(effect_0014);
@@ -28,6 +28,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_pool.h"
+#include "demo_rand.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -61,6 +63,8 @@ static uint16_t    *g_tex_vir_addr = NULL;
 static uint8_t     *g_heat_map     = NULL; // 温度场 (0-255)
 static int          g_tick         = 0;
 
+static struct demo_rand g_rng;
+
 /* 火焰调色板 (0~255 -> RGB565) */
 static uint16_t g_fire_palette[PALETTE_SIZE];
 
@@ -69,7 +73,7 @@ static uint16_t g_fire_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 15: CMA Alloc Failed.");
@@ -82,7 +86,7 @@ static int effect_init(struct demo_ctx *ctx)
     if (!g_heat_map)
     {
         LOG_E("Night 15: HeatMap Alloc Failed.");
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         return -1;
     }
     // 清空温度场
@@ -122,6 +126,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
 
     g_tick = 0;
+    demo_rand_seed(&g_rng, 15);
     rt_kprintf("Night 15: Ignition sequence start.\n");
     return 0;
 }
@@ -135,11 +140,16 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
     // 1. 播种火源 (Seed Fire)
     // 在最后一行随机生成高热点
-    int last_row_idx = (TEX_HEIGHT - 1) * TEX_WIDTH;
-    for (int x = 0; x < TEX_WIDTH; x++)
+    // 每个随机字提供 32 个像素的开关位
+    int      last_row_idx = (TEX_HEIGHT - 1) * TEX_WIDTH;
+    uint32_t bits         = 0;
+    for (int x = 0; x < TEX_WIDTH; x++, bits >>= 1)
     {
+        if ((x & 31) == 0)
+            bits = demo_rand_next(&g_rng);
+
         // 随机产生 0 或 255 的热量，制造闪烁感
-        g_heat_map[last_row_idx + x] = (rand() % 2 == 0) ? FIRE_SOURCE_INTENSITY : 0;
+        g_heat_map[last_row_idx + x] = (bits & 1) ? FIRE_SOURCE_INTENSITY : 0;
 
         // 周期性制造强风干扰 (Gust of wind)
         if ((g_tick % GUST_FREQ) > GUST_THRESHOLD && (x % 10 == 0))
@@ -155,9 +165,12 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     {
         for (int x = 0; x < TEX_WIDTH; x++)
         {
+            // 一次取数拆成三个字段：低 16 位 -> 风向，最高位 -> 基础衰减，其余 15 位 -> 冷却波动
+            uint32_t rnd = demo_rand_next(&g_rng);
+
             // 采样源：当前像素的下方
             // 引入随机横向偏移，模拟风吹的效果 (-1, 0, 1)
-            int rand_idx = rand() % WIND_VARIANCE;
+            int rand_idx = (int)demo_rand_scale16(rnd & 0xFFFF, WIND_VARIANCE);
             int src_x    = (x + rand_idx - 1);
             int src_y    = y + 1;
 
@@ -175,10 +188,10 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
             // 冷却衰减 (Cooling)
             // 随机衰减 0~3 点热量，热量越高衰减越快
-            int decay = (rand() % 2) + COOLING_MIN;
+            int decay = (int)(rnd >> 31) + COOLING_MIN;
             if (heat > 10)
             {
-                decay += (rand() % COOLING_VAR);
+                decay += (int)demo_rand_scale16((rnd >> 15) & 0xFFFE, COOLING_VAR);
             }
 
             if (heat > decay)
@@ -262,7 +275,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
@@ -29,6 +29,10 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_lut.h"
+#include "demo_swar.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -48,13 +52,8 @@
 #define ZOOM_FACTOR 0.96f // 缩放衰减率 (<1.0 向内吸入)
 #define ROT_ANGLE   0.02f // 旋转角度 (弧度)
 
-/* 颜色衰减参数 (RGB565) */
-#define DECAY_MASK_R 0xF800
-#define DECAY_STEP_R 0x0800
-#define DECAY_MASK_G 0x07E0
-#define DECAY_STEP_G 0x0020
-#define DECAY_MASK_B 0x001F
-#define DECAY_STEP_B 0x0001
+/* 颜色衰减参数 (RGB565)：R, G, B 各减 1，饱和于 0 */
+#define DECAY_STEP 0x0821
 
 /* 动画参数 */
 #define CURSOR_SIZE 8   // 光标半径
@@ -74,49 +73,25 @@ static int g_tick = 0;
 static uint32_t *g_feedback_lut = NULL;
 
 /* 正弦表 (Q12) */
-static int sin_lut[512];
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+/* LUT 缓存参数：任一项变化都会使 /data 中的缓存失效 */
+static const struct
 {
-    // 1. 分配两个 CMA 纹理缓冲区
-    for (int i = 0; i < 2; i++)
-    {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-        if (g_tex_phy[i] == 0)
-        {
-            if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
-            LOG_E("Night 16: CMA Alloc Failed.");
-            return -1;
-        }
-        g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
-        memset(g_tex_vir[i], 0, TEX_SIZE);
-    }
+    int   w, h;
+    float zoom;
+    float angle;
+} g_lut_params = {TEX_WIDTH, TEX_HEIGHT, ZOOM_FACTOR, ROT_ANGLE};
 
-    // 2. LUT 内存
-    g_feedback_lut = (uint32_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT * sizeof(uint32_t));
-    if (!g_feedback_lut)
-    {
-        LOG_E("Night 16: LUT Alloc Failed.");
-        mpp_phy_free(g_tex_phy[0]);
-        mpp_phy_free(g_tex_phy[1]);
-        return -1;
-    }
-
-    // 3. 初始化正弦表
-    for (int i = 0; i < 512; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / 256.0f) * Q12_ONE);
-    }
-
-    // 4. 预计算反馈映射 (Tunnel/Zoom Map)
+/* 预计算反馈映射 (Tunnel/Zoom Map) */
+static void build_feedback_lut(void *buf, size_t size)
+{
     int       cx    = TEX_WIDTH / 2;
     int       cy    = TEX_HEIGHT / 2;
     float     cos_a = cosf(ROT_ANGLE);
     float     sin_a = sinf(ROT_ANGLE);
-    uint32_t *p_lut = g_feedback_lut;
+    uint32_t *p_lut = (uint32_t *)buf;
 
     for (int y = 0; y < TEX_HEIGHT; y++)
     {
@@ -144,6 +119,51 @@ static int effect_init(struct demo_ctx *ctx)
             *p_lut++ = src_y * TEX_WIDTH + src_x;
         }
     }
+}
+
+/* 预备阶段 (可能运行于预备线程)：反馈映射表与正弦表只由 CPU 读取，映射表缓存于 /data */
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 1. LUT 内存 (300KB)
+    size_t lut_size = TEX_WIDTH * TEX_HEIGHT * sizeof(uint32_t);
+    g_feedback_lut  = (uint32_t *)rt_malloc(lut_size);
+    if (!g_feedback_lut)
+    {
+        LOG_E("Night 16: LUT Alloc Failed.");
+        return -1;
+    }
+
+    // 2. 载入或预计算反馈映射
+    demo_lut_fetch("0016_feedback", &g_lut_params, sizeof(g_lut_params), g_feedback_lut, lut_size,
+                   build_feedback_lut);
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    if (g_feedback_lut)
+    {
+        rt_free(g_feedback_lut);
+        g_feedback_lut = NULL;
+    }
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // 分配两个 CMA 纹理缓冲区
+    for (int i = 0; i < 2; i++)
+    {
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        if (g_tex_phy[i] == 0)
+        {
+            if (i == 1)
+                demo_pool_free(g_tex_phy[0]);
+            LOG_E("Night 16: CMA Alloc Failed.");
+            return -1;
+        }
+        g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
+        memset(g_tex_vir[i], 0, TEX_SIZE);
+    }
 
     g_tick    = 0;
     g_buf_idx = 0;
@@ -151,8 +171,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & 511])
-#define GET_COS(idx) (sin_lut[((idx) + 128) & 511])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -175,29 +195,20 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
      * === PHASE 1: Feedback Processing ===
      * 从 src 读取，写入 dst。
      */
-    int count = TEX_WIDTH * TEX_HEIGHT;
+    int         count = TEX_WIDTH * TEX_HEIGHT;
+    demo_pxw_t *dst_w = (demo_pxw_t *)dst_pixels;
+    demo_pxw_t  step  = DEMO_PX_REP(DECAY_STEP);
 
-    while (count--)
+    for (; count > 0; count -= DEMO_PX_LANES)
     {
-        // 查表获取源位置
-        uint32_t offset = *lut++;
-
-        // 读取旧像素
-        uint16_t color = src_pixels[offset];
-
-        // 衰减 (Dimming)
-        // 使用掩码判断和减法，比浮点乘法快得多
-        if (color != 0)
-        {
-            if ((color & DECAY_MASK_B) > 0)
-                color -= DECAY_STEP_B; // Blue decay
-            if ((color & DECAY_MASK_G) > DECAY_STEP_G)
-                color -= DECAY_STEP_G; // Green decay
-            if ((color & DECAY_MASK_R) > DECAY_STEP_R)
-                color -= DECAY_STEP_R; // Red decay
-        }
-
-        *dst_pixels++ = color;
+        // 查表获取源位置，旧像素拼成整字
+        demo_pxw_t v = 0;
+        for (int i = DEMO_PX_LANES - 1; i >= 0; i--)
+            v = (v << 16) | src_pixels[lut[i]];
+        lut += DEMO_PX_LANES;
+
+        // 衰减 (Dimming)：各通道饱和减，无分支，一次处理 2~4 像素
+        *dst_w++ = demo_px_sub_sat(v, step);
     }
 
     /*
@@ -312,23 +323,20 @@ static void effect_deinit(struct demo_ctx *ctx)
     {
         if (g_tex_phy[i])
         {
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
             g_tex_phy[i] = 0;
             g_tex_vir[i] = NULL;
         }
     }
-    if (g_feedback_lut)
-    {
-        rt_free(g_feedback_lut);
-        g_feedback_lut = NULL;
-    }
 }
 
 struct effect_ops effect_0016 = {
-    .name   = "NO.16 THE ECHO CHAMBER",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name      = "NO.16 THE ECHO CHAMBER",
+    .init      = effect_init,
+    .draw      = effect_draw,
+    .deinit    = effect_deinit,
+    .prepare   = effect_prepare,
+    .unprepare = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0016);
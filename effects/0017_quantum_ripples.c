@@ -24,84 +24,60 @@
  * 扰动，是宇宙呼吸的方式。
  *
  * Hardware Feature:
- * 1. CPU Physics (物理模拟) - 实时解算 2D 波动方程 (Wave Equation)
- * 2. GE Scaler (硬件缩放) - 将低分流体纹理平滑放大，模拟水面的柔光感
+ * 1. CPU Physics (物理模拟) - 实时解算 2D 波动方程 (Wave Equation)，整字并行、与着色融合为单遍扫描 (demo_wave)
+ * 2. GE Scaler (硬件缩放) - 将低分流体纹理平滑放大，模拟水面的柔光感；可选半分辨率解算，由 GE 双线性放大
+ * 3. Indexed Palette (索引色) - 每像素只写 1 字节高度索引，颜色由 DE gamma 或引擎展开还原
  */
 
 #include "demo_engine.h"
+#include "demo_rand.h"
+#include "demo_wave.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
-#include <stdlib.h>
 #include <string.h>
 
 /* --- Configuration Parameters --- */
 
-/* 纹理规格 */
+/* 纹理规格 (即解算网格)：半分辨率时波纹尺度加倍，由 GE 放大补齐 */
+#ifdef AIC_GE_DEMO_RIPPLE_HALF
+#define TEX_WIDTH  (DEMO_QVGA_W / 2)
+#define TEX_HEIGHT (DEMO_QVGA_H / 2)
+#else
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
+#endif
+#define TEX_SCALE (DEMO_QVGA_W / TEX_WIDTH) /* 相对 QVGA 的缩小倍数 */
 
 /* 物理模拟参数 */
 #define DAMPING_SHIFT   5    // 阻尼衰减 (val -= val >> 5)
-#define RIPPLE_STRENGTH 1000 // 激起波浪的能量强度 (int16_t)
+#define RIPPLE_STRENGTH 1000 // 激起波浪的能量强度
 #define RAIN_FREQ       4    // 雨滴频率 (每 N 帧一滴)
-#define MAP_SIZE        (TEX_WIDTH * TEX_HEIGHT * sizeof(int16_t))
 
 /* 渲染映射参数 */
 #define SEA_LEVEL    128 // 海平面基准色索引
 #define HEIGHT_SHIFT 2   // 高度转颜色的缩放 (val >> 2)
+#define PALETTE_SIZE 256
 
 /* --- Global State --- */
 
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
-
-/* 两个高度图：当前帧和上一帧 (int16_t 以支持负波谷) */
-static int16_t *g_buf1 = NULL;
-static int16_t *g_buf2 = NULL;
+static int              g_tick = 0;
+static struct demo_rand g_rng;
+static struct demo_wave g_wave; /* 两帧高度场 (普通 RAM，仅 CPU 计算使用) */
 
 /* 预计算调色板 (根据高度映射颜色) */
-static uint16_t g_palette[256];
+static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+static int effect_prepare(struct demo_ctx *ctx)
 {
-    // 1. CMA 显存 (纹理)
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 17: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
-
-    // 2. 高度图内存 (普通 RAM，仅 CPU 计算使用)
-    g_buf1 = (int16_t *)rt_malloc(MAP_SIZE);
-    g_buf2 = (int16_t *)rt_malloc(MAP_SIZE);
-
-    if (!g_buf1 || !g_buf2)
-    {
-        LOG_E("Night 17: Heightmap Alloc Failed.");
-        if (g_buf1)
-            rt_free(g_buf1);
-        if (g_buf2)
-            rt_free(g_buf2);
-        mpp_phy_free(g_tex_phy_addr);
+    // 1. 高度场
+    if (demo_wave_init(&g_wave, TEX_WIDTH, TEX_HEIGHT, DAMPING_SHIFT) < 0)
         return -1;
-    }
 
-    // 清零
-    memset(g_buf1, 0, MAP_SIZE);
-    memset(g_buf2, 0, MAP_SIZE);
-    memset(g_tex_vir_addr, 0, TEX_SIZE);
-
-    // 3. 初始化调色板 (Deep Blue -> Cyan -> White)
-    for (int i = 0; i < 256; i++)
+    // 2. 初始化调色板 (Deep Blue -> Cyan -> White)
+    for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r, g, b;
 
@@ -125,116 +101,73 @@ static int effect_init(struct demo_ctx *ctx)
 
         g_palette[i] = RGB2RGB565(r, g, b);
     }
+    return 0;
+}
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    demo_wave_deinit(&g_wave);
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    // 平静的液面 (纹理由引擎托管)
+    demo_wave_reset(&g_wave);
 
     g_tick = 0;
+    demo_rand_seed(&g_rng, 17);
     rt_kprintf("Night 17: Fluid dynamics engine started.\n");
     return 0;
 }
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
 {
-    if (!g_tex_vir_addr || !g_buf1 || !g_buf2)
-        return;
-
     /*
-     * === PHASE 1: 物理模拟 (Physics) ===
-     * 交换缓冲区：当前帧变为上一帧
+     * === PHASE 1: 扰动 (Disturbance) ===
+     * 写入最新一帧的高度场，下一步解算时向四周扩散
      */
-    int16_t *curr = g_buf1;
-    int16_t *prev = g_buf2;
-
-    // 交换指针 (Ping-Pong)
-    if (g_tick % 2 == 0)
-    {
-        curr = g_buf2;
-        prev = g_buf1;
-    }
 
     // 1. 制造扰动 (Raindrops)
     if (g_tick % RAIN_FREQ == 0)
     {
-        int rx = (rand() % (TEX_WIDTH - 4)) + 2;
-        int ry = (rand() % (TEX_HEIGHT - 4)) + 2;
+        int rx = demo_rand_between(&g_rng, 2, TEX_WIDTH - 3);
+        int ry = demo_rand_between(&g_rng, 2, TEX_HEIGHT - 3);
         // 激起波浪
-        prev[ry * TEX_WIDTH + rx] = RIPPLE_STRENGTH;
+        demo_wave_poke(&g_wave, rx, ry, RIPPLE_STRENGTH);
     }
 
     // 移动的扰动源 (像手指划过水面)
-    int tx = (TEX_WIDTH / 2) + (int)(sinf(g_tick * 0.05f) * 100.0f);
-    int ty = (TEX_HEIGHT / 2) + (int)(cosf(g_tick * 0.03f) * 80.0f);
+    int tx = (TEX_WIDTH / 2) + (int)(sinf(g_tick * 0.05f) * 100.0f) / TEX_SCALE;
+    int ty = (TEX_HEIGHT / 2) + (int)(cosf(g_tick * 0.03f) * 80.0f) / TEX_SCALE;
 
     // 边界检查确保安全
     if (tx >= 2 && tx < TEX_WIDTH - 2 && ty >= 2 && ty < TEX_HEIGHT - 2)
     {
-        prev[ty * TEX_WIDTH + tx] = RIPPLE_STRENGTH;
-    }
-
-    // 2. 波传播算法 (Wave Propagation)
-    // Val = (Left + Right + Up + Down) / 2 - Val_Prev
-    // Val -= Val >> Damping
-
-    // 优化：跳过 1 像素边界，避免 if 判断
-    for (int y = 1; y < TEX_HEIGHT - 1; y++)
-    {
-        int row_offset = y * TEX_WIDTH;
-
-        int16_t *p_curr = &curr[row_offset];
-        int16_t *p_prev = &prev[row_offset];
-        int16_t *p_up   = &prev[row_offset - TEX_WIDTH];
-        int16_t *p_down = &prev[row_offset + TEX_WIDTH];
-
-        for (int x = 1; x < TEX_WIDTH - 1; x++)
-        {
-            // 核心公式：取周围 4 点平均，减去当前点上一时刻的值 (惯性)
-            int16_t val = (p_up[x] + p_down[x] + p_prev[x - 1] + p_prev[x + 1]) >> 1;
-
-            val -= p_curr[x];
-
-            // 阻尼衰减
-            val -= (val >> DAMPING_SHIFT);
-
-            p_curr[x] = val;
-        }
+        demo_wave_poke(&g_wave, tx, ty, RIPPLE_STRENGTH);
     }
 
     /*
-     * === PHASE 2: 渲染 (Rendering) ===
-     * 将高度图映射为颜色
+     * === PHASE 2: 波传播 + 渲染 (Wave Propagation & Shading) ===
+     * Val = (Left + Right + Up + Down) / 2 - Val_Prev
+     * Val -= Val >> Damping
+     * 每帧一步；每算完一行立即映射为调色板索引 (SEA_LEVEL + (Val >> HEIGHT_SHIFT))
      */
-    uint16_t *p_pixel  = g_tex_vir_addr;
-    int16_t  *p_height = curr; // 使用最新的高度图
-
-    // 跳过第一行 (边界黑边)
-    p_pixel += TEX_WIDTH;
-    p_height += TEX_WIDTH;
-
-    int pixel_count = TEX_WIDTH * (TEX_HEIGHT - 2); // 渲染中间区域
+    demo_wave_step(&g_wave, (uint8_t *)tex->vir, tex->stride, SEA_LEVEL, HEIGHT_SHIFT);
 
-    for (int i = 0; i < pixel_count; i++)
-    {
-        int16_t val = *p_height++;
-
-        // 简单的折射模拟：计算高度差映射
-        int idx = SEA_LEVEL + (val >> HEIGHT_SHIFT);
-
-        // 夹紧
-        idx = CLAMP(idx, 0, 255);
-
-        *p_pixel++ = g_palette[idx];
-    }
-
-    /* === CRITICAL: Cache Flush === */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    g_tick++;
+}
 
-    /* === PHASE 3: GE Hardware Scaling === */
+/* === PHASE 3: GE Hardware Scaling (只 emit，由引擎负责 sync) === */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     blt.dst_buf.buf_type    = MPP_PHY_ADDR;
@@ -256,36 +189,18 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
     mpp_ge_bitblt(ctx->ge, &blt);
     mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
-
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
-    if (g_buf1)
-    {
-        rt_free(g_buf1);
-        g_buf1 = NULL;
-    }
-    if (g_buf2)
-    {
-        rt_free(g_buf2);
-        g_buf2 = NULL;
-    }
 }
 
 struct effect_ops effect_0017 = {
-    .name   = "NO.17 THE QUANTUM SURFACE",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name      = "NO.17 THE QUANTUM SURFACE",
+    .init      = effect_init,
+    .compute   = effect_compute,
+    .submit    = effect_submit,
+    .tex_w     = TEX_WIDTH,
+    .tex_h     = TEX_HEIGHT,
+    .palette   = g_palette,
+    .prepare   = effect_prepare,
+    .unprepare = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0017);
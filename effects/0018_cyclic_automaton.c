@@ -23,80 +23,65 @@
  * 混乱是秩序的土壤，吞噬是进化的动力。
  *
  * Hardware Feature:
- * 1. CPU Simulation (Ping-Pong Buffer) - 使用双缓冲模拟循环细胞自动机 (CCA) 算法
- * 2. GE Scaler (硬件缩放) - 将 QVGA 细胞纹理放大至全屏，观察宏观进化
+ * 1. CPU Simulation (位切片) - 16 个状态拆成 4 个位平面，一个寄存器字同时进化 32/64 个细胞 (demo_ca)
+ * 2. GE Scaler (硬件缩放) - 将 QVGA 细胞纹理放大至全屏，观察宏观进化；可选全分辨率模拟
+ * 3. Indexed Palette (索引色) - compute 每像素只写 1 字节状态号，由 CPU 展开为 RGB565 后再缩放
+ *    (状态号不可插值：15 与 0 之间的缩放像素不应呈现中间状态的颜色，故不走 DE gamma)
  */
 
 #include "demo_engine.h"
+#include "demo_ca.h"
+#include "demo_rand.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
-#include <stdlib.h>
 #include <string.h>
 
 /* --- Configuration Parameters --- */
 
-/* 纹理规格 */
+/* 纹理规格 (即细胞网格)：全分辨率时一个细胞对应一个屏幕像素 */
+#ifdef AIC_GE_DEMO_CCA_FULL
+#define TEX_WIDTH  DEMO_SCREEN_WIDTH
+#define TEX_HEIGHT DEMO_SCREEN_HEIGHT
+#else
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
+#endif
 
 /* CCA 算法参数 */
-#define STATE_COUNT        16     // 状态总数 (物种数量)
-#define MUTATION_THRESHOLD 0xFFF0 // 突变概率阈值 (0~0xFFFF, 越大突变越少)
+#define STATE_COUNT  16 // 状态总数 (物种数量)
+#define MUTATION_P16 15 // 突变概率 (单位 1/65536，约万分之 2.3)
+
+/* 调色板：状态 s 的索引为 s * PALETTE_STEP，节点之间线性过渡 (离散索引，只用到节点本身) */
+#define PALETTE_SIZE 256
+#define PALETTE_STEP (255 / (STATE_COUNT - 1))
 
 /* --- Global State --- */
 
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
+static int              g_tick = 0;
+static struct demo_rand g_rng;
+static struct demo_ca   g_ca; /* 两代位平面 (普通 RAM，仅 CPU 计算使用) */
 
-/* 两个状态缓冲区 (Ping-Pong)，用于逻辑计算 */
-static uint8_t *g_state_buf[2] = {NULL, NULL};
-static int      g_buf_idx      = 0;
+/* 冯诺依曼邻域，任一邻居处于 "我的状态 + 1" 即被同化 */
+static const struct demo_ca_rule g_rule = DEMO_CA_RULE_CYCLIC(STATE_COUNT, DEMO_CA_VON_NEUMANN, 1);
 
 /* 调色板 */
-static uint16_t g_palette[STATE_COUNT];
+static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
 
-static int effect_init(struct demo_ctx *ctx)
+static int effect_prepare(struct demo_ctx *ctx)
 {
-    // 1. CMA 显存 (用于显示)
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
+    // 1. 状态内存：4 个位平面 x 2 代，QVGA 下共 19KB
+    if (demo_ca_init(&g_ca, TEX_WIDTH, TEX_HEIGHT, &g_rule) < 0)
     {
-        LOG_E("Night 18: CMA Alloc Failed.");
+        LOG_E("Night 18: State Buf Alloc Failed.");
         return -1;
     }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
-
-    // 2. 状态内存 (普通 RAM，用于 CPU 逻辑)
-    // 320*240 = 75KB * 2 = 150KB
-    for (int i = 0; i < 2; i++)
-    {
-        g_state_buf[i] = (uint8_t *)rt_malloc(TEX_WIDTH * TEX_HEIGHT);
-        if (!g_state_buf[i])
-        {
-            LOG_E("Night 18: State Buf Alloc Failed.");
-            if (i == 1)
-                rt_free(g_state_buf[0]);
-            mpp_phy_free(g_tex_phy_addr);
-            return -1;
-        }
-    }
 
-    // 3. 初始化随机状态 (播种)
-    for (int i = 0; i < TEX_WIDTH * TEX_HEIGHT; i++)
-    {
-        g_state_buf[0][i] = rand() % STATE_COUNT;
-        g_state_buf[1][i] = 0;
-    }
-
-    // 4. 初始化调色板 (Alien Biology Style)
+    // 2. 初始化调色板 (Alien Biology Style)
     // 深紫 -> 亮绿 -> 荧光粉
+    int node[STATE_COUNT][3];
     for (int i = 0; i < STATE_COUNT; i++)
     {
         float t = (float)i / (float)STATE_COUNT;
@@ -112,89 +97,73 @@ static int effect_init(struct demo_ctx *ctx)
             b = b * 4 / 5;
         }
 
-        g_palette[i] = RGB2RGB565(r, g, b);
+        node[i][0] = r;
+        node[i][1] = g;
+        node[i][2] = b;
     }
 
-    g_tick    = 0;
-    g_buf_idx = 0;
-    rt_kprintf("Night 18: Cellular automata evolution started.\n");
+    // 节点之间的索引不会出现 (palette_discrete)，仅使调色板保持分段平滑
+    for (int i = 0; i < PALETTE_SIZE; i++)
+    {
+        int k = MIN(i / PALETTE_STEP, STATE_COUNT - 2);
+        int f = i - k * PALETTE_STEP;
+        int c[3];
+
+        for (int ch = 0; ch < 3; ch++)
+            c[ch] = node[k][ch] + (node[k + 1][ch] - node[k][ch]) * f / PALETTE_STEP;
+        g_palette[i] = RGB2RGB565(c[0], c[1], c[2]);
+    }
     return 0;
 }
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    demo_ca_deinit(&g_ca);
+}
+
+static int effect_init(struct demo_ctx *ctx)
 {
-    if (!g_tex_vir_addr || !g_state_buf[0])
-        return;
+    // 初始化随机状态 (播种)
+    demo_rand_seed(&g_rng, 18);
+    demo_ca_clear(&g_ca);
+    demo_ca_randomize(&g_ca, &g_rng);
+
+    g_tick = 0;
+    rt_kprintf("Night 18: Cellular automata evolution started.\n");
+    return 0;
+}
 
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
+{
     /*
      * === PHASE 1: 细胞进化 (Evolution) ===
      * 规则：如果任何一个邻居的状态是 (我的状态 + 1) % Total，我就被其同化。
-     * 这模拟了循环捕食关系 (剪刀石头布的 N 维版)。
+     * 这模拟了循环捕食关系 (剪刀石头布的 N 维版)。网格上下左右环绕，没有死边。
      */
+    demo_ca_step(&g_ca);
 
-    int src_idx = g_buf_idx;
-    int dst_idx = 1 - g_buf_idx;
-
-    uint8_t  *src = g_state_buf[src_idx];
-    uint8_t  *dst = g_state_buf[dst_idx];
-    uint16_t *tex = g_tex_vir_addr;
+    // 随机突变 (Mutation)
+    // 极小概率随机改变状态，防止画面陷入死循环或纯色
+    // 这能让系统一直保持活力
+    demo_ca_mutate(&g_ca, &g_rng, MUTATION_P16);
 
-    // 优化：跳过边缘 1 像素，避免复杂的边界检查 (Wrap-around 代价较大且视觉收益低)
-    for (int y = 1; y < TEX_HEIGHT - 1; y++)
-    {
-        // 预计算行指针
-        uint8_t *p_row    = src + y * TEX_WIDTH;
-        uint8_t *p_row_up = src + (y - 1) * TEX_WIDTH;
-        uint8_t *p_row_dn = src + (y + 1) * TEX_WIDTH;
+    /* === PHASE 2: 状态 -> 调色板索引 === */
+    demo_ca_render(&g_ca, (uint8_t *)tex->vir, tex->stride, PALETTE_STEP);
 
-        uint8_t  *p_dst = dst + y * TEX_WIDTH;
-        uint16_t *p_tex = tex + y * TEX_WIDTH;
-
-        for (int x = 1; x < TEX_WIDTH - 1; x++)
-        {
-            uint8_t current    = p_row[x];
-            uint8_t next_state = (current + 1);
-            if (next_state >= STATE_COUNT)
-                next_state = 0;
-
-            // 检查 4 邻域 (Von Neumann neighborhood)
-            // 只要有一个邻居是 next_state (天敌)，当前像素就进化
-            if (p_row[x - 1] == next_state || p_row[x + 1] == next_state || p_row_up[x] == next_state ||
-                p_row_dn[x] == next_state)
-            {
-                // 进化！
-                p_dst[x] = next_state;
-                p_tex[x] = g_palette[next_state];
-            }
-            else
-            {
-                // 保持原样
-                p_dst[x] = current;
-                p_tex[x] = g_palette[current];
-            }
-
-            // 随机突变 (Mutation)
-            // 极小概率随机改变状态，防止画面陷入死循环或纯色
-            // 这能让系统一直保持活力
-            if ((rand() & 0xFFFF) > MUTATION_THRESHOLD)
-            {
-                p_dst[x] = rand() % STATE_COUNT;
-            }
-        }
-    }
-
-    /* === CRITICAL: Cache Flush === */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    g_tick++;
+}
 
-    /* === PHASE 2: GE Scaling === */
+/* === PHASE 3: GE Scaling (只 emit，由引擎负责 sync) === */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     blt.dst_buf.buf_type    = MPP_PHY_ADDR;
@@ -214,43 +183,21 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     blt.ctrl.flags    = 0;
     blt.ctrl.alpha_en = 1; // Disable Blending
 
-    int ret = mpp_ge_bitblt(ctx->ge, &blt);
-    if (ret < 0)
-    {
-        LOG_E("GE Error: %d", ret);
-    }
-
+    mpp_ge_bitblt(ctx->ge, &blt);
     mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
-
-    // 交换 Ping-Pong
-    g_buf_idx = dst_idx;
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
-    for (int i = 0; i < 2; i++)
-    {
-        if (g_state_buf[i])
-        {
-            rt_free(g_state_buf[i]);
-            g_state_buf[i] = NULL;
-        }
-    }
 }
 
 struct effect_ops effect_0018 = {
-    .name   = "NO.18 THE BIOLOGICAL CLOCK",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name             = "NO.18 THE BIOLOGICAL CLOCK",
+    .init             = effect_init,
+    .compute          = effect_compute,
+    .submit           = effect_submit,
+    .tex_w            = TEX_WIDTH,
+    .tex_h            = TEX_HEIGHT,
+    .palette          = g_palette,
+    .palette_discrete = true,
+    .prepare          = effect_prepare,
+    .unprepare        = effect_unprepare,
 };
 
 REGISTER_EFFECT(effect_0018);
@@ -30,6 +30,9 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_swar.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -75,14 +78,13 @@ static int          g_tick         = 0;
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* 正弦表 (Q12) */
-static int sin_lut[LUT_SIZE];
 
 /* --- Implementation --- */
 
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (g_tex_phy_addr == 0)
     {
         LOG_E("Night 19: CMA Alloc Failed.");
@@ -113,19 +115,13 @@ static int effect_init(struct demo_ctx *ctx)
         g_palette[i] = RGB2RGB565(r, g, b);
     }
 
-    // 3. 正弦表
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
     g_tick = 0;
     rt_kprintf("Night 19: Mode 7 (Procedural) initialized.\n");
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 /*
  * 实时过程化地图生成 (Inline for speed)
@@ -223,7 +219,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
                 if (p < FOG_BLACK)
                     color = 0; // 极远处理全黑
                 else
-                    color = (color >> 1) & 0x7BEF; // 半黑 (RGB565 shift)
+                    color = (uint16_t)demo_px_shr(color, 1); // 半黑 (RGB565 shift)
             }
 
             *p_pixel++ = color;
@@ -274,7 +270,7 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
     {
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
         g_tex_phy_addr = 0;
         g_tex_vir_addr = NULL;
     }
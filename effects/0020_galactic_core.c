@@ -25,15 +25,16 @@
  * 我们皆是星尘，困于硅基的梦中。
  *
  * Hardware Feature:
- * 1. High-Density 3D Math (高密度3D运算) - 4096 粒子实时 3D 旋转投影
+ * 1. High-Density 3D Math (高密度3D运算) - 32768 粒子 SoA 批量变换：同速星体共用一个合成矩阵，查表透视投影
  * 2. GE Scaler (硬件缩放) - 将粒子点阵平滑放大，模拟望远镜视角
+ * 3. GE Fill (硬件清屏) - 缩放之后由 GE 清空纹理，与 CPU 变换下一帧并行
  */
 
 #include "demo_engine.h"
-#include "mpp_mem.h"
+#include "demo_math.h"
+#include "demo_rand.h"
 #include "aic_hal_ge.h"
 #include <math.h>
-#include <stdlib.h>
 #include <string.h>
 
 /* --- Configuration Parameters --- */
@@ -41,79 +42,90 @@
 /* 纹理规格 */
 #define TEX_WIDTH  DEMO_QVGA_W
 #define TEX_HEIGHT DEMO_QVGA_H
-#define TEX_FMT    MPP_FMT_RGB_565
-#define TEX_BPP    2
-#define TEX_SIZE   (TEX_WIDTH * TEX_HEIGHT * TEX_BPP)
 
 /* 星系参数 */
-#define STAR_COUNT     4096   // 粒子数量极限
-#define GALAXY_RADIUS  200.0f // 星系半径
-#define GALAXY_ARMS    2      // 旋臂数量
-#define ARM_TWIST      6.0f   // 旋臂缠绕圈数
-#define CORE_THICKNESS 30.0f  // 盘面厚度
+#define STAR_BLOCK     4096                       // 每批生成的星体数 (负载档位的粒度)
+#define STAR_BLOCKS    8                          // 批数上限
+#define STAR_MAX       (STAR_BLOCK * STAR_BLOCKS) // 粒子数量极限
+#define STAR_DEFAULT   STAR_MAX                   // 默认粒子数量
+#define GALAXY_RADIUS  200.0f                     // 星系半径
+#define GALAXY_ARMS    2                          // 旋臂数量
+#define ARM_TWIST      6.0f                       // 旋臂缠绕圈数
+#define CORE_THICKNESS 30.0f                      // 盘面厚度
 
 /* 颜色阈值 (0.0 ~ 1.0) */
 #define THRESH_CORE 0.15f
 #define THRESH_MID  0.5f
 
+/* 自转速度 (开普勒模拟，内快外慢)：取值 SPEED_MIN ~ SPEED_MIN + SPEED_CLASSES - 1 */
+#define SPEED_MIN     16
+#define SPEED_CLASSES 65
+
 /* 摄像机参数 */
 #define CAM_DIST_BASE 300 // 基础距离
 #define PROJ_SCALE    256 // 透视缩放系数
 
-/* 查找表 */
-#define LUT_SIZE 512
-#define LUT_MASK 511
+/*
+ * 透视投影表：proj[z >> PROJ_SHIFT] = PROJ_SCALE / z (Q16，按区间中点取值)，代替逐星两次除法。
+ * 模型坐标模长不超过约 3300，摄像机距离不超过 428 * 16，视空间深度总在表的覆盖范围内。
+ */
+#define PROJ_SHIFT 2
+#define PROJ_SIZE  4096
+#define PROJ_FRAC  16
+#define Z_NEAR     65 // 深度不足此值的星体被裁剪
+#define Z_SPAN     ((PROJ_SIZE << PROJ_SHIFT) - Z_NEAR)
+
+/* 近处星体加绘光晕 (Bloom Hack)：越近的点绘制越大 */
+#define BLOOM_Z     800 // 十字 (右、下各加一点)
+#define BLOOM_DIAG  400 // 再加右下角，成 2x2
+#define NEAR_MAX    4096
+#define NEAR_DIAG   0x80000000u
+#define NEAR_OFFSET 0x7FFFFFFFu
 
 /* --- Global State --- */
 
-static unsigned int g_tex_phy_addr = 0;
-static uint16_t    *g_tex_vir_addr = NULL;
-static int          g_tick         = 0;
+static int g_tick = 0;
 
-typedef struct
-{
-    int      x, y, z;      // 3D 坐标 (Q12)
-    uint16_t color;        // 颜色
-    int      speed_offset; // 速度差异
-} Star;
+/*
+ * 星体以 SoA 存放 (模型坐标 *16)，各批内按速度稳定排序：
+ * 同一速度的星体自转角相同，与摄像机旋转合成为一个矩阵，逐星只剩一次 3x3 乘法。
+ * 批 b 中速度类 c 的星体位于 [g_class_end[b][c - 1], g_class_end[b][c])。
+ */
+static int16_t  *g_star_x   = NULL;
+static int16_t  *g_star_y   = NULL;
+static int16_t  *g_star_z   = NULL;
+static uint16_t *g_star_col = NULL;
+static uint16_t  g_class_end[STAR_BLOCKS][SPEED_CLASSES];
+static int       g_star_blocks = STAR_DEFAULT / STAR_BLOCK;
 
-/* 星体数据放入普通 RAM (rt_malloc) */
-static Star *g_stars = NULL;
-static int   sin_lut[LUT_SIZE]; // Q12
+static uint32_t *g_proj = NULL;
 
-/* --- Implementation --- */
+/* 每帧各速度类的合成矩阵 (Q12，行优先) */
+static int g_class_m[SPEED_CLASSES][9];
 
-static int effect_init(struct demo_ctx *ctx)
-{
-    // 1. CMA 显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    if (g_tex_phy_addr == 0)
-    {
-        LOG_E("Night 20: CMA Alloc Failed.");
-        return -1;
-    }
-    g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
+/* 近处星体 (深度箱)：远处星体在变换中直接写点，近处的暂存，全部写完后再绘光晕，使近星总盖住远星 */
+static uint32_t *g_near_off = NULL; /* 像素偏移 (按纹理行距) | NEAR_DIAG */
+static uint16_t *g_near_col = NULL;
+static int       g_near_count;
 
-    // 2. 分配星星数组 (RAM)
-    g_stars = (Star *)rt_malloc(STAR_COUNT * sizeof(Star));
-    if (!g_stars)
-    {
-        LOG_E("Night 20: Star Alloc Failed.");
-        mpp_phy_free(g_tex_phy_addr);
-        return -1;
-    }
+/* 已在 submit 中排入 GE 清屏的纹理：compute 取回后无需再清，首次使用的纹理由 CPU 清空 */
+static unsigned long g_tex_cleared[2];
 
-    // 3. 初始化正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
+/* 基准测试的负载档位 (星体数，须为 STAR_BLOCK 的倍数) */
+static const int g_bench_loads[] = {4096, 8192, 16384, 32768, 0};
+
+/* --- Implementation --- */
+
+/* 生成一批星体 (高密度双旋臂)，按速度稳定排序后写入 SoA；首批与原先 4096 颗的星系一致 */
+static void galaxy_generate_block(struct demo_rand *rng, int block, int16_t (*tmp)[4], uint16_t *tmp_col)
+{
+    int base                 = block * STAR_BLOCK;
+    int count[SPEED_CLASSES] = {0};
 
-    // 4. 初始化星系 (高密度双旋臂)
-    for (int i = 0; i < STAR_COUNT; i++)
+    for (int i = 0; i < STAR_BLOCK; i++)
     {
         // 半径分布：使用 1.5 次方分布，让核心密集
-        float r_norm = (float)(rand() % 1000) / 1000.0f;
+        float r_norm = (float)demo_rand_range(rng, 1000) / 1000.0f;
         r_norm       = powf(r_norm, 1.5f);
 
         int radius = (int)(r_norm * GALAXY_RADIUS * 16.0f); // *16 for extra precision scale
@@ -121,10 +133,10 @@ static int effect_init(struct demo_ctx *ctx)
         // 角度：双旋臂 + 随机弥散
         float base_angle = r_norm * PI * ARM_TWIST + (i % GALAXY_ARMS) * PI;
         // 增加随机散射 (Scatter)，模拟星系厚度
-        base_angle += ((rand() % 100) / 100.0f) * 1.0f;
+        base_angle += (demo_rand_range(rng, 100) / 100.0f) * 1.0f;
 
-        g_stars[i].x = (int)(cosf(base_angle) * radius);
-        g_stars[i].z = (int)(sinf(base_angle) * radius);
+        tmp[i][0] = (int16_t)(cosf(base_angle) * radius);
+        tmp[i][2] = (int16_t)(sinf(base_angle) * radius);
 
         // Y 轴 (厚度)：核心球状，旋臂盘状
         int thickness = (int)((1.0f - r_norm * 0.8f) * CORE_THICKNESS * 16.0f);
@@ -132,7 +144,7 @@ static int effect_init(struct demo_ctx *ctx)
         if (r_norm < 0.1f)
             thickness *= 3;
 
-        g_stars[i].y = (rand() % (thickness * 2 + 1)) - thickness;
+        tmp[i][1] = (int16_t)demo_rand_between(rng, -thickness, thickness);
 
         // 颜色生成：基于温度 (半径)
         int r, g, b;
@@ -140,7 +152,7 @@ static int effect_init(struct demo_ctx *ctx)
         { // Core: 炽热白/黄
             r = 255;
             g = 255;
-            b = 220 + (rand() % 35);
+            b = 220 + (int)demo_rand_range(rng, 35);
         }
         else if (r_norm < THRESH_MID)
         { // Mid: 能量红
@@ -155,134 +167,245 @@ static int effect_init(struct demo_ctx *ctx)
             g = 150;
             b = 255;
         }
-        g_stars[i].color = RGB2RGB565(r, g, b);
+        tmp_col[i] = RGB2RGB565(r, g, b);
 
         // 速度差异：开普勒模拟，内快外慢
-        g_stars[i].speed_offset = (int)((1.0f - r_norm) * 64.0f) + 16;
+        tmp[i][3] = (int16_t)((int)((1.0f - r_norm) * 64.0f) + 16 - SPEED_MIN);
+        count[tmp[i][3]]++;
     }
 
+    // 按速度类计数排序 (保持生成顺序)
+    int pos[SPEED_CLASSES];
+    int end = base;
+    for (int c = 0; c < SPEED_CLASSES; c++)
+    {
+        pos[c] = end;
+        end += count[c];
+        g_class_end[block][c] = (uint16_t)end;
+    }
+    for (int i = 0; i < STAR_BLOCK; i++)
+    {
+        int k         = pos[tmp[i][3]]++;
+        g_star_x[k]   = tmp[i][0];
+        g_star_y[k]   = tmp[i][1];
+        g_star_z[k]   = tmp[i][2];
+        g_star_col[k] = tmp_col[i];
+    }
+}
+
+#define GALAXY_FREE(p)                                                                                                 \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (p)                                                                                                         \
+            rt_free(p);                                                                                                \
+        (p) = NULL;                                                                                                    \
+    } while (0)
+
+static void effect_unprepare(struct demo_ctx *ctx)
+{
+    GALAXY_FREE(g_star_x);
+    GALAXY_FREE(g_star_y);
+    GALAXY_FREE(g_star_z);
+    GALAXY_FREE(g_star_col);
+    GALAXY_FREE(g_proj);
+    GALAXY_FREE(g_near_off);
+    GALAXY_FREE(g_near_col);
+}
+
+static int effect_prepare(struct demo_ctx *ctx)
+{
+    // 1. 分配星体数组 (RAM，约 256KB) 与投影表、近处星体缓冲
+    g_star_x   = (int16_t *)rt_malloc(STAR_MAX * sizeof(int16_t));
+    g_star_y   = (int16_t *)rt_malloc(STAR_MAX * sizeof(int16_t));
+    g_star_z   = (int16_t *)rt_malloc(STAR_MAX * sizeof(int16_t));
+    g_star_col = (uint16_t *)rt_malloc(STAR_MAX * sizeof(uint16_t));
+    g_proj     = (uint32_t *)rt_malloc(PROJ_SIZE * sizeof(uint32_t));
+    g_near_off = (uint32_t *)rt_malloc(NEAR_MAX * sizeof(uint32_t));
+    g_near_col = (uint16_t *)rt_malloc(NEAR_MAX * sizeof(uint16_t));
+
+    int16_t(*tmp)[4]  = (int16_t(*)[4])rt_malloc(STAR_BLOCK * sizeof(*tmp));
+    uint16_t *tmp_col = (uint16_t *)rt_malloc(STAR_BLOCK * sizeof(uint16_t));
+
+    if (!g_star_x || !g_star_y || !g_star_z || !g_star_col || !g_proj || !g_near_off || !g_near_col || !tmp ||
+        !tmp_col)
+    {
+        LOG_E("Night 20: Star Alloc Failed.");
+        if (tmp)
+            rt_free(tmp);
+        if (tmp_col)
+            rt_free(tmp_col);
+        effect_unprepare(ctx);
+        return -1;
+    }
+
+    // 2. 初始化星系：逐批生成，前 n 批即 n * STAR_BLOCK 颗星的星系
+    struct demo_rand rng;
+    demo_rand_seed(&rng, 20);
+    for (int b = 0; b < STAR_BLOCKS; b++)
+        galaxy_generate_block(&rng, b, tmp, tmp_col);
+    rt_free(tmp);
+    rt_free(tmp_col);
+
+    // 3. 透视投影表
+    for (int i = 0; i < PROJ_SIZE; i++)
+    {
+        uint32_t z = ((uint32_t)i << PROJ_SHIFT) + (1 << (PROJ_SHIFT - 1));
+        g_proj[i]  = (((uint32_t)PROJ_SCALE << PROJ_FRAC) + z / 2) / z;
+    }
+    return 0;
+}
+
+static int effect_init(struct demo_ctx *ctx)
+{
+    g_star_blocks = STAR_DEFAULT / STAR_BLOCK;
+    memset(g_tex_cleared, 0, sizeof(g_tex_cleared));
+
     g_tick = 0;
-    rt_kprintf("Night 20: 4096 Stars Simulation.\n");
+    rt_kprintf("Night 20: %d Stars Simulation.\n", g_star_blocks * STAR_BLOCK);
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+/* 基准测试切换负载 (两帧之间由渲染线程调用) */
+static void effect_set_load(struct demo_ctx *ctx, int load)
+{
+    g_star_blocks = CLAMP(load / STAR_BLOCK, 1, STAR_BLOCKS);
+}
+
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 /*
- * 3D 旋转内联函数 (性能关键路径)
+ * 合成每个速度类的矩阵 M = Yaw * Pitch * Self (Q12)：
+ * 摄像机部分 C = Yaw * Pitch 每帧一次，再右乘各类绕 Y 轴的自转，sin/cos 由同类星体共用。
  */
-static inline void rotate_point_inline(int *x, int *y, int *z, int angle_x, int angle_y)
+static void galaxy_build_matrices(void)
 {
-    // X-Axis Rotation (Pitch)
-    if (angle_x)
-    {
-        int s  = GET_SIN(angle_x);
-        int c  = GET_COS(angle_x);
-        int ny = (*y * c - *z * s) >> Q12_SHIFT;
-        int nz = (*y * s + *z * c) >> Q12_SHIFT;
-        *y     = ny;
-        *z     = nz;
-    }
-    // Y-Axis Rotation (Yaw)
-    if (angle_y)
+    int pitch = GET_SIN(g_tick) >> 6; // 缓慢俯仰
+    int yaw   = g_tick;               // 持续自旋
+    int sp    = GET_SIN(pitch);
+    int cp    = GET_COS(pitch);
+    int sw    = GET_SIN(yaw);
+    int cw    = GET_COS(yaw);
+
+    int c[9] = {
+        cw, -(sw * sp) >> Q12_SHIFT, -(sw * cp) >> Q12_SHIFT,
+        0,  cp,                      -sp,
+        sw, (cw * sp) >> Q12_SHIFT,  (cw * cp) >> Q12_SHIFT,
+    };
+
+    for (int k = 0; k < SPEED_CLASSES; k++)
     {
-        int s  = GET_SIN(angle_y);
-        int c  = GET_COS(angle_y);
-        int nx = (*x * c - *z * s) >> Q12_SHIFT;
-        int nz = (*x * s + *z * c) >> Q12_SHIFT;
-        *x     = nx;
-        *z     = nz;
+        int  self = (g_tick * (SPEED_MIN + k)) >> 6;
+        int  ss   = GET_SIN(self);
+        int  sc   = GET_COS(self);
+        int *m    = g_class_m[k];
+
+        for (int r = 0; r < 3; r++)
+        {
+            m[r * 3 + 0] = (c[r * 3 + 0] * sc + c[r * 3 + 2] * ss) >> Q12_SHIFT;
+            m[r * 3 + 1] = c[r * 3 + 1];
+            m[r * 3 + 2] = (c[r * 3 + 2] * sc - c[r * 3 + 0] * ss) >> Q12_SHIFT;
+        }
     }
 }
 
-static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
+/* 变换并投影 [i, end) 中的星体：远处的直接写点，近处的登记到近处星体箱 (pitch 为纹理行距，单位像素) */
+static void galaxy_project(uint16_t *dst, int pitch, const int *mat, int zoff, int i, int end)
 {
-    if (!g_tex_vir_addr || !g_stars)
-        return;
+    const int m0 = mat[0], m1 = mat[1], m2 = mat[2];
+    const int m3 = mat[3], m4 = mat[4], m5 = mat[5];
+    const int m6 = mat[6], m7 = mat[7], m8 = mat[8];
 
-    /* === PHASE 1: 清屏 === */
-    // 使用 32位 写入清屏
-    memset(g_tex_vir_addr, 0, TEX_SIZE);
+    for (; i < end; i++)
+    {
+        int x = g_star_x[i];
+        int y = g_star_y[i];
+        int z = g_star_z[i];
 
-    /* === PHASE 2: 粒子群变换 === */
+        // 先算深度，裁剪掉身后与过近的点
+        int vz = (m6 * x + m7 * y + m8 * z + zoff) >> Q12_SHIFT;
+        if ((unsigned)(vz - Z_NEAR) >= Z_SPAN)
+            continue;
 
-    // 摄像机参数
-    int cam_pitch = (GET_SIN(g_tick) >> 6);                     // 缓慢俯仰
-    int cam_yaw   = g_tick;                                     // 持续自旋
-    int cam_dist  = CAM_DIST_BASE + (GET_SIN(g_tick / 2) >> 5); // 呼吸式推拉
+        // 透视投影: screen_x = x * PROJ_SCALE / z (查表)
+        int p  = (int)g_proj[vz >> PROJ_SHIFT];
+        int vx = (m0 * x + m1 * y + m2 * z) >> Q12_SHIFT;
+        int vy = (m3 * x + m4 * y + m5 * z) >> Q12_SHIFT;
+        int sx = TEX_WIDTH / 2 + ((vx * p) >> PROJ_FRAC);
+        int sy = TEX_HEIGHT / 2 + ((vy * p) >> PROJ_FRAC);
 
-    int cx = TEX_WIDTH / 2;
-    int cy = TEX_HEIGHT / 2;
+        if ((unsigned)sx >= TEX_WIDTH || (unsigned)sy >= TEX_HEIGHT)
+            continue;
 
-    for (int i = 0; i < STAR_COUNT; i++)
-    {
-        Star *s = &g_stars[i];
-
-        // 1. Model Space
-        int x = s->x;
-        int y = s->y;
-        int z = s->z;
-
-        // 2. 自转 (围绕星系中心)
-        int self_rot = (g_tick * s->speed_offset) >> 6;
-        int ss       = GET_SIN(self_rot);
-        int sc       = GET_COS(self_rot);
-        int nx       = (x * sc - z * ss) >> Q12_SHIFT;
-        int nz       = (x * ss + z * sc) >> Q12_SHIFT;
-        x            = nx;
-        z            = nz;
-
-        // 3. View Space (摄像机旋转)
-        rotate_point_inline(&x, &y, &z, cam_pitch, cam_yaw);
-
-        // 4. Projection
-        // 增加摄像机距离
-        z += (cam_dist << 4);
-
-        // 裁剪掉身后的点
-        if (z <= 64)
+        int off = sy * pitch + sx;
+
+        // 光晕需要右、下两侧的像素：贴边或箱已满时只写一点
+        if (vz >= BLOOM_Z || sx == TEX_WIDTH - 1 || sy == TEX_HEIGHT - 1 || g_near_count == NEAR_MAX)
+        {
+            dst[off] = g_star_col[i];
             continue;
+        }
+        g_near_off[g_near_count] = (uint32_t)off | (vz < BLOOM_DIAG ? NEAR_DIAG : 0);
+        g_near_col[g_near_count] = g_star_col[i];
+        g_near_count++;
+    }
+}
 
-        // 透视投影: screen_x = x / z * scale
-        int sx = cx + (x * PROJ_SCALE / z);
-        int sy = cy + (y * PROJ_SCALE / z);
+static void effect_compute(struct demo_ctx *ctx, struct demo_tex *tex)
+{
+    uint16_t *dst   = (uint16_t *)tex->vir;
+    int       pitch = tex->stride / 2;
+
+    /* === PHASE 1: 清屏 (已由 GE 在上次合成后完成；首次使用的纹理由 CPU 清空) === */
+    if (tex->phy != g_tex_cleared[0] && tex->phy != g_tex_cleared[1])
+        memset(dst, 0, tex->stride * tex->height);
+
+    /* === PHASE 2: 按速度类合成矩阵 === */
+    galaxy_build_matrices();
 
-        // 5. Rasterization
-        if (sx >= 0 && sx < TEX_WIDTH && sy >= 0 && sy < TEX_HEIGHT)
+    int cam_dist = CAM_DIST_BASE + (GET_SIN(g_tick / 2) >> 5); // 呼吸式推拉
+    int zoff     = cam_dist << (4 + Q12_SHIFT);
+
+    /* === PHASE 3: 粒子群变换 (SoA 顺序扫描，同类共用矩阵) === */
+    g_near_count = 0;
+    for (int b = 0; b < g_star_blocks; b++)
+    {
+        int start = b * STAR_BLOCK;
+        for (int k = 0; k < SPEED_CLASSES; k++)
         {
-            uint16_t *pixel = g_tex_vir_addr + sy * TEX_WIDTH + sx;
-            *pixel          = s->color;
-
-            // 距离发光 (Bloom Hack) - 模拟近大远小
-            // 越近的点 (z越小) 绘制越大
-            if (z < 800)
-            {
-                if (sx + 1 < TEX_WIDTH)
-                    *(pixel + 1) = s->color;
-
-                if (sy + 1 < TEX_HEIGHT)
-                    *(pixel + TEX_WIDTH) = s->color;
-
-                // 增加一点柔化
-                if (z < 400 && sx + 1 < TEX_WIDTH && sy + 1 < TEX_HEIGHT)
-                    *(pixel + TEX_WIDTH + 1) = s->color;
-            }
+            int end = g_class_end[b][k];
+            galaxy_project(dst, pitch, g_class_m[k], zoff, start, end);
+            start = end;
         }
     }
 
-    /* === CRITICAL: Cache Flush === */
-    aicos_dcache_clean_range((void *)g_tex_vir_addr, TEX_SIZE);
+    /* === PHASE 4: 近处星体最后绘制 (十字 / 2x2 光晕)，盖住远处的点 === */
+    for (int i = 0; i < g_near_count; i++)
+    {
+        uint16_t *pixel = dst + (g_near_off[i] & NEAR_OFFSET);
+        uint16_t  color = g_near_col[i];
+
+        pixel[0]     = color;
+        pixel[1]     = color;
+        pixel[pitch] = color;
+        if (g_near_off[i] & NEAR_DIAG)
+            pixel[pitch + 1] = color;
+    }
 
-    /* === PHASE 3: GE Scaling === */
+    g_tick++;
+}
+
+/* === PHASE 5: GE 缩放上屏，随后 GE 清空纹理供下一轮 compute 使用 (只 emit，由引擎负责 sync) === */
+static void effect_submit(struct demo_ctx *ctx, struct demo_tex *tex, unsigned long phy_addr)
+{
     struct ge_bitblt blt = {0};
 
     blt.src_buf.buf_type    = MPP_PHY_ADDR;
-    blt.src_buf.phy_addr[0] = g_tex_phy_addr;
-    blt.src_buf.stride[0]   = TEX_WIDTH * TEX_BPP;
-    blt.src_buf.size.width  = TEX_WIDTH;
-    blt.src_buf.size.height = TEX_HEIGHT;
-    blt.src_buf.format      = TEX_FMT;
+    blt.src_buf.phy_addr[0] = tex->phy;
+    blt.src_buf.stride[0]   = tex->stride;
+    blt.src_buf.size.width  = tex->width;
+    blt.src_buf.size.height = tex->height;
+    blt.src_buf.format      = tex->format;
     blt.src_buf.crop_en     = 0;
 
     blt.dst_buf.buf_type    = MPP_PHY_ADDR;
@@ -308,32 +431,35 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         LOG_E("GE Error: %d", ret);
     }
 
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    // 同一命令队列中排在缩放之后，GE 读完纹理才会清空；CPU 此时正在变换另一张纹理
+    struct ge_fillrect fill  = {0};
+    fill.type                = GE_NO_GRADIENT;
+    fill.start_color         = 0xFF000000; // Black
+    fill.dst_buf.buf_type    = MPP_PHY_ADDR;
+    fill.dst_buf.phy_addr[0] = tex->phy;
+    fill.dst_buf.stride[0]   = tex->stride;
+    fill.dst_buf.size.width  = tex->width;
+    fill.dst_buf.size.height = tex->height;
+    fill.dst_buf.format      = tex->format;
+    if (mpp_ge_fillrect(ctx->ge, &fill) == 0 && tex->phy != g_tex_cleared[0] && tex->phy != g_tex_cleared[1])
+        g_tex_cleared[g_tex_cleared[0] != 0] = tex->phy;
 
-    g_tick++;
-}
-
-static void effect_deinit(struct demo_ctx *ctx)
-{
-    if (g_tex_phy_addr)
-    {
-        mpp_phy_free(g_tex_phy_addr);
-        g_tex_phy_addr = 0;
-        g_tex_vir_addr = NULL;
-    }
-    if (g_stars)
-    {
-        rt_free(g_stars);
-        g_stars = NULL;
-    }
+    mpp_ge_emit(ctx->ge);
 }
 
 struct effect_ops effect_0020 = {
-    .name   = "NO.20 THE GALACTIC CORE",
-    .init   = effect_init,
-    .draw   = effect_draw,
-    .deinit = effect_deinit,
+    .name         = "NO.20 THE GALACTIC CORE",
+    .init         = effect_init,
+    .compute      = effect_compute,
+    .submit       = effect_submit,
+    .tex_w        = TEX_WIDTH,
+    .tex_h        = TEX_HEIGHT,
+    .tex_fmt      = MPP_FMT_RGB_565,
+    .tex_ge_write = true,
+    .prepare      = effect_prepare,
+    .unprepare    = effect_unprepare,
+    .bench_loads  = g_bench_loads,
+    .set_load     = effect_set_load,
 };
 
 REGISTER_EFFECT(effect_0020);
@@ -29,6 +29,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -71,7 +73,6 @@ static uint16_t    *g_rot_vir_addr = NULL; // 虽由GE写，但也映射虚拟
 static int          g_tick         = 0;
 
 /* 查找表 */
-static int      sin_lut[LUT_SIZE]; // Q12
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -81,27 +82,21 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请两个连续物理显存缓冲区
     // g_tex: CPU 生成的源纹理
     // g_rot: GE 旋转后的中间纹理
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (g_tex_phy_addr == 0 || g_rot_phy_addr == 0)
     {
         LOG_E("Night 21: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
     g_rot_vir_addr = (uint16_t *)(unsigned long)g_rot_phy_addr; // Debug only
 
-    // 2. 初始化正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化高频对比调色板
+    // 2. 初始化高频对比调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(128 + 127 * sinf(i * 0.05f));
@@ -124,8 +119,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -266,9 +261,9 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0021 = {
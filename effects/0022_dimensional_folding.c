@@ -29,9 +29,13 @@
  * 2. GE_PD_ADD (Rule 11: 硬件加法混合) - 实现光能叠加效果
  * 3. GE Scaler (Hardware Over-Scaling) - 通过缩小源裁剪区实现放大，消除旋转黑边
  * 4. GE FillRect (Intermediate Cleaning) - 极其重要的步骤：每次旋转前清空中间缓冲区
+ * 5. GE Batch - 两层 "清理 -> 旋转 -> 缩放" 共 7 条指令一次提交，GE 按序执行，无需逐条同步
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_ge_batch.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -68,7 +72,6 @@ static uint16_t    *g_rot_vir_addr = NULL; // Debug only
 static int          g_tick         = 0;
 
 /* 查找表 */
-static int      sin_lut[LUT_SIZE]; // Q12
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -78,29 +81,23 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请多重物理缓冲区
     // g_tex: CPU 源纹理
     // g_rot: GE 旋转中间缓冲区
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (g_tex_phy_addr == 0 || g_rot_phy_addr == 0)
     {
         LOG_E("Night 22: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
     g_rot_vir_addr = (uint16_t *)(unsigned long)g_rot_phy_addr;
 
-    // 2. 初始化正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化低饱和度调色板 (为加法混合预留亮度累加空间)
+    // 2. 初始化低饱和度调色板 (为加法混合预留亮度累加空间)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(30 + 25 * sinf(i * 0.05f));
@@ -122,8 +119,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -140,9 +137,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     screen_fill.dst_buf.size.width  = ctx->info.width;
     screen_fill.dst_buf.size.height = ctx->info.height;
     screen_fill.dst_buf.format      = ctx->info.format;
-    mpp_ge_fillrect(ctx->ge, &screen_fill);
+    ge_batch_fillrect(ctx->ge, &screen_fill);
+    ge_batch_emit(ctx->ge); // 清屏与下方的 CPU 纹理计算并行
 
     /* --- STEP 2: CPU 纹理计算 --- */
+    ge_batch_cpu_access(ctx->ge, g_tex_vir_addr, TEX_SIZE);
     uint16_t *p  = g_tex_vir_addr;
     int       t  = g_tick;
     int       cx = TEX_WIDTH / 2;
@@ -176,9 +175,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         rot_fill.dst_buf.size.width  = TEX_WIDTH;
         rot_fill.dst_buf.size.height = TEX_HEIGHT;
         rot_fill.dst_buf.format      = TEX_FMT;
-        mpp_ge_fillrect(ctx->ge, &rot_fill);
-        mpp_ge_emit(ctx->ge);
-        mpp_ge_sync(ctx->ge); // 必须确保中间层清理干净
+        ge_batch_fillrect(ctx->ge, &rot_fill); // GE 按序执行，旋转前必然已清理干净
 
         // B. 旋转逻辑
         struct ge_rotation rot  = {0};
@@ -208,9 +205,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         rot.dst_rot_center.y = cy;
         rot.ctrl.alpha_en    = 1; // 旋转过程禁用混合，仅搬运
 
-        mpp_ge_rotate(ctx->ge, &rot);
-        mpp_ge_emit(ctx->ge);
-        mpp_ge_sync(ctx->ge); // 等待旋转完成
+        ge_batch_rotate(ctx->ge, &rot);
 
         // C. 全屏呼吸缩放 (Over-Scaling 优化)
         struct ge_bitblt blt    = {0};
@@ -260,12 +255,9 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             blt.ctrl.src_global_alpha = BLEND_ALPHA;
         }
 
-        mpp_ge_bitblt(ctx->ge, &blt);
-
-        /* 遵循 SPEC.md：大面积绘图，画一层，同步一层 */
-        mpp_ge_emit(ctx->ge);
-        mpp_ge_sync(ctx->ge);
+        ge_batch_bitblt(ctx->ge, &blt);
     }
+    ge_batch_emit(ctx->ge);
 
     g_tick++;
 }
@@ -273,9 +265,9 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0022 = {
@@ -35,6 +35,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -70,7 +72,6 @@ static unsigned int g_rot_phy_addr = 0; // 旋转中间层
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -78,27 +79,21 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请多重物理连续显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 24: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化定点数查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化高频逻辑色块
+    // 2. 初始化高频逻辑色块
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // 位操作生成硬朗的科技色块
@@ -115,8 +110,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -239,7 +234,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[10] = 0x100 - abs(s); // BB
 
     // 通过 FB 接口将矩阵注入显示管线的末端
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -249,12 +244,12 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 强制复位色彩矩阵，防止光谱污染后续的梦境
     struct aicfb_ccm_config ccm_reset = {0};
     ccm_reset.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
+    demo_disp_set_ccm(&ccm_reset);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0024 = {
@@ -30,9 +30,13 @@
  * 1. GE Multi-Pass Mirroring (多路镜像合成) - 利用 Flip H/V 构建四象限对称
  * 2. GE Rot1 (双路异相旋转) - 同时维护顺时针与逆时针两个旋转场
  * 3. GE Scaler (非等比采样) - 利用源裁剪偏移制造“破碎感”
+ * 4. GE Batch - 旋转、清屏与四象限投射共 9 条指令一次提交
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_ge_batch.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -70,7 +74,6 @@ static unsigned int g_rot_phy_addr[2] = {0, 0}; // 两个不同旋转相位的
 static uint16_t    *g_tex_vir_addr    = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -78,31 +81,25 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请连续物理显存 (1个源 + 2个中间层)
-    g_tex_phy_addr    = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr[0] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr[1] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr    = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr[0] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr[1] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_tex_phy_addr || !g_rot_phy_addr[0] || !g_rot_phy_addr[1])
     {
         LOG_E("Night 25: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr[0])
-            mpp_phy_free(g_rot_phy_addr[0]);
+            demo_pool_free(g_rot_phy_addr[0]);
         if (g_rot_phy_addr[1])
-            mpp_phy_free(g_rot_phy_addr[1]);
+            demo_pool_free(g_rot_phy_addr[1]);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化极光调色板 (高频蓝绿调)
+    // 2. 初始化极光调色板 (高频蓝绿调)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(20 + 20 * sinf(i * 0.05f));
@@ -124,8 +121,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -135,6 +132,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     int t = g_tick;
 
     /* --- PHASE 1: CPU 纹理生成 --- */
+    ge_batch_cpu_access(ctx->ge, g_tex_vir_addr, TEX_SIZE);
     uint16_t *p  = g_tex_vir_addr;
     int       cx = TEX_WIDTH / 2;
     int       cy = TEX_HEIGHT / 2;
@@ -165,8 +163,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         clean_buf.dst_buf.size.width  = TEX_WIDTH;
         clean_buf.dst_buf.size.height = TEX_HEIGHT;
         clean_buf.dst_buf.format      = TEX_FMT;
-        mpp_ge_fillrect(ctx->ge, &clean_buf);
-        mpp_ge_emit(ctx->ge);
+        ge_batch_fillrect(ctx->ge, &clean_buf);
 
         // B. 执行旋转
         struct ge_rotation rot  = {0};
@@ -196,9 +193,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         rot.dst_rot_center.y = cy;
         rot.ctrl.alpha_en    = 1; // 禁用混合，全量搬运
 
-        mpp_ge_rotate(ctx->ge, &rot);
-        mpp_ge_emit(ctx->ge);
-        mpp_ge_sync(ctx->ge); // 确保每一路旋转都完整物理落地
+        ge_batch_rotate(ctx->ge, &rot); // GE 按序执行，投射前旋转必已落地
     }
 
     /* --- PHASE 3: 清理主画布 --- */
@@ -211,9 +206,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     screen_clean.dst_buf.size.width  = ctx->info.width;
     screen_clean.dst_buf.size.height = ctx->info.height;
     screen_clean.dst_buf.format      = ctx->info.format;
-    mpp_ge_fillrect(ctx->ge, &screen_clean);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_fillrect(ctx->ge, &screen_clean);
 
     /* --- PHASE 4: 四象限镜像投射 (The Shattered Mirror) --- */
     for (int i = 0; i < 4; i++)
@@ -256,12 +249,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
         blt.ctrl.alpha_en = 1; // 极性 1: 禁用混合，仅快速位块搬移与缩放
 
-        mpp_ge_bitblt(ctx->ge, &blt);
-        mpp_ge_emit(ctx->ge);
+        ge_batch_bitblt(ctx->ge, &blt);
     }
 
-    // 全屏象限绘制完毕后，同步一帧
-    mpp_ge_sync(ctx->ge);
+    // 全屏象限绘制完毕后一次提交，帧同步由引擎完成
+    ge_batch_emit(ctx->ge);
 
     g_tick++;
 }
@@ -269,11 +261,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr[0])
-        mpp_phy_free(g_rot_phy_addr[0]);
+        demo_pool_free(g_rot_phy_addr[0]);
     if (g_rot_phy_addr[1])
-        mpp_phy_free(g_rot_phy_addr[1]);
+        demo_pool_free(g_rot_phy_addr[1]);
 }
 
 struct effect_ops effect_0025 = {
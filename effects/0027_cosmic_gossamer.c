@@ -34,6 +34,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -68,7 +70,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -76,7 +77,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一纹理缓冲区
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 27: CMA Alloc Failed.");
@@ -85,13 +86,7 @@ static int effect_init(struct demo_ctx *ctx)
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“梦幻色彩”调色板
+    // 2. 初始化“梦幻色彩”调色板
     // 采用高饱和、高明度但极其平滑的渐变色 (粉紫-湖青-流金)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -114,7 +109,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -209,7 +204,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0027 = {
@@ -32,9 +32,13 @@
  * 2. GE Rot1 (任意角度硬件旋转) - 驱动干扰场的相位变化
  * 3. GE Scaler (硬件全屏拉伸) - 实现宏观的逻辑冲击
  * 4. GE FillRect (中间层清理与背景基色)
+ * 5. GE Batch - 五级流水一次提交，GE 按序执行，级间无需同步
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_ge_batch.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -75,7 +79,6 @@ static uint16_t    *g_base_vir_addr = NULL;
 static uint16_t    *g_mask_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -83,32 +86,26 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请多重连续物理显存
-    g_base_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_mask_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr  = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_base_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_mask_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr  = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_base_phy_addr || !g_mask_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 28: CMA Alloc Failed.");
         if (g_base_phy_addr)
-            mpp_phy_free(g_base_phy_addr);
+            demo_pool_free(g_base_phy_addr);
         if (g_mask_phy_addr)
-            mpp_phy_free(g_mask_phy_addr);
+            demo_pool_free(g_mask_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_base_vir_addr = (uint16_t *)(unsigned long)g_base_phy_addr;
     g_mask_vir_addr = (uint16_t *)(unsigned long)g_mask_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化赛博深空调色板 (高频蓝紫色调)
+    // 2. 初始化赛博深空调色板 (高频蓝紫色调)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(20 + 30 * sinf(i * 0.05f));
@@ -131,8 +128,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -142,6 +139,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     int t = g_tick;
 
     /* --- PHASE 1: CPU 纹理演算 (生成背景与掩模的逻辑基底) --- */
+    ge_batch_cpu_access(ctx->ge, g_base_vir_addr, TEX_SIZE);
+    ge_batch_cpu_access(ctx->ge, g_mask_vir_addr, TEX_SIZE);
     uint16_t *bp = g_base_vir_addr;
     uint16_t *mp = g_mask_vir_addr;
     int       cx = TEX_WIDTH / 2;
@@ -182,8 +181,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     f_screen.dst_buf.size.width  = ctx->info.width;
     f_screen.dst_buf.size.height = ctx->info.height;
     f_screen.dst_buf.format      = ctx->info.format;
-    mpp_ge_fillrect(ctx->ge, &f_screen);
-    mpp_ge_emit(ctx->ge);
+    ge_batch_fillrect(ctx->ge, &f_screen);
 
     // 2. 将背景层缩放上屏 (作为底层秩序)
     struct ge_bitblt b_base    = {0};
@@ -206,8 +204,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     b_base.dst_buf.crop.height = ctx->info.height;
 
     b_base.ctrl.alpha_en = 1; // 直接覆盖
-    mpp_ge_bitblt(ctx->ge, &b_base);
-    mpp_ge_emit(ctx->ge);
+    ge_batch_bitblt(ctx->ge, &b_base);
 
     // 3. 准备掩模旋转 (清理中间层 -> 旋转)
     struct ge_fillrect f_rot  = {0};
@@ -219,9 +216,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     f_rot.dst_buf.size.width  = TEX_WIDTH;
     f_rot.dst_buf.size.height = TEX_HEIGHT;
     f_rot.dst_buf.format      = TEX_FMT;
-    mpp_ge_fillrect(ctx->ge, &f_rot);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_fillrect(ctx->ge, &f_rot);
 
     struct ge_rotation rot  = {0};
     rot.src_buf.buf_type    = MPP_PHY_ADDR;
@@ -246,9 +241,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     rot.dst_rot_center.x = cx;
     rot.dst_rot_center.y = cy;
     rot.ctrl.alpha_en    = 1;
-    mpp_ge_rotate(ctx->ge, &rot);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_rotate(ctx->ge, &rot);
 
     // 4. 关键动作：执行全屏 XOR 混合 (掩模层 -> 屏幕)
     struct ge_bitblt b_xor    = {0};
@@ -281,9 +274,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     b_xor.ctrl.alpha_en    = 0;
     b_xor.ctrl.alpha_rules = GE_PD_XOR; // 使用 Rule 12
 
-    mpp_ge_bitblt(ctx->ge, &b_xor);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_bitblt(ctx->ge, &b_xor);
+    ge_batch_emit(ctx->ge);
 
     g_tick++;
 }
@@ -291,11 +283,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_base_phy_addr)
-        mpp_phy_free(g_base_phy_addr);
+        demo_pool_free(g_base_phy_addr);
     if (g_mask_phy_addr)
-        mpp_phy_free(g_mask_phy_addr);
+        demo_pool_free(g_mask_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0028 = {
@@ -34,6 +34,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -78,7 +80,6 @@ static uint16_t    *g_bg_vir_addr  = NULL;
 static uint16_t    *g_fg_vir_addr  = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t palette_bg[PALETTE_SIZE];
 static uint16_t palette_fg[PALETTE_SIZE];
 
@@ -87,32 +88,26 @@ static uint16_t palette_fg[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请三重物理显存，构建三级流水线
-    g_bg_phy_addr  = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_fg_phy_addr  = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_bg_phy_addr  = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_fg_phy_addr  = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_bg_phy_addr || !g_fg_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 29: CMA Alloc Failed.");
         if (g_bg_phy_addr)
-            mpp_phy_free(g_bg_phy_addr);
+            demo_pool_free(g_bg_phy_addr);
         if (g_fg_phy_addr)
-            mpp_phy_free(g_fg_phy_addr);
+            demo_pool_free(g_fg_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_bg_vir_addr = (uint16_t *)(unsigned long)g_bg_phy_addr;
     g_fg_vir_addr = (uint16_t *)(unsigned long)g_fg_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化色谱
+    // 2. 初始化色谱
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         // 背景：炽热的能量色（金黄到深红）
@@ -133,8 +128,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -302,11 +297,11 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_bg_phy_addr)
-        mpp_phy_free(g_bg_phy_addr);
+        demo_pool_free(g_bg_phy_addr);
     if (g_fg_phy_addr)
-        mpp_phy_free(g_fg_phy_addr);
+        demo_pool_free(g_fg_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0029 = {
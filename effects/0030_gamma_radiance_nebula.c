@@ -32,6 +32,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -63,7 +65,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -71,7 +72,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请连续物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 30: CMA Alloc Failed.");
@@ -79,13 +80,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化 2.12 定点数查找表
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化深空调色板 (利用高度渐变模拟气体感)
+    // 2. 初始化深空调色板 (利用高度渐变模拟气体感)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(80 + 80 * sinf(i * 0.02f));
@@ -100,7 +95,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -197,7 +192,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     }
 
     // 通过 IOCTL 将新的神经反射逻辑注入 DE
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_GAMMA_CONFIG, &gamma);
+    demo_disp_set_gamma(&gamma);
 
     g_tick++;
 }
@@ -207,10 +202,10 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 强制关闭 Gamma，恢复线性真实世界
     struct aicfb_gamma_config gamma_reset = {0};
     gamma_reset.enable                    = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_GAMMA_CONFIG, &gamma_reset);
+    demo_disp_set_gamma(&gamma_reset);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0030 = {
@@ -32,9 +32,13 @@
  * 2. GE Flip H/V (硬件镜像) - 构建四象限对称曼陀罗
  * 3. GE Rot1 (任意角度自旋)
  * 4. DE CCM (光谱纠缠矩阵) - 实时色彩空间旋转
+ * 5. GE Batch - 清理、旋转、四象限与上屏共 8 条指令一次提交
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_ge_batch.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -73,7 +77,6 @@ static unsigned int g_comp_phy_addr = 0; // 全屏合成层
 static uint16_t    *g_tex_vir_addr  = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -81,31 +84,25 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请多级物理显存
-    g_tex_phy_addr  = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr  = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_comp_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(COMP_SIZE));
+    g_tex_phy_addr  = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr  = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_comp_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(COMP_SIZE));
 
     if (!g_tex_phy_addr || !g_rot_phy_addr || !g_comp_phy_addr)
     {
         LOG_E("Night 31: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         if (g_comp_phy_addr)
-            mpp_phy_free(g_comp_phy_addr);
+            demo_pool_free(g_comp_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化高频干涉调色板
+    // 2. 初始化高频干涉调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r = (int)(100 + 80 * sinf(i * 0.05f));
@@ -126,8 +123,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -137,6 +134,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     int t = g_tick;
 
     /* --- PHASE 1: CPU 演算 (Texture Generation) --- */
+    ge_batch_cpu_access(ctx->ge, g_tex_vir_addr, TEX_SIZE);
     uint16_t *p  = g_tex_vir_addr;
     int       cx = TEX_WIDTH / 2;
     int       cy = TEX_HEIGHT / 2;
@@ -167,17 +165,14 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     f_clean.dst_buf.size.width  = TEX_WIDTH;
     f_clean.dst_buf.size.height = TEX_HEIGHT;
     f_clean.dst_buf.format      = TEX_FMT;
-    mpp_ge_fillrect(ctx->ge, &f_clean);
-    mpp_ge_emit(ctx->ge);
+    ge_batch_fillrect(ctx->ge, &f_clean);
 
     // 2. 清理全屏合成层 (彻底抹除镜像残影)
     f_clean.dst_buf.phy_addr[0] = g_comp_phy_addr;
     f_clean.dst_buf.stride[0]   = COMP_WIDTH * TEX_BPP;
     f_clean.dst_buf.size.width  = COMP_WIDTH;
     f_clean.dst_buf.size.height = COMP_HEIGHT;
-    mpp_ge_fillrect(ctx->ge, &f_clean);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge); // 确保清理完成
+    ge_batch_fillrect(ctx->ge, &f_clean);
 
     // 3. 执行旋转 (Src -> Rot)
     struct ge_rotation rot  = {0};
@@ -204,9 +199,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     rot.dst_rot_center.y = TEX_HEIGHT / 2;
     rot.ctrl.alpha_en    = 1;
 
-    mpp_ge_rotate(ctx->ge, &rot);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_rotate(ctx->ge, &rot);
 
     /* --- PHASE 3: 镜像流形合成 (Four Quadrants) --- */
     // 将旋转后的纹理以不同镜像方式投射到合成缓冲区的四个象限
@@ -250,11 +243,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             blt.ctrl.flags = 0;
 
         blt.ctrl.alpha_en = 1; // 覆盖
-        mpp_ge_bitblt(ctx->ge, &blt);
-        mpp_ge_emit(ctx->ge);
+        ge_batch_bitblt(ctx->ge, &blt);
     }
-    // 象限绘制完毕后，同步一帧
-    mpp_ge_sync(ctx->ge);
 
     /* --- PHASE 4: 最终上屏 --- */
     struct ge_bitblt final    = {0};
@@ -278,9 +268,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     final.dst_buf.crop.height = ctx->info.height;
 
     final.ctrl.alpha_en = 1;
-    mpp_ge_bitblt(ctx->ge, &final);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_bitblt(ctx->ge, &final);
+    ge_batch_emit(ctx->ge);
 
     /* --- PHASE 5: DE CCM 光谱旋转 --- */
     struct aicfb_ccm_config ccm = {0};
@@ -294,7 +283,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[6]  = s;
     ccm.ccm_table[10] = 0x100;
 
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -304,14 +293,14 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位 CCM
     struct aicfb_ccm_config r = {0};
     r.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r);
+    demo_disp_set_ccm(&r);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
     if (g_comp_phy_addr)
-        mpp_phy_free(g_comp_phy_addr);
+        demo_pool_free(g_comp_phy_addr);
 }
 
 struct effect_ops effect_0031 = {
@@ -32,6 +32,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -68,7 +70,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -76,7 +77,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一纹理缓冲区
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 32: CMA Alloc Failed.");
@@ -85,13 +86,7 @@ static int effect_init(struct demo_ctx *ctx)
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化高精度查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“深海神经”调色板
+    // 2. 初始化“深海神经”调色板
     // 采用极平滑的灰度渐变与微量的湖青色，消除视觉疲劳
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -114,7 +109,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -186,7 +181,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.bright     = 50 + (pulse >> 2);
     prop.saturation = 90; // 提升饱和度，消除灰暗
     prop.hue        = 50;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     // 2. CCM 调节：极慢的光谱偏移，模拟深海光影变幻
     struct aicfb_ccm_config ccm = {0};
@@ -196,7 +191,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[5]            = 0x100 - ABS(color_shift);
     ccm.ccm_table[6]            = color_shift;
     ccm.ccm_table[10]           = 0x100;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -205,13 +200,13 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 恢复标准显示参数
     struct aicfb_disp_prop prop_reset = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop_reset);
+    demo_disp_set_prop(&prop_reset);
     struct aicfb_ccm_config ccm_reset = {0};
     ccm_reset.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
+    demo_disp_set_ccm(&ccm_reset);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0032 = {
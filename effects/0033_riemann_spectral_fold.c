@@ -33,6 +33,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -71,7 +73,6 @@ static unsigned int g_rot_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE]; // 10-bit LUT
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -79,28 +80,22 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请多重物理连续显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_tex_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 33: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化 10-bit 精度正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“黎曼光谱”调色板
+    // 2. 初始化“黎曼光谱”调色板
     // 采用高动态范围的互补色映射 (蓝金-紫绿)
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -125,8 +120,8 @@ static int effect_init(struct demo_ctx *ctx)
 }
 
 // 快速 10-bit 查表
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -257,7 +252,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[10] = 0x100 - abs(s); // BB
     ccm.ccm_table[8]  = s;              // BR
 
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -267,12 +262,12 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 强制关闭色彩矩阵
     struct aicfb_ccm_config r = {0};
     r.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r);
+    demo_disp_set_ccm(&r);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0033 = {
@@ -35,6 +35,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -74,7 +76,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -82,7 +83,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一连续物理显存，确保存储访问的绝对稳定
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 34: CMA Alloc Failed.");
@@ -90,13 +91,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“赛博网格”调色板
+    // 2. 初始化“赛博网格”调色板
     // 采用高对比度的基色，为后续的 CCM 矩阵留出足够的色彩转换空间
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -121,7 +116,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -193,7 +188,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.saturation = SATURATION_BOOST;               // 保持高饱和
     prop.hue        = 50;
 
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     // 2. CCM 调节：全屏光谱实时扭曲
     struct aicfb_ccm_config ccm = {0};
@@ -208,7 +203,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[6]  = s;
     ccm.ccm_table[10] = 0x100;
 
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -217,14 +212,14 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 强制关闭显示引擎的后处理机能，恢复常态
     struct aicfb_disp_prop prop_reset = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop_reset);
+    demo_disp_set_prop(&prop_reset);
 
     struct aicfb_ccm_config ccm_reset = {0};
     ccm_reset.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
+    demo_disp_set_ccm(&ccm_reset);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0034 = {
@@ -34,6 +34,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -74,7 +76,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -82,7 +83,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一连续物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 35: CMA Alloc Failed.");
@@ -90,13 +91,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“光谱偏移”调色板
+    // 2. 初始化“光谱偏移”调色板
     // 采用互补色系（青蓝-流金），利用 CCM 矩阵或 Gamma 增强其金属质感
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -117,7 +112,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -216,7 +211,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         gamma.gamma_lut[1][i] = (unsigned int)(target * 0.9f);
         gamma.gamma_lut[2][i] = (unsigned int)MIN(target * 1.1f, 255);
     }
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_GAMMA_CONFIG, &gamma);
+    demo_disp_set_gamma(&gamma);
 
     g_tick++;
 }
@@ -226,10 +221,10 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 恢复 Gamma
     struct aicfb_gamma_config gr = {0};
     gr.enable                    = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_GAMMA_CONFIG, &gr);
+    demo_disp_set_gamma(&gr);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0035 = {
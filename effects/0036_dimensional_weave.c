@@ -34,6 +34,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -74,7 +76,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -82,7 +83,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请连续物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 36: CMA Alloc Failed.");
@@ -90,13 +91,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“维度织锦”调色板
+    // 2. 初始化“维度织锦”调色板
     // 采用冰冷的电光色系：青绿、钴蓝、极光紫
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -118,7 +113,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -232,7 +227,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.bright     = 50;
     prop.saturation = 85;
     prop.hue        = 50;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     g_tick++;
 }
@@ -241,10 +236,10 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 重置画质
     struct aicfb_disp_prop r = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &r);
+    demo_disp_set_prop(&r);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0036 = {
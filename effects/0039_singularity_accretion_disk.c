@@ -33,6 +33,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -65,7 +67,6 @@ static unsigned int g_rot_phy_addr = 0; // 旋转中间层
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -73,29 +74,22 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_tex_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 39: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化 10-bit 精度正弦表 (Q12)
-    // 512.0f 对应 PI (半周期)，所以 1024 对应 2PI
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-    }
-
-    // 3. 初始化“吸积能量”调色板
+    // 2. 初始化“吸积能量”调色板
     // 渐变：黑 -> 深紫 -> 亮青 -> 炽白
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -117,8 +111,8 @@ static int effect_init(struct demo_ctx *ctx)
 }
 
 // 快速 10-bit 查表
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + 256) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -141,7 +135,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             int dx = x - cx;
             // 核心逻辑：极坐标下的非线性扰动噪声
             // 模拟气体盘的密度分布
-            int dist = (int)sqrtf((float)(dx * dx + dy2));
+            int dist = demo_isqrt(dx * dx + dy2);
 
             if (dist < EVENT_HORIZON_RAD)
             {
@@ -151,12 +145,12 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             }
 
             // 产生流动的、螺旋状的能量感
-            // 512.0f / PI 约等于 162.97，用于将弧度映射到 0-1024 范围 (近似)
-            // 这里使用浮点 atan2 是瓶颈，但在 QVGA 下尚可接受
-            int angle_seed = (int)(atan2f((float)dy, (float)dx) * 163.0f);
+            // 角度取 1024 = 一周 (查表 atan2，取代逐像素的浮点 atan2f)
+            int angle_seed = demo_atan2(dy, dx);
 
             // 越靠近中心速度越快 (Keplerian rotation simulation)
-            int val = (angle_seed + (16384 / dist) + t * 4) & 0xFF;
+            // 16384 / dist，dist 位于视界之外，倒数表右移 2 位即为精确商
+            int val = (angle_seed + (demo_recip_q16(dist) >> 2) + t * 4) & 0xFF;
 
             // 引入随机的“星际尘埃”闪烁
             if (((x ^ y) + t) % 127 == 0)
@@ -270,7 +264,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.bright                  = 45;
     prop.saturation              = 80;
     prop.hue                     = 50;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     // 2. 光谱位移 (CCM)：红移与蓝移的动态平衡
     struct aicfb_ccm_config ccm = {0};
@@ -282,7 +276,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[10] = 0x100 - shift; // B减益 (蓝移)
     ccm.ccm_table[3]  = shift / 2;     // R Offset
 
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -292,15 +286,15 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位硬件状态
     struct aicfb_ccm_config r = {0};
     r.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r);
+    demo_disp_set_ccm(&r);
 
     struct aicfb_disp_prop p = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &p);
+    demo_disp_set_prop(&p);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0039 = {
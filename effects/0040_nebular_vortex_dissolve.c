@@ -36,6 +36,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -54,8 +56,7 @@
 /* 物理参数 */
 #define RADIAL_LIMIT    115 // 衰减半径 (超过此半径强制变黑)
 #define RADIAL_LIMIT_SQ (RADIAL_LIMIT * RADIAL_LIMIT)
-#define CORE_RADIUS     35     // 核心黑洞半径
-#define ANGLE_SCALE     163.0f // 512 / PI
+#define CORE_RADIUS     35  // 核心黑洞半径
 
 /* 动画参数 */
 #define NOISE_SPEED 5   // 纹理流速
@@ -76,7 +77,6 @@ static unsigned int g_rot_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -84,26 +84,22 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
-    g_rot_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_rot_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
 
     if (!g_tex_phy_addr || !g_rot_phy_addr)
     {
         LOG_E("Night 40: CMA Alloc Failed.");
         if (g_tex_phy_addr)
-            mpp_phy_free(g_tex_phy_addr);
+            demo_pool_free(g_tex_phy_addr);
         if (g_rot_phy_addr)
-            mpp_phy_free(g_rot_phy_addr);
+            demo_pool_free(g_rot_phy_addr);
         return -1;
     }
 
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-
-    // 3. 初始化“高能等离子”色盘
+    // 2. 初始化“高能等离子”色盘
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         float f = (float)i / 255.0f;
@@ -119,8 +115,8 @@ static int effect_init(struct demo_ctx *ctx)
 }
 
 // 快速 10-bit 查表
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + 256) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -151,7 +147,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
                 continue;
             }
 
-            int dist = (int)sqrtf((float)dist_sq);
+            int dist = demo_isqrt(dist_sq);
             if (dist < CORE_RADIUS)
             { // 视界核心：吞噬所有光线
                 *p++ = 0x0000;
@@ -159,9 +155,9 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             }
 
             // 模拟高密度的气态湍流纹理
-            // atan2f 是性能瓶颈，但在 QVGA 分辨率下尚可接受
-            int angle = (int)(atan2f((float)dy, (float)dx) * ANGLE_SCALE);
-            int val   = (angle + (4096 / dist) + t * NOISE_SPEED) & 0xFF;
+            // 角度与倒数均查表 (1024 = 一周)，逐像素不再有浮点超越函数
+            int angle = demo_atan2(dy, dx);
+            int val   = (angle + (demo_recip_q16(dist) >> 4) + t * NOISE_SPEED) & 0xFF;
 
             // 施加平滑边缘权重 (Soft Falloff)
             int weight     = (RADIAL_LIMIT - dist); // 0 ~ 80
@@ -282,7 +278,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.contrast                = 60 + (pulse >> 1); // 随能量脉动调整对比度
     prop.bright                  = 45;
     prop.saturation              = 80;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     // 光谱位移：红移与蓝移的动态平衡
     struct aicfb_ccm_config ccm = {0};
@@ -291,7 +287,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[0]            = 0x100 + shift;      // R增益
     ccm.ccm_table[5]            = 0x100;              // G
     ccm.ccm_table[10]           = 0x100 - shift;      // B减益
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -301,15 +297,15 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位硬件状态
     struct aicfb_ccm_config r = {0};
     r.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r);
+    demo_disp_set_ccm(&r);
 
     struct aicfb_disp_prop p = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &p);
+    demo_disp_set_prop(&p);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
     if (g_rot_phy_addr)
-        mpp_phy_free(g_rot_phy_addr);
+        demo_pool_free(g_rot_phy_addr);
 }
 
 struct effect_ops effect_0040 = {
@@ -33,6 +33,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -71,7 +73,6 @@ static uint16_t    *g_tex_vir[2] = {NULL, NULL};
 static int          g_buf_idx    = 0;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -81,25 +82,19 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理连续缓冲区，确立因果循环
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 41: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“恒星演化”调色板
+    // 2. 初始化“恒星演化”调色板
     // 采用从炽金到深虚空的非线性映射
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -123,8 +118,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS(idx) (sin_lut[((idx) + (LUT_SIZE / 4)) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+#define GET_COS(idx) demo_cos_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -249,7 +244,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[1]            = s;
     ccm.ccm_table[5]            = 0x100;
     ccm.ccm_table[10]           = 0x100;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     // 交换指针
     g_buf_idx = dst_idx;
@@ -261,12 +256,12 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位 CCM
     struct aicfb_ccm_config r = {0};
     r.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r);
+    demo_disp_set_ccm(&r);
 
     for (int i = 0; i < 2; i++)
     {
         if (g_tex_phy[i])
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
     }
 }
 
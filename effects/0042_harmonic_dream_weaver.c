@@ -31,6 +31,9 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_swar.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -67,7 +70,6 @@ static uint16_t    *g_tex_vir[2] = {NULL, NULL};
 static int          g_buf_idx    = 0;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* 谐波频率表 (质数以避免周期重合) */
@@ -80,25 +82,19 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理连续缓冲区，确立视觉记忆存储
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 42: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-    }
-
-    // 3. 初始化“极光荧光”调色板
+    // 2. 初始化“极光荧光”调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         float f = (float)i / 255.0f;
@@ -124,8 +120,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + 256) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -215,7 +211,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         // 十字光晕 (Bloom Cross)
         if (y > 0 && y < TEX_HEIGHT - 1 && x > 0 && x < TEX_WIDTH - 1)
         {
-            uint16_t dim_color = (color >> 1) & 0x7BEF; // 50% 亮度
+            uint16_t dim_color = (uint16_t)demo_px_shr(color, 1); // 50% 亮度
             dst_ptr[(y - 1) * TEX_WIDTH + x] |= dim_color;
             dst_ptr[(y + 1) * TEX_WIDTH + x] |= dim_color;
             dst_ptr[y * TEX_WIDTH + (x - 1)] |= dim_color;
@@ -257,9 +253,9 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy[0])
-        mpp_phy_free(g_tex_phy[0]);
+        demo_pool_free(g_tex_phy[0]);
     if (g_tex_phy[1])
-        mpp_phy_free(g_tex_phy[1]);
+        demo_pool_free(g_tex_phy[1]);
 }
 
 struct effect_ops effect_0042 = {
@@ -34,6 +34,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -70,14 +72,13 @@ static unsigned int g_yuv_phy_addr = 0;
 static uint8_t     *g_yuv_vir_addr = NULL;
 
 static int g_tick = 0;
-static int sin_lut[LUT_SIZE];
 
 /* --- Implementation --- */
 
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一连续物理显存 (YUV400)
-    g_yuv_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_yuv_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_yuv_phy_addr)
     {
         LOG_E("Night 43: CMA Alloc Failed.");
@@ -85,18 +86,12 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_yuv_vir_addr = (uint8_t *)(unsigned long)g_yuv_phy_addr;
 
-    // 2. 初始化正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
     g_tick = 0;
     rt_kprintf("Night 43: Binary Turbulence - Calibrating Luminance Overload.\n");
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -183,7 +178,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.saturation = 0; // 黑白模式，强调结构
     prop.hue        = 50;
 
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     g_tick++;
 }
@@ -192,10 +187,10 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 恢复显示引擎的标准参数
     struct aicfb_disp_prop r = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &r);
+    demo_disp_set_prop(&r);
 
     if (g_yuv_phy_addr)
-        mpp_phy_free(g_yuv_phy_addr);
+        demo_pool_free(g_yuv_phy_addr);
 }
 
 struct effect_ops effect_0043 = {
@@ -33,6 +33,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -72,7 +74,6 @@ static unsigned int g_tex_phy_addr = 0;
 static uint16_t    *g_tex_vir_addr = NULL;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -80,7 +81,7 @@ static uint16_t g_palette[PALETTE_SIZE];
 static int effect_init(struct demo_ctx *ctx)
 {
     // 1. 申请单一连续物理显存
-    g_tex_phy_addr = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy_addr = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy_addr)
     {
         LOG_E("Night 45: CMA Alloc Failed.");
@@ -88,13 +89,7 @@ static int effect_init(struct demo_ctx *ctx)
     }
     g_tex_vir_addr = (uint16_t *)(unsigned long)g_tex_phy_addr;
 
-    // 2. 初始化高精度正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-    }
-
-    // 3. 初始化“钛金电光”色谱
+    // 2. 初始化“钛金电光”色谱
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         float f = (float)i / 255.0f;
@@ -111,7 +106,7 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -222,7 +217,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.bright                 = 48;
     prop.saturation             = 90;
     prop.hue                    = 50;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     // 缓慢旋转色彩空间矩阵，模拟金属的反光变幻
     struct aicfb_ccm_config ccm = {0};
@@ -232,7 +227,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[0]  = 0x100;
     ccm.ccm_table[5]  = 0x100 - s;
     ccm.ccm_table[10] = 0x100 + s;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_tick++;
 }
@@ -241,13 +236,13 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 恢复硬件状态
     struct aicfb_disp_prop r1 = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &r1);
+    demo_disp_set_prop(&r1);
     struct aicfb_ccm_config r2 = {0};
     r2.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &r2);
+    demo_disp_set_ccm(&r2);
 
     if (g_tex_phy_addr)
-        mpp_phy_free(g_tex_phy_addr);
+        demo_pool_free(g_tex_phy_addr);
 }
 
 struct effect_ops effect_0045 = {
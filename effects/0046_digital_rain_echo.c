@@ -30,9 +30,14 @@
  * 2. GE Scaler (递归微缩) - 制造向视界深处坠落的纵深感
  * 3. GE Blending (Porter-Duff SRC_OVER) - 实现残影的非线性物理衰减
  * 4. DE CCM (色彩矩阵偏移) - 实时注入光谱噪声
+ * 5. GE Fence (缓冲所有权) - 仅对雨滴触及的行做 invalidate / clean
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_rand.h"
+#include "demo_ge_batch.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -68,13 +73,14 @@
 /* --- Global State --- */
 
 /* 乒乓反馈缓冲区 */
-static unsigned int g_tex_phy[2] = {0, 0};
-static uint16_t    *g_tex_vir[2] = {NULL, NULL};
-static int          g_buf_idx    = 0;
+static unsigned int    g_tex_phy[2] = {0, 0};
+static uint16_t       *g_tex_vir[2] = {NULL, NULL};
+static struct ge_fence g_tex_fence[2];
+static int             g_buf_idx = 0;
 
-static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
-static uint16_t g_palette[PALETTE_SIZE];
+static int              g_tick = 0;
+static uint16_t         g_palette[PALETTE_SIZE];
+static struct demo_rand g_rng;
 
 /* --- Implementation --- */
 
@@ -83,25 +89,21 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理缓冲区
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 46: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
+        ge_fence_init(&g_tex_fence[i], g_tex_vir[i], TEX_SIZE);
+        ge_fence_cpu_release(&g_tex_fence[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化正弦查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-    {
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * Q12_ONE);
-    }
-
-    // 3. 初始化“矩阵”调色板
+    // 2. 初始化“矩阵”调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         float f = (float)i / 255.0f;
@@ -125,10 +127,18 @@ static int effect_init(struct demo_ctx *ctx)
     }
 
     g_tick = 0;
+    demo_rand_seed(&g_rng, 46);
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q12((idx) << 1)
+
+struct rain_drop
+{
+    int x;
+    int len;
+    int y_head;
+};
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -140,6 +150,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     int dst_idx = 1 - g_buf_idx;
 
     /* --- PHASE 1: GE 硬件反馈 (制造向内坠落的记忆) --- */
+    ge_fence_ge_acquire(&g_tex_fence[src_idx], false);
+    ge_fence_ge_acquire(&g_tex_fence[dst_idx], true);
 
     // 1. 彻底清空当前帧 (dst)，确保 Alpha 混合的背景是纯净的
     struct ge_fillrect fill  = {0};
@@ -151,9 +163,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     fill.dst_buf.size.width  = TEX_WIDTH;
     fill.dst_buf.size.height = TEX_HEIGHT;
     fill.dst_buf.format      = TEX_FMT;
-    mpp_ge_fillrect(ctx->ge, &fill);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_fillrect(ctx->ge, &fill);
 
     // 2. 将上一帧 (src) 搬运到 dst，并进行微缩与 Alpha 衰减
     struct ge_bitblt feedback    = {0};
@@ -185,24 +195,40 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     feedback.ctrl.src_alpha_mode   = 1;
     feedback.ctrl.src_global_alpha = TRAIL_DECAY;
 
-    mpp_ge_bitblt(ctx->ge, &feedback);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_bitblt(ctx->ge, &feedback);
+    ge_batch_emit(ctx->ge);
 
     /* --- PHASE 2: CPU 注入新雨滴 (Direct Draw) --- */
-    uint16_t *dst_p = g_tex_vir[dst_idx];
+    uint16_t        *dst_p = g_tex_vir[dst_idx];
+    struct rain_drop drops[RAIN_DENSITY];
+    int              y_min = TEX_HEIGHT;
+    int              y_max = -1;
+
+    // 先确定雨滴位置，只取回它们覆盖的行
+    for (int i = 0; i < RAIN_DENSITY; i++)
+    {
+        drops[i].x      = (int)demo_rand_range(&g_rng, TEX_WIDTH);
+        drops[i].len    = RAIN_MIN_LEN + (int)demo_rand_range(&g_rng, RAIN_MAX_LEN - RAIN_MIN_LEN);
+        int speed       = demo_rand_between(&g_rng, 2, 4);
+        drops[i].y_head = (t * speed + i * 50) % (TEX_HEIGHT + drops[i].len);
+
+        y_min = MIN(y_min, MAX(drops[i].y_head - drops[i].len + 1, 0));
+        y_max = MAX(y_max, MIN(drops[i].y_head, TEX_HEIGHT - 1));
+    }
+
+    int row_off = y_min * TEX_WIDTH * TEX_BPP;
+    int row_len = (y_max >= y_min) ? (y_max - y_min + 1) * TEX_WIDTH * TEX_BPP : 0;
+    ge_fence_cpu_acquire(ctx->ge, &g_tex_fence[dst_idx], row_off, row_len);
 
     for (int i = 0; i < RAIN_DENSITY; i++)
     {
-        int x      = (rand() % TEX_WIDTH);
-        int len    = RAIN_MIN_LEN + (rand() % (RAIN_MAX_LEN - RAIN_MIN_LEN));
-        int speed  = 2 + (rand() % 3);
-        int y_head = (t * speed + i * 50) % (TEX_HEIGHT + len);
+        int x   = drops[i].x;
+        int len = drops[i].len;
 
         // 绘制一条垂直的亮度渐变线
         for (int j = 0; j < len; j++)
         {
-            int y = y_head - j;
+            int y = drops[i].y_head - j;
             if (y >= 0 && y < TEX_HEIGHT)
             {
                 // 头部最亮，尾部消失在背景中
@@ -211,7 +237,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             }
         }
     }
-    aicos_dcache_clean_range((void *)dst_p, TEX_SIZE);
+    ge_fence_cpu_release(&g_tex_fence[dst_idx], row_off, row_len);
+    ge_fence_ge_acquire(&g_tex_fence[dst_idx], false);
 
     /* --- PHASE 3: 全屏拉伸上屏 --- */
     struct ge_bitblt final    = {0};
@@ -234,9 +261,8 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     final.dst_buf.crop.height = ctx->info.height;
     final.ctrl.alpha_en       = 1; // 覆盖模式
 
-    mpp_ge_bitblt(ctx->ge, &final);
-    mpp_ge_emit(ctx->ge);
-    mpp_ge_sync(ctx->ge);
+    ge_batch_bitblt(ctx->ge, &final);
+    ge_batch_emit(ctx->ge);
 
     /* --- PHASE 4: DE CCM 动态光谱律动 --- */
     struct aicfb_ccm_config ccm = {0};
@@ -249,7 +275,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[6]  = shift;
     ccm.ccm_table[10] = 0x100;
 
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     // 交换乒乓缓冲区索引
     g_buf_idx = dst_idx;
@@ -261,12 +287,12 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位显示引擎
     struct aicfb_ccm_config ccm_reset = {0};
     ccm_reset.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
+    demo_disp_set_ccm(&ccm_reset);
 
     for (int i = 0; i < 2; i++)
     {
         if (g_tex_phy[i])
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
     }
 }
 
@@ -32,6 +32,9 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_rand.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -72,9 +75,9 @@ static unsigned int g_tex_phy[2] = {0, 0};
 static uint16_t    *g_tex_vir[2] = {NULL, NULL};
 static int          g_buf_idx    = 0;
 
-static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
-static uint16_t g_palette[PALETTE_SIZE];
+static int              g_tick = 0;
+static uint16_t         g_palette[PALETTE_SIZE];
+static struct demo_rand g_rng;
 
 /* --- Implementation --- */
 
@@ -83,23 +86,19 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理连续缓冲区
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 47: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化查找表 (用于电压脉冲)
-    for (int i = 0; i < LUT_SIZE; i++)
-        sin_lut[i] = (int)(sinf(i * PI / (LUT_SIZE / 2.0f)) * 256.0f);
-
-    // 3. 初始化“黑客帝国”调色板
+    // 2. 初始化“黑客帝国”调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int r, g, b;
@@ -122,11 +121,12 @@ static int effect_init(struct demo_ctx *ctx)
     }
 
     g_tick = 0;
+    demo_rand_seed(&g_rng, 47);
     rt_kprintf("Night 47: Data Deluge - Total Saturation Overload ready.\n");
     return 0;
 }
 
-#define GET_SIN(idx) (sin_lut[(idx) & LUT_MASK])
+#define GET_SIN(idx) demo_sin_q8((idx) << 1)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -196,12 +196,12 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     for (int i = 0; i < RAIN_DENSITY; i++)
     {
         // 随机注入，但受 drift 影响位置
-        int x      = (rand() + drift) % TEX_WIDTH;
-        int y_head = (rand() % TEX_HEIGHT);
-        int len    = 8 + (rand() % 16);
+        int x      = ((int)demo_rand_range(&g_rng, TEX_WIDTH) + drift) % TEX_WIDTH;
+        int y_head = (int)demo_rand_range(&g_rng, TEX_HEIGHT);
+        int len    = 8 + (int)demo_rand_bits(&g_rng, 4);
 
         // 基础亮度随时间波动
-        int brightness_base = 150 + (rand() % 70) + voltage_fluctuation;
+        int brightness_base = 150 + (int)demo_rand_range(&g_rng, 70) + voltage_fluctuation;
 
         // 绘制垂直光束
         for (int j = 0; j < len; j++)
@@ -249,7 +249,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     prop.bright                 = 50;
     prop.saturation             = SATURATION_MAX; // 拉满饱和度，让绿色更具侵略性
     prop.hue                    = 50;
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &prop);
+    demo_disp_set_prop(&prop);
 
     g_buf_idx = dst_idx;
     g_tick++;
@@ -259,12 +259,12 @@ static void effect_deinit(struct demo_ctx *ctx)
 {
     // 复位显示参数
     struct aicfb_disp_prop r = {50, 50, 50, 50};
-    mpp_fb_ioctl(ctx->fb, AICFB_SET_DISP_PROP, &r);
+    demo_disp_set_prop(&r);
 
     for (int i = 0; i < 2; i++)
     {
         if (g_tex_phy[i])
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
     }
 }
 
@@ -35,6 +35,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -73,7 +75,6 @@ static uint16_t    *g_tex_vir[2] = {NULL, NULL};
 static int          g_buf_idx    = 0;
 
 static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
 static uint16_t g_palette[PALETTE_SIZE];
 
 /* --- Implementation --- */
@@ -83,23 +84,19 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理缓冲区
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 48: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化 10-bit 高精度正弦表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-
-    // 3. 初始化“冷峻星空”调色板
+    // 2. 初始化“冷峻星空”调色板
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
         int   r, g, b;
@@ -140,8 +137,8 @@ static int effect_init(struct demo_ctx *ctx)
     return 0;
 }
 
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + 256) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -283,7 +280,7 @@ static void effect_deinit(struct demo_ctx *ctx)
     for (int i = 0; i < 2; i++)
     {
         if (g_tex_phy[i])
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
     }
 }
 
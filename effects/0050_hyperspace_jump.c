@@ -34,6 +34,9 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
+#include "demo_rand.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -71,9 +74,9 @@ static unsigned int g_tex_phy[2] = {0, 0};
 static uint16_t    *g_tex_vir[2] = {NULL, NULL};
 static int          g_buf_idx    = 0;
 
-static int      g_tick = 0;
-static int      sin_lut[LUT_SIZE];
-static uint16_t g_palette[PALETTE_SIZE];
+static int              g_tick = 0;
+static uint16_t         g_palette[PALETTE_SIZE];
+static struct demo_rand g_rng;
 
 /* --- Implementation --- */
 
@@ -82,23 +85,19 @@ static int effect_init(struct demo_ctx *ctx)
     // 1. 申请双物理缓冲区
     for (int i = 0; i < 2; i++)
     {
-        g_tex_phy[i] = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+        g_tex_phy[i] = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
         if (!g_tex_phy[i])
         {
             LOG_E("Night 50: CMA Alloc Failed.");
             if (i == 1)
-                mpp_phy_free(g_tex_phy[0]);
+                demo_pool_free(g_tex_phy[0]);
             return -1;
         }
         g_tex_vir[i] = (uint16_t *)(unsigned long)g_tex_phy[i];
         memset(g_tex_vir[i], 0, TEX_SIZE);
     }
 
-    // 2. 初始化查找表 (Q12)
-    for (int i = 0; i < LUT_SIZE; i++)
-        sin_lut[i] = (int)(sinf(i * PI / 512.0f) * Q12_ONE);
-
-    // 3. 初始化“曲速”调色板
+    // 2. 初始化“曲速”调色板
     // 纯净的青、蓝、白，模拟高能离子
     for (int i = 0; i < PALETTE_SIZE; i++)
     {
@@ -128,12 +127,13 @@ static int effect_init(struct demo_ctx *ctx)
     }
 
     g_tick = 0;
+    demo_rand_seed(&g_rng, 50);
     rt_kprintf("Night 50: Hyperspace Jump - Open-Loop Feedback Engaged.\n");
     return 0;
 }
 
-#define GET_SIN_10(idx) (sin_lut[(idx) & LUT_MASK])
-#define GET_COS_10(idx) (sin_lut[((idx) + 256) & LUT_MASK])
+#define GET_SIN_10(idx) demo_sin_q12(idx)
+#define GET_COS_10(idx) demo_cos_q12(idx)
 
 static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 {
@@ -213,14 +213,14 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
         if (shape_mod == 0)
         {
             // 随机星云喷涌
-            x = cx + (rand() % 40) - 20;
-            y = cy + (rand() % 40) - 20;
+            x = cx + demo_rand_between(&g_rng, -20, 19);
+            y = cy + demo_rand_between(&g_rng, -20, 19);
         }
         else if (shape_mod == 1)
         {
             // 螺旋跃迁轨迹
             int ang = (i * 1024 / STARDUST_COUNT) + (t * 12);
-            int r   = 10 + (rand() % 10);
+            int r   = 10 + (int)demo_rand_range(&g_rng, 10);
             x       = cx + ((r * GET_COS_10(ang)) >> 12);
             y       = cy + ((r * GET_SIN_10(ang)) >> 12);
         }
@@ -229,13 +229,13 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
             // 十字向心冲击
             if (i % 2 == 0)
             {
-                x = cx + (rand() % 60) - 30;
-                y = cy + (rand() % 4) - 2;
+                x = cx + demo_rand_between(&g_rng, -30, 29);
+                y = cy + demo_rand_between(&g_rng, -2, 1);
             }
             else
             {
-                x = cx + (rand() % 4) - 2;
-                y = cy + (rand() % 60) - 30;
+                x = cx + demo_rand_between(&g_rng, -2, 1);
+                y = cy + demo_rand_between(&g_rng, -30, 29);
             }
         }
 
@@ -279,7 +279,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
     ccm.ccm_table[0]  = 0x100;
     ccm.ccm_table[5]  = 0x100;
     ccm.ccm_table[10] = BLUE_SHIFT_VAL;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm);
+    demo_disp_set_ccm(&ccm);
 
     g_buf_idx = dst_idx;
     g_tick++;
@@ -290,12 +290,12 @@ static void effect_deinit(struct demo_ctx *ctx)
     // 复位光谱矩阵
     struct aicfb_ccm_config ccm_reset = {0};
     ccm_reset.enable                  = 0;
-    mpp_fb_ioctl(ctx->fb, AICFB_UPDATE_CCM_CONFIG, &ccm_reset);
+    demo_disp_set_ccm(&ccm_reset);
 
     for (int i = 0; i < 2; i++)
     {
         if (g_tex_phy[i])
-            mpp_phy_free(g_tex_phy[i]);
+            demo_pool_free(g_tex_phy[i]);
     }
 }
 
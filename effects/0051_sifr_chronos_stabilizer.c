@@ -29,6 +29,8 @@
  */
 
 #include "demo_engine.h"
+#include "demo_math.h"
+#include "demo_pool.h"
 #include "mpp_mem.h"
 #include "aic_hal_ge.h"
 #include <math.h>
@@ -49,20 +51,16 @@
 static uint32_t  g_tex_phy = 0;
 static uint16_t *g_tex_vir = NULL;
 static int       g_tick    = 0;
-static int       sin_lut[512];
 
 /* --- Implementation --- */
 
 static int effect_init(struct demo_ctx *ctx)
 {
-    g_tex_phy = mpp_phy_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
+    g_tex_phy = demo_pool_alloc(DEMO_ALIGN_SIZE(TEX_SIZE));
     if (!g_tex_phy)
         return -1;
     g_tex_vir = (uint16_t *)(unsigned long)g_tex_phy;
 
-    for (int i = 0; i < 512; i++)
-        sin_lut[i] = (int)(sinf(i * PI / 256.0f) * 256.0f);
-
     g_tick = 0;
     return 0;
 }
@@ -89,7 +87,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 
             // 中心锚点引力场
             int  dist_sq = (dx * dx + dy * dy);
-            int  pulse   = (sin_lut[(t * ANCHOR_SPEED) & 511] + 256) >> 3; // 脉冲半径
+            int  pulse   = (demo_sin_q8((t * ANCHOR_SPEED) << 1) + 256) >> 3; // 脉冲半径
             bool anchor  = dist_sq < (pulse * pulse);
 
             if (anchor)
@@ -129,7 +127,7 @@ static void effect_draw(struct demo_ctx *ctx, unsigned long phy_addr)
 static void effect_deinit(struct demo_ctx *ctx)
 {
     if (g_tex_phy)
-        mpp_phy_free(g_tex_phy);
+        demo_pool_free(g_tex_phy);
     g_tex_vir = NULL;
 }
 
@@ -1,98 +1,233 @@
 import sys
 import os
 import struct
-from PIL import Image, ImageFont, ImageDraw
+import argparse
 
-def generate_font_bin(ttf_path, size, output_path):
+# v2 资产格式 (小端，各段 4 字节对齐)，须与 demo_perf.c 中的 font_file_hdr 保持一致：
+#   文件头 48 字节：
+#     magic 'GFNT', u32 version, u32 size,
+#     u16 height, u16 baseline, u16 first_char, u16 char_count, u16 flags, u16 reserved,
+#     u32 glyph_off, u32 span_off, u32 span_count, u32 pix_off[2] (RGB565 / ARGB8888，0 表示不存在),
+#     u32 reserved
+#   字形表 (每项 12 字节)：u8 width, u8 advance, s8 bearing, u8 reserved,
+#                          u16 span_first, u16 span_num, u32 pix (预展开像素块中的起始像素序号)
+#   行程表 (每项 3 字节)：u8 y, u8 x, u8 len，同一字形内按行递增
+#   预展开像素块：每字形 width * height 像素，前景全 1 (0xFFFF / 0xFFFFFFFF)，背景 0
+FONT_MAGIC = b'GFNT'
+FONT_VERSION = 2
+FONT_F_RGB565 = 0x1
+FONT_F_ARGB8888 = 0x2
+
+HDR_FMT = '<4sII6H6I'
+GLYPH_FMT = '<BBbBHHI'
+
+
+def render_ttf(ttf_path, size):
     """
-    将 TTF 矢量字体转换为 1-bit 点阵二进制资产。
+    将 TTF 矢量字体光栅化为 1-bit 字形，返回 (height, baseline, glyphs)。
+    glyphs 为 [(width, advance, bearing, rows)]，rows 为逐行的 0/1 列表。
     """
-    print(f"正在转换 {ttf_path} (大小 {size}) -> {output_path}...")
-    
-    if not os.path.exists(ttf_path):
-        print(f"错误：找不到字体文件 {ttf_path}")
-        return
-        
-    try:
-        font = ImageFont.truetype(ttf_path, size)
-    except Exception as e:
-        print(f"载入字体失败: {e}")
-        return
+    from PIL import Image, ImageFont, ImageDraw
 
-    # 字符集：ASCII 32 (空格) 到 126 (~)
-    chars = [chr(i) for i in range(32, 127)]
-    char_data = []
-    offsets = []
-    
-    # 使用固定高度以简化 C 端的 Bit-Blit 逻辑
+    font = ImageFont.truetype(ttf_path, size)
+
+    # 使用固定高度以简化 C 端的逐行逻辑
     font_height = size
-    
-    # 计算头部尺寸：Magic(4) + Height(2) + Count(2) + Offsets(N*4)
-    header_size = 8 + (len(chars) * 4)
-    current_offset = 0
+    ascent, _ = font.getmetrics()
+    glyphs = []
 
-    for char in chars:
-        # 获取字符的边界框以计算宽度
+    # 字符集：ASCII 32 (空格) 到 126 (~)
+    for code in range(32, 127):
+        char = chr(code)
+        # bbox 为 (left, top, right, bottom)
         bbox = font.getbbox(char)
-        if not bbox: # 空格或空字符
-            width = size // 3
-            img = Image.new('1', (width, font_height), 0)
+        width = bbox[2] - bbox[0]
+        if width <= 0:
+            width = size // 4
+
+        img = Image.new('1', (width, font_height), 0)
+        draw = ImageDraw.Draw(img)
+        # 绘制字符。使用 -bbox[0] 偏置使其紧贴位图左边缘，偏置记为 bearing。
+        draw.text((-bbox[0], 0), char, font=font, fill=1)
+
+        rows = [[1 if img.getpixel((x, y)) > 0 else 0 for x in range(width)] for y in range(font_height)]
+        advance = int(round(font.getlength(char)))
+        glyphs.append((width, advance, bbox[0], rows))
+
+    return font_height, min(ascent, font_height), glyphs
+
+
+def read_v1(path, baseline):
+    """
+    读取旧版 (v1) 资产：'FONT', u16 height, u16 count, u32 offsets[count]，
+    每字形 1 字节宽度 + 高位在前的 packed 1-bit 行。v1 没有度量信息，步进取位图宽度。
+    """
+    with open(path, 'rb') as f:
+        blob = f.read()
+    if blob[:4] != b'FONT':
+        raise ValueError(f'{path} 不是 v1 字体资产')
+
+    height, count = struct.unpack_from('<HH', blob, 4)
+    offsets = struct.unpack_from(f'<{count}I', blob, 8)
+    glyphs = []
+
+    for off in offsets:
+        width = blob[off]
+        data = blob[off + 1:]
+        rows = []
+        for y in range(height):
+            bits = [y * width + x for x in range(width)]
+            rows.append([(data[i >> 3] >> (7 - (i & 7))) & 1 for i in bits])
+        glyphs.append((width, width, 0, rows))
+
+    return height, height if baseline is None else baseline, glyphs
+
+
+def row_spans(row):
+    """将一行 0/1 像素拆分为 (x, len) 水平行程"""
+    spans = []
+    x = 0
+    while x < len(row):
+        if row[x]:
+            start = x
+            while x < len(row) and row[x]:
+                x += 1
+            spans.append((start, x - start))
         else:
-            # bbox 为 (left, top, right, bottom)
-            width = bbox[2] - bbox[0]
-            if width <= 0: width = size // 4
-            
-            img = Image.new('1', (width, font_height), 0)
-            draw = ImageDraw.Draw(img)
-            # 绘制字符。使用 -bbox[0] 偏置使其紧贴位图左边缘。
-            draw.text((-bbox[0], 0), char, font=font, fill=1)
-
-        # 转换为位流（ packed bits，水平扫描，高位在前）
-        bits = []
-        for y in range(font_height):
-            for x in range(width):
-                bits.append(1 if img.getpixel((x, y)) > 0 else 0)
-        
-        packed_bytes = bytearray()
-        for i in range(0, len(bits), 8):
-            byte = 0
-            for j in range(8):
-                if i + j < len(bits):
-                    if bits[i + j]:
-                        byte |= (0x80 >> j)
-            packed_bytes.append(byte)
-            
-        char_entry = {
-            'width': width,
-            'data': packed_bytes
-        }
-        char_data.append(char_entry)
-        offsets.append(header_size + current_offset)
-        current_offset += 1 + len(packed_bytes) # 1字节宽度 + 数据区
+            x += 1
+    return spans
+
+
+def align4(buf):
+    buf.extend(b'\0' * (-len(buf) & 3))
+
+
+def write_embed(asset_path, output_path):
+    """
+    将资产文件包装为 C 源文件：字节数组放入 "FontTab" 段 (DEMO_FONT_EMBED)，
+    固件载入时直接在 XIP / 只读段中原地解析，无需文件系统与拷贝。
+    """
+    with open(asset_path, 'rb') as f:
+        blob = f.read()
+    if blob[:4] != FONT_MAGIC:
+        raise ValueError(f'{asset_path} 不是 v2 字体资产，请先转换')
+
+    name = os.path.basename(output_path)
+    lines = [
+        '/*',
+        f' * Filename: {name}',
+        ' * 由 fonts/font_conv.py --embed 生成，请勿手工修改。',
+        f' * 源资产：{os.path.basename(asset_path)} ({len(blob)} 字节)',
+        ' */',
+        '',
+        '#include "demo_perf.h"',
+        '',
+        '#ifdef AIC_GE_DEMO_FONT_EMBED',
+        '',
+        'DEMO_FONT_EMBED(font_asset) = {',
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append('    ' + ' '.join(f'0x{b:02x},' for b in blob[i:i + 16]))
+    lines += ['};', '', '#endif /* AIC_GE_DEMO_FONT_EMBED */', '']
+
+    with open(output_path, 'w') as f:
+        f.write('\n'.join(lines))
+
+    print(f"成功。内嵌源文件已写入 {output_path} ({len(blob)} 字节)。")
+
+
+def write_v2(output_path, height, baseline, glyphs, pixels):
+    glyph_tab = bytearray()
+    span_tab = bytearray()
+    span_count = 0
+    pix_count = 0
+
+    for width, advance, bearing, rows in glyphs:
+        first = span_count
+        for y, row in enumerate(rows):
+            for x, n in row_spans(row):
+                span_tab += struct.pack('<BBB', y, x, n)
+                span_count += 1
+        glyph_tab += struct.pack(GLYPH_FMT, width, advance, bearing, 0, first, span_count - first, pix_count)
+        pix_count += width * height
+
+    if span_count > 0xFFFF:
+        raise ValueError('行程数超出 16 位索引范围')
+
+    hdr_size = struct.calcsize(HDR_FMT)
+    body = bytearray()
+    glyph_off = hdr_size
+    body += glyph_tab
+    align4(body)
+    span_off = hdr_size + len(body)
+    body += span_tab
+    align4(body)
+
+    # 预展开像素块：每种格式一份，CPU 端可直接整行拷贝
+    flags = 0
+    pix_off = [0, 0]
+    for i, (flag, name, fmt, one) in enumerate(
+            [(FONT_F_RGB565, '565', '<H', 0xFFFF), (FONT_F_ARGB8888, '8888', '<I', 0xFFFFFFFF)]):
+        if name not in pixels:
+            continue
+        flags |= flag
+        pix_off[i] = hdr_size + len(body)
+        for _, _, _, rows in glyphs:
+            for row in rows:
+                body += b''.join(struct.pack(fmt, one if p else 0) for p in row)
+        align4(body)
+
+    size = hdr_size + len(body)
+    hdr = struct.pack(HDR_FMT, FONT_MAGIC, FONT_VERSION, size, height, baseline, 32, len(glyphs), flags, 0,
+                      glyph_off, span_off, span_count, pix_off[0], pix_off[1], 0)
 
     # 确保存储目录存在
-    os.makedirs(os.path.dirname(output_path), exist_ok=True)
+    if os.path.dirname(output_path):
+        os.makedirs(os.path.dirname(output_path), exist_ok=True)
 
     with open(output_path, 'wb') as f:
-        # 幻数：'FONT'
-        f.write(b'FONT') 
-        f.write(struct.pack('<H', font_height))
-        f.write(struct.pack('<H', len(chars)))
-        
-        # 偏移表（文件内的绝对偏移）
-        for off in offsets:
-            f.write(struct.pack('<I', off))
-            
-        # 字符数据块
-        for entry in char_data:
-            f.write(struct.pack('B', entry['width']))
-            f.write(entry['data'])
-
-    print(f"成功。资产已写入 {output_path} ({os.path.getsize(output_path)} 字节)。")
+        f.write(hdr)
+        f.write(body)
+
+    print(f"成功。资产已写入 {output_path} ({size} 字节，{len(glyphs)} 字形，{span_count} 行程)。")
+
 
 if __name__ == "__main__":
     # 示例用法: python font_conv.py Inter_24pt-Bold.ttf 24 font_24px.bin
-    if len(sys.argv) < 4:
-        print("用法: python font_conv.py <ttf源文件path> <字号size> <输出bin文件path>")
+    #           python font_conv.py --upgrade font_24px_v1.bin font_24px.bin
+    #           python font_conv.py --embed ../assets/font_24px.bin ../demo_font_data.c
+    parser = argparse.ArgumentParser(description='生成 v2 (行程编码) 点阵字体资产')
+    parser.add_argument('source', help='TTF 源文件，或 --upgrade / --embed 时的资产')
+    parser.add_argument('args', nargs='+', help='<字号size> <输出bin文件path>，或 --upgrade / --embed 时的输出path')
+    parser.add_argument('--upgrade', action='store_true', help='将 v1 资产无损转换为 v2 (字形逐位不变)')
+    parser.add_argument('--embed', action='store_true', help='将 v2 资产生成为内嵌于固件的 C 源文件')
+    parser.add_argument('--baseline', type=int, help='--upgrade 时的基线 (默认取字体高度)')
+    parser.add_argument('--pixels', default='', help='附带预展开像素块，逗号分隔：565,8888')
+    opts = parser.parse_args()
+
+    pixels = [p for p in opts.pixels.split(',') if p]
+    if any(p not in ('565', '8888') for p in pixels):
+        parser.error('--pixels 仅支持 565 与 8888')
+
+    if opts.embed:
+        if len(opts.args) != 1:
+            parser.error('用法: python font_conv.py --embed <v2资产path> <输出c文件path>')
+        write_embed(opts.source, opts.args[0])
+        sys.exit(0)
+
+    if opts.upgrade:
+        if len(opts.args) != 1:
+            parser.error('用法: python font_conv.py --upgrade <v1资产path> <输出bin文件path>')
+        print(f"正在转换 {opts.source} (v1) -> {opts.args[0]}...")
+        height, baseline, glyphs = read_v1(opts.source, opts.baseline)
+        output = opts.args[0]
     else:
-        generate_font_bin(sys.argv[1], int(sys.argv[2]), sys.argv[3])
+        if len(opts.args) != 2:
+            parser.error('用法: python font_conv.py <ttf源文件path> <字号size> <输出bin文件path>')
+        if not os.path.exists(opts.source):
+            sys.exit(f"错误：找不到字体文件 {opts.source}")
+        print(f"正在转换 {opts.source} (大小 {opts.args[0]}) -> {opts.args[1]}...")
+        height, baseline, glyphs = render_ttf(opts.source, int(opts.args[0]))
+        output = opts.args[1]
+
+    write_v2(output, height, baseline, glyphs, pixels)
@@ -0,0 +1,44 @@
+/*
+ * Filename: host/host.h
+ * THE GLASS LABORATORY
+ * 玻璃实验室
+ *
+ * 主机 (Linux) 构建的内部接口：CMA 模拟区、软件 DE 的帧节拍闸门与合成输出。
+ * 仅供 host/ 目录下的模拟层与运行器使用，特效与引擎代码不应包含本文件。
+ */
+
+#ifndef _HOST_H_
+#define _HOST_H_
+
+#include <rtthread.h>
+#include "mpp_types.h"
+
+/* --- CMA 模拟区 (host_mem.c) --- */
+int  host_mem_init(size_t size);
+void host_mem_stats(size_t *used, size_t *peak);
+void host_mem_reset_peak(void);
+
+/* --- 内核时钟 (host_rtos.c) --- */
+/* virtual != 0 时 rt_tick_get 随 VSync 前进 (每帧 16ms)，使 OSD 数值与帧内容可复现 */
+void host_tick_set_virtual(int virtual);
+void host_tick_advance(rt_tick_t ticks);
+
+/* --- 软件显示引擎 (host_fb.c) --- */
+void host_fb_configure(int width, int height, enum mpp_pixel_format format);
+
+/*
+ * 帧节拍闸门：渲染线程在每次 AICFB_WAIT_FOR_VSYNC 时累计帧号，
+ * 当帧号达到 budget 后阻塞，直到运行器放行更多帧。
+ * budget 为 0 表示不限制 (自由运行)。
+ */
+void         host_fb_release(unsigned int frames);
+unsigned int host_fb_wait(void);
+unsigned int host_fb_frame_count(void);
+void         host_fb_set_vsync_hz(int hz);
+
+/* 将当前上屏画面 (图层 + CCM/Gamma/HSBC) 合成为 RGB888，返回像素数据，由调用方 free */
+uint8_t *host_fb_compose(int *width, int *height);
+uint32_t host_fb_hash(void);
+int      host_fb_dump_ppm(const char *path);
+
+#endif /* _HOST_H_ */
@@ -0,0 +1,377 @@
+/*
+ * Filename: host/host_fb.c
+ * THE GLASS RETINA
+ * 玻璃视网膜
+ *
+ * DE 显示引擎的软件替身：双缓冲帧缓冲、VI/UI 图层、UI 层 Alpha 与色键、
+ * 以及 CCM / Gamma / HSBC 后处理。画面只在运行器请求时合成 (dump / hash)，
+ * 不占用渲染线程的时间。
+ *
+ * AICFB_WAIT_FOR_VSYNC 在主机上是一道帧节拍闸门，运行器据此逐帧放行、计时和截图。
+ */
+
+#include <rtthread.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "mpp_fb.h"
+#include "mpp_mem.h"
+#include "demo_utils.h"
+#include "host.h"
+
+struct mpp_fb
+{
+    struct aicfb_screeninfo   info;
+    struct aicfb_layer_data   layer[2]; /* [VIDEO] / [UI] */
+    struct aicfb_alpha_config alpha;
+    struct aicfb_ck_config    ck;
+    struct aicfb_ccm_config   ccm;
+    struct aicfb_gamma_config gamma;
+    struct aicfb_disp_prop    prop;
+
+    /* 帧节拍闸门 */
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    unsigned int    frame_count;
+    unsigned int    budget;
+    int             vsync_hz;
+    struct timespec last_vsync;
+};
+
+static struct mpp_fb g_fb = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+};
+
+static int g_cfg_w   = 640;
+static int g_cfg_h   = 480;
+static int g_cfg_fmt = MPP_FMT_RGB_565;
+
+void host_fb_configure(int width, int height, enum mpp_pixel_format format)
+{
+    g_cfg_w   = width;
+    g_cfg_h   = height;
+    g_cfg_fmt = format;
+}
+
+void host_fb_set_vsync_hz(int hz)
+{
+    g_fb.vsync_hz = hz;
+}
+
+static int fb_bpp(int fmt)
+{
+    if (fmt == MPP_FMT_RGB_565)
+        return 2;
+    if (fmt == MPP_FMT_RGB_888)
+        return 3;
+    return 4;
+}
+
+struct mpp_fb *mpp_fb_open(void)
+{
+    struct mpp_fb *fb = &g_fb;
+    if (fb->info.framebuffer)
+        return fb;
+
+    int          bpp    = fb_bpp(g_cfg_fmt);
+    unsigned int stride = g_cfg_w * bpp;
+    unsigned int len    = stride * g_cfg_h * 2;
+    unsigned int phy    = mpp_phy_alloc(len);
+    if (!phy)
+        return RT_NULL;
+    memset((void *)(unsigned long)phy, 0, len);
+
+    fb->info.format         = g_cfg_fmt;
+    fb->info.bits_per_pixel = bpp * 8;
+    fb->info.stride         = stride;
+    fb->info.width          = g_cfg_w;
+    fb->info.height         = g_cfg_h;
+    fb->info.framebuffer    = (unsigned char *)(unsigned long)phy;
+    fb->info.smem_len       = len;
+
+    /* 上电状态：UI 层全屏显示 0 号缓冲，VI 层关闭 */
+    struct aicfb_layer_data *ui = &fb->layer[AICFB_LAYER_TYPE_UI];
+    ui->layer_id                = AICFB_LAYER_TYPE_UI;
+    ui->enable                  = 1;
+    ui->buf.buf_type            = MPP_PHY_ADDR;
+    ui->buf.phy_addr[0]         = phy;
+    ui->buf.stride[0]           = stride;
+    ui->buf.size.width          = g_cfg_w;
+    ui->buf.size.height         = g_cfg_h;
+    ui->buf.format              = g_cfg_fmt;
+    fb->layer[AICFB_LAYER_TYPE_VIDEO].layer_id = AICFB_LAYER_TYPE_VIDEO;
+
+    fb->prop = (struct aicfb_disp_prop){50, 50, 50, 50};
+    return fb;
+}
+
+void mpp_fb_close(struct mpp_fb *fb)
+{
+    (void)fb;
+}
+
+/* --- 帧节拍闸门 --- */
+
+static void fb_vsync(struct mpp_fb *fb)
+{
+    /* 可选：按真实刷新率节流，模拟面板的 VSync 等待 */
+    if (fb->vsync_hz > 0)
+    {
+        long            period = 1000000000L / fb->vsync_hz;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long elapsed = (now.tv_sec - fb->last_vsync.tv_sec) * 1000000000L + (now.tv_nsec - fb->last_vsync.tv_nsec);
+        if (elapsed < period)
+            usleep((period - elapsed) / 1000);
+        clock_gettime(CLOCK_MONOTONIC, &fb->last_vsync);
+    }
+    pthread_mutex_lock(&fb->lock);
+    host_tick_advance((fb->frame_count + 1) * RT_TICK_PER_SECOND / 60 - fb->frame_count * RT_TICK_PER_SECOND / 60);
+    fb->frame_count++;
+    pthread_cond_broadcast(&fb->cond);
+    while (fb->budget && fb->frame_count >= fb->budget)
+        pthread_cond_wait(&fb->cond, &fb->lock);
+    pthread_mutex_unlock(&fb->lock);
+}
+
+void host_fb_release(unsigned int frames)
+{
+    pthread_mutex_lock(&g_fb.lock);
+    g_fb.budget = frames ? g_fb.frame_count + frames : 0;
+    pthread_cond_broadcast(&g_fb.cond);
+    pthread_mutex_unlock(&g_fb.lock);
+}
+
+unsigned int host_fb_wait(void)
+{
+    pthread_mutex_lock(&g_fb.lock);
+    while (g_fb.budget == 0 || g_fb.frame_count < g_fb.budget)
+        pthread_cond_wait(&g_fb.cond, &g_fb.lock);
+    unsigned int n = g_fb.frame_count;
+    pthread_mutex_unlock(&g_fb.lock);
+    return n;
+}
+
+unsigned int host_fb_frame_count(void)
+{
+    pthread_mutex_lock(&g_fb.lock);
+    unsigned int n = g_fb.frame_count;
+    pthread_mutex_unlock(&g_fb.lock);
+    return n;
+}
+
+/* --- ioctl --- */
+
+int mpp_fb_ioctl(struct mpp_fb *fb, int cmd, void *args)
+{
+    switch (cmd)
+    {
+    case AICFB_WAIT_FOR_VSYNC:
+        fb_vsync(fb);
+        return 0;
+    case AICFB_GET_SCREENINFO:
+        *(struct aicfb_screeninfo *)args = fb->info;
+        return 0;
+    case AICFB_PAN_DISPLAY:
+    {
+        int idx = *(int *)args;
+        fb->layer[AICFB_LAYER_TYPE_UI].buf.phy_addr[0] =
+            (unsigned int)(unsigned long)fb->info.framebuffer + idx * fb->info.stride * fb->info.height;
+        return 0;
+    }
+    case AICFB_GET_LAYER_CONFIG:
+    case AICFB_UPDATE_LAYER_CONFIG:
+    {
+        struct aicfb_layer_data *l = args;
+        if (l->layer_id > AICFB_LAYER_TYPE_UI)
+            return -1;
+        if (cmd == AICFB_GET_LAYER_CONFIG)
+            *l = fb->layer[l->layer_id];
+        else
+            fb->layer[l->layer_id] = *l;
+        return 0;
+    }
+    case AICFB_UPDATE_ALPHA_CONFIG:
+        fb->alpha = *(struct aicfb_alpha_config *)args;
+        return 0;
+    case AICFB_UPDATE_CK_CONFIG:
+        fb->ck = *(struct aicfb_ck_config *)args;
+        return 0;
+    case AICFB_UPDATE_CCM_CONFIG:
+        fb->ccm = *(struct aicfb_ccm_config *)args;
+        return 0;
+    case AICFB_UPDATE_GAMMA_CONFIG:
+        fb->gamma = *(struct aicfb_gamma_config *)args;
+        return 0;
+    case AICFB_SET_DISP_PROP:
+        fb->prop = *(struct aicfb_disp_prop *)args;
+        return 0;
+    default:
+        rt_kprintf("host fb: unsupported ioctl 0x%x\n", cmd);
+        return -1;
+    }
+}
+
+/* --- 合成输出 --- */
+
+static uint32_t layer_read(const struct aicfb_layer_data *l, int x, int y)
+{
+    const uint8_t *p = (const uint8_t *)(unsigned long)l->buf.phy_addr[0] + (size_t)y * l->buf.stride[0];
+    switch (l->buf.format)
+    {
+    case MPP_FMT_RGB_565:
+    {
+        uint16_t c = ((const uint16_t *)p)[x];
+        return ((c & 0xF800) << 8) | ((c & 0x07E0) << 5) | ((c & 0x001F) << 3);
+    }
+    case MPP_FMT_RGB_888:
+        p += x * 3;
+        return ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+    default:
+        return ((const uint32_t *)p)[x] & 0xFFFFFF;
+    }
+}
+
+/* CCM -> Gamma -> HSBC，作用于特效所在图层 */
+static uint32_t post_process(const struct mpp_fb *fb, uint32_t c)
+{
+    int rgb[3] = {(c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF};
+
+    if (fb->ccm.enable)
+    {
+        const int *m = fb->ccm.ccm_table;
+        int        o[3];
+        for (int i = 0; i < 3; i++)
+            o[i] = (m[i * 4] * rgb[0] + m[i * 4 + 1] * rgb[1] + m[i * 4 + 2] * rgb[2]) / 0x100 + m[i * 4 + 3];
+        for (int i = 0; i < 3; i++)
+            rgb[i] = CLAMP(o[i], 0, 255);
+    }
+
+    if (fb->gamma.enable)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            /* 16 节点分段线性：节点 k 对应输入 k * 17 */
+            int k = rgb[i] / 17;
+            int f = rgb[i] % 17;
+            int a = fb->gamma.gamma_lut[i][MIN(k, 15)];
+            int b = fb->gamma.gamma_lut[i][MIN(k + 1, 15)];
+            rgb[i] = CLAMP(a + (b - a) * f / 17, 0, 255);
+        }
+    }
+
+    const struct aicfb_disp_prop *p = &fb->prop;
+    if (p->bright != 50 || p->contrast != 50 || p->saturation != 50 || p->hue != 50)
+    {
+        int luma = (rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) >> 8;
+        for (int i = 0; i < 3; i++)
+        {
+            int v  = luma + (rgb[i] - luma) * (int)p->saturation / 50;
+            v      = 128 + (v - 128) * (int)p->contrast / 50;
+            v     += ((int)p->bright - 50) * 255 / 50;
+            rgb[i] = CLAMP(v, 0, 255);
+        }
+        if (p->hue != 50)
+        {
+            /* 色调：在 RGB 三轴间做近似旋转 */
+            int h  = ((int)p->hue - 50) * 3;
+            int r  = rgb[0], g = rgb[1], b = rgb[2];
+            rgb[0] = CLAMP(r + ((g - b) * h) / 256, 0, 255);
+            rgb[1] = CLAMP(g + ((b - r) * h) / 256, 0, 255);
+            rgb[2] = CLAMP(b + ((r - g) * h) / 256, 0, 255);
+        }
+    }
+    return ((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | (uint32_t)rgb[2];
+}
+
+uint8_t *host_fb_compose(int *width, int *height)
+{
+    struct mpp_fb *fb = &g_fb;
+    int            w  = fb->info.width;
+    int            h  = fb->info.height;
+    uint8_t       *out = calloc((size_t)w * h, 3);
+    if (!out)
+        return NULL;
+
+    const struct aicfb_layer_data *vi       = &fb->layer[AICFB_LAYER_TYPE_VIDEO];
+    const struct aicfb_layer_data *ui       = &fb->layer[AICFB_LAYER_TYPE_UI];
+    int                            isolated = vi->enable && vi->buf.phy_addr[0];
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            uint32_t c = 0;
+
+            /* 隔离路径：滤镜只作用于 VI 层；传统路径：滤镜作用于整个 UI 层 (含 OSD) */
+            if (isolated && x < vi->buf.size.width && y < vi->buf.size.height)
+                c = post_process(fb, layer_read(vi, x, y));
+
+            if (ui->enable && ui->buf.phy_addr[0])
+            {
+                int lx = x - ui->pos.x;
+                int ly = y - ui->pos.y;
+                if (lx >= 0 && ly >= 0 && lx < ui->buf.size.width && ly < ui->buf.size.height)
+                {
+                    uint32_t u = layer_read(ui, lx, ly);
+                    if (isolated)
+                    {
+                        if (!(fb->ck.enable && u == (fb->ck.value & 0xFFFFFF)))
+                            c = u;
+                    }
+                    else
+                    {
+                        c = post_process(fb, u);
+                    }
+                }
+            }
+
+            uint8_t *o = out + ((size_t)y * w + x) * 3;
+            o[0]       = (c >> 16) & 0xFF;
+            o[1]       = (c >> 8) & 0xFF;
+            o[2]       = c & 0xFF;
+        }
+    }
+
+    if (width)
+        *width = w;
+    if (height)
+        *height = h;
+    return out;
+}
+
+uint32_t host_fb_hash(void)
+{
+    int      w, h;
+    uint8_t *img = host_fb_compose(&w, &h);
+    if (!img)
+        return 0;
+
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < (size_t)w * h * 3; i++)
+        hash = (hash ^ img[i]) * 16777619u;
+    free(img);
+    return hash;
+}
+
+int host_fb_dump_ppm(const char *path)
+{
+    int      w, h;
+    uint8_t *img = host_fb_compose(&w, &h);
+    if (!img)
+        return -1;
+
+    FILE *f = fopen(path, "wb");
+    if (!f)
+    {
+        free(img);
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    fwrite(img, 3, (size_t)w * h, f);
+    fclose(f);
+    free(img);
+    return 0;
+}
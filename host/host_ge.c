@@ -0,0 +1,522 @@
+/*
+ * Filename: host/host_ge.c
+ * THE GLASS ENGINE
+ * 玻璃引擎
+ *
+ * GE 2D 加速器的软件替身：双线性缩放、Rot1 任意角旋转、水平/垂直镜像、
+ * Porter-Duff 混合 (含 ADD/XOR)、色键、渐变填充。
+ *
+ * 执行模型与硬件一致：mpp_ge_fillrect/bitblt/rotate 只把指令压入命令队列，
+ * mpp_ge_emit 将其交给独立的 "GE" 线程异步执行，mpp_ge_sync 等待已提交的指令全部完成。
+ * 因此 CPU 与 GE 的并行 (以及忘记 sync 带来的竞争) 在主机上同样可见。
+ * 队列容量按 SPEC.md 的 4KB 建模，溢出时与真机一样报告 flush_cmd 失败并丢弃指令。
+ * 硬件 Dither 在主机上不模拟。
+ */
+
+#include <rtthread.h>
+#include <pthread.h>
+#include "mpp_ge.h"
+#include "demo_utils.h"
+#include "host.h"
+
+/* 命令队列容量与单条指令的估算体积 (字节) */
+#define GE_QUEUE_SIZE 4096
+#define GE_CMD_FILL   64
+#define GE_CMD_BLT    128
+#define GE_CMD_ROT    128
+#define GE_RING_SIZE  64 /* 已入队 + 执行中的指令槽位 */
+
+enum ge_task_type
+{
+    GE_TASK_FILL,
+    GE_TASK_BLT,
+    GE_TASK_ROT,
+};
+
+struct ge_task
+{
+    enum ge_task_type type;
+    union
+    {
+        struct ge_fillrect fill;
+        struct ge_bitblt   blt;
+        struct ge_rotation rot;
+    };
+};
+
+/*
+ * 环形指令槽：[done, emitted) 为已提交待执行，[emitted, head) 为尚未 emit 的队列。
+ * 只有尚未 emit 的部分计入 4KB 队列预算。
+ */
+struct mpp_ge
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    pthread_t       worker;
+    int             started;
+    struct ge_task  tasks[GE_RING_SIZE];
+    unsigned int    head;
+    unsigned int    emitted;
+    unsigned int    done;
+    int             queued_bytes;
+};
+
+static struct mpp_ge g_ge = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+};
+
+/* --- 像素读写：统一在 ARGB8888 空间中处理 --- */
+
+static int fmt_bpp(enum mpp_pixel_format fmt)
+{
+    switch (fmt)
+    {
+    case MPP_FMT_RGB_565:
+    case MPP_FMT_BGR_565:
+        return 2;
+    case MPP_FMT_RGB_888:
+    case MPP_FMT_BGR_888:
+        return 3;
+    case MPP_FMT_YUV400:
+        return 1;
+    default:
+        return 4;
+    }
+}
+
+static inline uint32_t px_read(const uint8_t *p, enum mpp_pixel_format fmt)
+{
+    switch (fmt)
+    {
+    case MPP_FMT_RGB_565:
+    {
+        uint16_t c = *(const uint16_t *)p;
+        uint32_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        return 0xFF000000 | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    }
+    case MPP_FMT_RGB_888:
+        return 0xFF000000 | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+    case MPP_FMT_XRGB_8888:
+        return 0xFF000000 | *(const uint32_t *)p;
+    case MPP_FMT_YUV400:
+        return 0xFF000000 | ((uint32_t)p[0] * 0x010101);
+    default:
+        return *(const uint32_t *)p;
+    }
+}
+
+static inline void px_write(uint8_t *p, enum mpp_pixel_format fmt, uint32_t c)
+{
+    switch (fmt)
+    {
+    case MPP_FMT_RGB_565:
+        *(uint16_t *)p = (uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F));
+        break;
+    case MPP_FMT_RGB_888:
+        p[0] = c & 0xFF;
+        p[1] = (c >> 8) & 0xFF;
+        p[2] = (c >> 16) & 0xFF;
+        break;
+    case MPP_FMT_YUV400:
+        p[0] = (uint8_t)((((c >> 16) & 0xFF) * 77 + ((c >> 8) & 0xFF) * 150 + (c & 0xFF) * 29) >> 8);
+        break;
+    default:
+        *(uint32_t *)p = c;
+        break;
+    }
+}
+
+/* --- Porter-Duff 混合 --- */
+
+static inline uint32_t ge_alpha(unsigned int mode, uint32_t pixel_a, unsigned int global)
+{
+    if (mode == 1)
+        return global & 0xFF;
+    if (mode == 2)
+        return (pixel_a * (global & 0xFF)) / 255;
+    return pixel_a;
+}
+
+/*
+ * 将源像素 s 合成到目标像素 d 上，返回写回值；返回 0 且 *skip = 1 表示该像素被色键剔除。
+ * alpha_en 沿用硬件极性 (0 = 开启混合)，规则为 GE_PD_NONE 时等价于直接覆盖。
+ */
+static inline uint32_t ge_compose(const struct ge_ctrl *ctrl, uint32_t s, uint32_t d, int *skip)
+{
+    if (ctrl->ck_en && (s & 0xFFFFFF) == (ctrl->ck_value & 0xFFFFFF))
+    {
+        *skip = 1;
+        return 0;
+    }
+    if (ctrl->alpha_en || ctrl->alpha_rules == GE_PD_NONE)
+        return s;
+
+    uint32_t sa = ge_alpha(ctrl->src_alpha_mode, s >> 24, ctrl->src_global_alpha);
+    uint32_t da = ge_alpha(ctrl->dst_alpha_mode, d >> 24, ctrl->dst_global_alpha);
+    uint32_t fa, fb; /* 0~255 */
+
+    switch (ctrl->alpha_rules)
+    {
+    case GE_PD_CLEAR:
+        fa = 0, fb = 0;
+        break;
+    case GE_PD_SRC:
+        fa = 255, fb = 0;
+        break;
+    case GE_PD_DST:
+        fa = 0, fb = 255;
+        break;
+    case GE_PD_SRC_OVER:
+        fa = 255, fb = 255 - sa;
+        break;
+    case GE_PD_DST_OVER:
+        fa = 255 - da, fb = 255;
+        break;
+    case GE_PD_SRC_IN:
+        fa = da, fb = 0;
+        break;
+    case GE_PD_DST_IN:
+        fa = 0, fb = sa;
+        break;
+    case GE_PD_SRC_OUT:
+        fa = 255 - da, fb = 0;
+        break;
+    case GE_PD_DST_OUT:
+        fa = 0, fb = 255 - sa;
+        break;
+    case GE_PD_SRC_ATOP:
+        fa = da, fb = 255 - sa;
+        break;
+    case GE_PD_DST_ATOP:
+        fa = 255 - da, fb = sa;
+        break;
+    case GE_PD_XOR:
+        fa = 255 - da, fb = 255 - sa;
+        break;
+    case GE_PD_ADD:
+    default:
+        fa = 255, fb = 255;
+        break;
+    }
+
+    /* 预乘后合成：C = Cs*Sa*Fa + Cd*Da*Fb */
+    uint32_t ks  = sa * fa / 255;
+    uint32_t kd  = da * fb / 255;
+    uint32_t out = MIN(255u, ks + kd) << 24;
+    for (int sh = 0; sh < 24; sh += 8)
+    {
+        uint32_t c = (((s >> sh) & 0xFF) * ks + ((d >> sh) & 0xFF) * kd) / 255;
+        out |= MIN(255u, c) << sh;
+    }
+    return out;
+}
+
+static inline void ge_put(const struct ge_ctrl *ctrl, uint8_t *p, enum mpp_pixel_format fmt, uint32_t s)
+{
+    int      skip = 0;
+    uint32_t d    = (ctrl->alpha_en || ctrl->alpha_rules == GE_PD_NONE) ? 0 : px_read(p, fmt);
+    uint32_t c    = ge_compose(ctrl, s, d, &skip);
+    if (!skip)
+        px_write(p, fmt, c);
+}
+
+/* --- 参数校验：硬件不做裁剪，越界即报错 --- */
+
+static int ge_buf_rect(const struct mpp_buf *buf, struct mpp_rect *r, const char *tag)
+{
+    if (buf->buf_type != MPP_PHY_ADDR || buf->phy_addr[0] == 0 || buf->size.width <= 0 || buf->size.height <= 0)
+    {
+        rt_kprintf("ge: invalid %s buffer\n", tag);
+        return -1;
+    }
+
+    if (buf->crop_en)
+        *r = buf->crop;
+    else
+        *r = (struct mpp_rect){0, 0, buf->size.width, buf->size.height};
+
+    if (r->x < 0 || r->y < 0 || r->width <= 0 || r->height <= 0 || r->x + r->width > buf->size.width ||
+        r->y + r->height > buf->size.height)
+    {
+        rt_kprintf("ge: invalid %s crop (%d,%d %dx%d in %dx%d)\n", tag, r->x, r->y, r->width, r->height,
+                   buf->size.width, buf->size.height);
+        return -1;
+    }
+    return 0;
+}
+
+static inline uint8_t *ge_px_addr(const struct mpp_buf *buf, int x, int y, int bpp)
+{
+    return (uint8_t *)(unsigned long)buf->phy_addr[0] + (size_t)y * buf->stride[0] + (size_t)x * bpp;
+}
+
+/* --- 指令执行 --- */
+
+static void ge_exec_fill(const struct ge_fillrect *f)
+{
+    struct mpp_rect r;
+    if (ge_buf_rect(&f->dst_buf, &r, "dst") < 0)
+        return;
+
+    int bpp = fmt_bpp(f->dst_buf.format);
+    for (int y = 0; y < r.height; y++)
+    {
+        uint8_t *p = ge_px_addr(&f->dst_buf, r.x, r.y + y, bpp);
+        for (int x = 0; x < r.width; x++, p += bpp)
+        {
+            uint32_t c = f->start_color;
+            if (f->type != GE_NO_GRADIENT)
+            {
+                int pos = (f->type == GE_H_LINEAR_GRADIENT) ? x : y;
+                int len = (f->type == GE_H_LINEAR_GRADIENT) ? r.width : r.height;
+                int w   = len > 1 ? (pos * 256) / (len - 1) : 0;
+                c       = 0;
+                for (int sh = 0; sh < 32; sh += 8)
+                {
+                    int a = (f->start_color >> sh) & 0xFF;
+                    int b = (f->end_color >> sh) & 0xFF;
+                    c |= (uint32_t)((a * (256 - w) + b * w) >> 8) << sh;
+                }
+            }
+            ge_put(&f->ctrl, p, f->dst_buf.format, c);
+        }
+    }
+}
+
+/* 两组通道并行插值 (0x00FF00FF 掩码)，w 为 0~256 */
+static inline uint32_t lerp_argb(uint32_t a, uint32_t b, uint32_t w)
+{
+    uint32_t rb = (((a & 0x00FF00FF) * (256 - w) + (b & 0x00FF00FF) * w) >> 8) & 0x00FF00FF;
+    uint32_t ag = (((a >> 8) & 0x00FF00FF) * (256 - w) + ((b >> 8) & 0x00FF00FF) * w) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static void ge_exec_blt(const struct ge_bitblt *b)
+{
+    struct mpp_rect sr, dr;
+    if (ge_buf_rect(&b->src_buf, &sr, "src") < 0 || ge_buf_rect(&b->dst_buf, &dr, "dst") < 0)
+        return;
+
+    /* Scaler 能力：1/16x ~ 16x */
+    if (dr.width > sr.width * 16 || dr.height > sr.height * 16 || dr.width * 16 < sr.width ||
+        dr.height * 16 < sr.height)
+    {
+        rt_kprintf("ge: scaler ratio out of range (%dx%d -> %dx%d)\n", sr.width, sr.height, dr.width, dr.height);
+        return;
+    }
+
+    enum mpp_pixel_format sfmt   = b->src_buf.format;
+    enum mpp_pixel_format dfmt   = b->dst_buf.format;
+    int                   sbpp   = fmt_bpp(sfmt);
+    int                   dbpp   = fmt_bpp(dfmt);
+    int                   flip_h = b->ctrl.flags & MPP_FLIP_H;
+    int                   flip_v = b->ctrl.flags & MPP_FLIP_V;
+
+    /* 每个目标行先把所需的两条源行读入行缓存，再做水平插值；列映射预先算好 */
+    int       scaled = (sr.width != dr.width || sr.height != dr.height);
+    int32_t   step_x = (int32_t)(((int64_t)sr.width << 16) / dr.width);
+    int32_t   step_y = (int32_t)(((int64_t)sr.height << 16) / dr.height);
+    uint32_t *row0   = malloc(sizeof(uint32_t) * sr.width * 2 + sizeof(int32_t) * dr.width * 2);
+    if (!row0)
+        return;
+    uint32_t *row1  = row0 + sr.width;
+    int32_t  *col_x = (int32_t *)(row1 + sr.width);
+    int32_t  *col_w = col_x + dr.width;
+
+    for (int x = 0; x < dr.width; x++)
+    {
+        int ox = flip_h ? (dr.width - 1 - x) : x;
+        if (scaled)
+        {
+            int32_t fx = ox * step_x + (step_x >> 1) - 0x8000;
+            fx         = CLAMP(fx, 0, (sr.width - 1) << 16);
+            col_x[x]   = fx >> 16;
+            col_w[x]   = (fx >> 8) & 0xFF;
+        }
+        else
+        {
+            col_x[x] = ox;
+            col_w[x] = 0;
+        }
+    }
+
+    for (int y = 0; y < dr.height; y++)
+    {
+        int      oy = flip_v ? (dr.height - 1 - y) : y;
+        int      y0, y1;
+        uint32_t wy = 0;
+
+        if (scaled)
+        {
+            int32_t fy = oy * step_y + (step_y >> 1) - 0x8000;
+            fy         = CLAMP(fy, 0, (sr.height - 1) << 16);
+            y0         = fy >> 16;
+            y1         = MIN(y0 + 1, sr.height - 1);
+            wy         = (fy >> 8) & 0xFF;
+        }
+        else
+        {
+            y0 = y1 = oy;
+        }
+
+        const uint8_t *s0 = ge_px_addr(&b->src_buf, sr.x, sr.y + y0, sbpp);
+        const uint8_t *s1 = ge_px_addr(&b->src_buf, sr.x, sr.y + y1, sbpp);
+        for (int x = 0; x < sr.width; x++)
+        {
+            row0[x] = px_read(s0 + x * sbpp, sfmt);
+            row1[x] = (y1 == y0) ? row0[x] : px_read(s1 + x * sbpp, sfmt);
+        }
+
+        uint8_t *p = ge_px_addr(&b->dst_buf, dr.x, dr.y + y, dbpp);
+        for (int x = 0; x < dr.width; x++, p += dbpp)
+        {
+            int      x0 = col_x[x];
+            uint32_t s;
+            if (scaled)
+            {
+                int      x1 = MIN(x0 + 1, sr.width - 1);
+                uint32_t wx = col_w[x];
+                s = lerp_argb(lerp_argb(row0[x0], row0[x1], wx), lerp_argb(row1[x0], row1[x1], wx), wy);
+            }
+            else
+            {
+                s = row0[x0];
+            }
+            ge_put(&b->ctrl, p, dfmt, s);
+        }
+    }
+    free(row0);
+}
+
+static void ge_exec_rot(const struct ge_rotation *r)
+{
+    struct mpp_rect sr, dr;
+    if (ge_buf_rect(&r->src_buf, &sr, "src") < 0 || ge_buf_rect(&r->dst_buf, &dr, "dst") < 0)
+        return;
+
+    enum mpp_pixel_format sfmt = r->src_buf.format;
+    enum mpp_pixel_format dfmt = r->dst_buf.format;
+    int                   sbpp = fmt_bpp(sfmt);
+    int                   dbpp = fmt_bpp(dfmt);
+
+    /* 逆映射：src = R(-θ) * (dst - dst_center) + src_center，未覆盖的死角保持原样 */
+    for (int y = dr.y; y < dr.y + dr.height; y++)
+    {
+        int      dy = y - r->dst_rot_center.y;
+        uint8_t *p  = ge_px_addr(&r->dst_buf, dr.x, y, dbpp);
+        for (int x = dr.x; x < dr.x + dr.width; x++, p += dbpp)
+        {
+            int dx = x - r->dst_rot_center.x;
+            int sx = ((dx * r->angle_cos + dy * r->angle_sin) >> Q12_SHIFT) + r->src_rot_center.x;
+            int sy = ((dy * r->angle_cos - dx * r->angle_sin) >> Q12_SHIFT) + r->src_rot_center.y;
+            if (sx < sr.x || sy < sr.y || sx >= sr.x + sr.width || sy >= sr.y + sr.height)
+                continue;
+            ge_put(&r->ctrl, p, dfmt, px_read(ge_px_addr(&r->src_buf, sx, sy, sbpp), sfmt));
+        }
+    }
+}
+
+/* --- 命令队列 --- */
+
+static int ge_queue(struct mpp_ge *ge, enum ge_task_type type, const void *op, size_t op_size, int cmd_size)
+{
+    pthread_mutex_lock(&ge->lock);
+    if (ge->queued_bytes + cmd_size > GE_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&ge->lock);
+        rt_kprintf("flush_cmd: write() failed!\n");
+        return -1;
+    }
+    /* 槽位被执行中的指令占满时等待 GE 消化 */
+    while (ge->head - ge->done >= GE_RING_SIZE)
+        pthread_cond_wait(&ge->cond, &ge->lock);
+
+    struct ge_task *t = &ge->tasks[ge->head % GE_RING_SIZE];
+    t->type           = type;
+    memcpy(&t->fill, op, op_size);
+    ge->head++;
+    ge->queued_bytes += cmd_size;
+    pthread_mutex_unlock(&ge->lock);
+    return 0;
+}
+
+static void *ge_worker(void *arg)
+{
+    struct mpp_ge *ge = arg;
+
+    pthread_mutex_lock(&ge->lock);
+    while (1)
+    {
+        while (ge->done == ge->emitted)
+            pthread_cond_wait(&ge->cond, &ge->lock);
+
+        struct ge_task *t = &ge->tasks[ge->done % GE_RING_SIZE];
+        pthread_mutex_unlock(&ge->lock);
+
+        if (t->type == GE_TASK_FILL)
+            ge_exec_fill(&t->fill);
+        else if (t->type == GE_TASK_BLT)
+            ge_exec_blt(&t->blt);
+        else
+            ge_exec_rot(&t->rot);
+
+        pthread_mutex_lock(&ge->lock);
+        ge->done++;
+        pthread_cond_broadcast(&ge->cond);
+    }
+    return NULL;
+}
+
+struct mpp_ge *mpp_ge_open(void)
+{
+    struct mpp_ge *ge = &g_ge;
+
+    pthread_mutex_lock(&ge->lock);
+    if (!ge->started && pthread_create(&ge->worker, NULL, ge_worker, ge) == 0)
+    {
+        pthread_detach(ge->worker);
+        ge->started = 1;
+    }
+    pthread_mutex_unlock(&ge->lock);
+    return ge->started ? ge : NULL;
+}
+
+void mpp_ge_close(struct mpp_ge *ge)
+{
+    (void)ge;
+}
+
+int mpp_ge_fillrect(struct mpp_ge *ge, struct ge_fillrect *fill)
+{
+    return ge_queue(ge, GE_TASK_FILL, fill, sizeof(*fill), GE_CMD_FILL);
+}
+
+int mpp_ge_bitblt(struct mpp_ge *ge, struct ge_bitblt *blt)
+{
+    return ge_queue(ge, GE_TASK_BLT, blt, sizeof(*blt), GE_CMD_BLT);
+}
+
+int mpp_ge_rotate(struct mpp_ge *ge, struct ge_rotation *rot)
+{
+    return ge_queue(ge, GE_TASK_ROT, rot, sizeof(*rot), GE_CMD_ROT);
+}
+
+int mpp_ge_emit(struct mpp_ge *ge)
+{
+    pthread_mutex_lock(&ge->lock);
+    ge->emitted      = ge->head;
+    ge->queued_bytes = 0;
+    pthread_cond_broadcast(&ge->cond);
+    pthread_mutex_unlock(&ge->lock);
+    return 0;
+}
+
+int mpp_ge_sync(struct mpp_ge *ge)
+{
+    pthread_mutex_lock(&ge->lock);
+    while (ge->done != ge->emitted)
+        pthread_cond_wait(&ge->cond, &ge->lock);
+    pthread_mutex_unlock(&ge->lock);
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Filename: host/host_main.c
+ * THE GLASS OBSERVATORY
+ * 玻璃观测台
+ *
+ * 主机运行器：在 Linux 上启动原封不动的 demo_entry.c 渲染线程，
+ * 通过软件 DE 的帧节拍闸门逐个特效放行 N 帧，统计平均帧耗时，
+ * 并输出合成画面的哈希值 (可选导出 PPM) 以便在不同构建之间比对。
+ *
+ * 用法:
+ *   ge_demo_host [-n 帧数] [-w 预热帧] [-e 特效序号] [-o 导出目录] [-f 565|888|8888] [-s 刷新率] [-r]
+ *   ge_demo_host [选项] <msh 命令> [参数...]     (例如: ge_demo_host demo_list)
+ */
+
+#include <rtthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "demo_engine.h"
+#include "host.h"
+
+extern struct effect_ops     *__start_EffectTab[];
+extern struct effect_ops     *__stop_EffectTab[];
+extern const struct host_cmd *const __start_HostCmdTab[];
+extern const struct host_cmd *const __stop_HostCmdTab[];
+
+#define HOST_CMA_SIZE (64 * 1024 * 1024)
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-n frames] [-w warmup] [-e index] [-o dir] [-f 565|888|8888] [-s hz] [-r] [msh command ...]\n",
+           prog);
+    printf("  -n  frames timed per effect (default 60)\n");
+    printf("  -w  warm-up frames per effect, including init (default 2)\n");
+    printf("  -e  run a single effect index (default: all)\n");
+    printf("  -o  dump the last composed frame of each effect as PPM into dir\n");
+    printf("  -f  framebuffer format (default 565)\n");
+    printf("  -s  throttle to a simulated vsync rate in Hz (default 0 = full speed)\n");
+    printf("  -r  real-time ticks for demo_perf (default: virtual 60Hz ticks, reproducible OSD)\n");
+}
+
+static int run_command(int argc, char **argv)
+{
+    for (const struct host_cmd *const *c = __start_HostCmdTab; c < __stop_HostCmdTab; c++)
+    {
+        if (strcmp((*c)->name, argv[0]) == 0)
+            return (*c)->func(argc, argv);
+    }
+
+    printf("Unknown command: %s\nAvailable:\n", argv[0]);
+    for (const struct host_cmd *const *c = __start_HostCmdTab; c < __stop_HostCmdTab; c++)
+        printf("  %-12s %s\n", (*c)->name, (*c)->desc);
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    int         frames   = 60;
+    int         warmup   = 2;
+    int         only     = -1;
+    const char *dump_dir = NULL;
+    int         format   = MPP_FMT_RGB_565;
+    int         vsync_hz = 0;
+    int         realtime = 0;
+    int         opt;
+
+    while ((opt = getopt(argc, argv, "+n:w:e:o:f:s:rh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            frames = MAX(1, atoi(optarg));
+            break;
+        case 'w':
+            warmup = MAX(1, atoi(optarg));
+            break;
+        case 'e':
+            only = atoi(optarg);
+            break;
+        case 'o':
+            dump_dir = optarg;
+            break;
+        case 'f':
+            format = (atoi(optarg) == 888)    ? MPP_FMT_RGB_888
+                     : (atoi(optarg) == 8888) ? MPP_FMT_ARGB_8888
+                                              : MPP_FMT_RGB_565;
+            break;
+        case 's':
+            vsync_hz = atoi(optarg);
+            break;
+        case 'r':
+            realtime = 1;
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (host_mem_init(HOST_CMA_SIZE) < 0)
+        return 1;
+    host_fb_configure(DEMO_SCREEN_WIDTH, DEMO_SCREEN_HEIGHT, format);
+    host_fb_set_vsync_hz(vsync_hz);
+    host_tick_set_virtual(!realtime);
+
+    /* 放行首帧后闸门关闭，渲染线程停在首个 VSync 上等待运行器 */
+    host_fb_release(1);
+    demo_core_init();
+    demo_core_start();
+    host_fb_wait();
+
+    /* 命令模式：放开闸门，让渲染线程自由运行，执行 msh 命令后退出 */
+    if (optind < argc)
+    {
+        host_fb_release(0);
+        int ret = run_command(argc - optind, argv + optind);
+        fflush(stdout);
+        _exit(ret < 0 ? 1 : 0);
+    }
+
+    int count = __stop_EffectTab - __start_EffectTab;
+    int first = (only >= 0) ? only : 0;
+    int last  = (only >= 0) ? only : count - 1;
+    if (first < 0 || last >= count)
+    {
+        printf("Invalid effect index %d (0..%d)\n", only, count - 1);
+        _exit(1);
+    }
+
+    printf("%-4s %-32s %10s %10s %10s\n", "id", "name", "init_ms", "frame_ms", "hash");
+    for (int i = first; i <= last; i++)
+    {
+        /* 预热帧包含切换与 init */
+        demo_jump_effect(i);
+        double t0 = now_ms();
+        host_fb_release(warmup);
+        host_fb_wait();
+        double t1 = now_ms();
+
+        host_fb_release(frames);
+        host_fb_wait();
+        double t2 = now_ms();
+
+        uint32_t hash = host_fb_hash();
+        if (dump_dir)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/effect_%02d.ppm", dump_dir, i);
+            if (host_fb_dump_ppm(path) < 0)
+                printf("Dump failed: %s\n", path);
+        }
+
+        printf("%-4d %-32s %10.3f %10.3f   %08x\n", i, __start_EffectTab[i]->name, t1 - t0, (t2 - t1) / frames, hash);
+        fflush(stdout);
+    }
+
+    /* 渲染线程停在闸门上，直接退出进程 */
+    _exit(0);
+}
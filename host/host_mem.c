@@ -0,0 +1,145 @@
+/*
+ * Filename: host/host_mem.c
+ * THE LOW SANCTUARY
+ * 低地圣所
+ *
+ * CMA 模拟区：特效以 unsigned int 保存 "物理地址" 并直接强转为指针，
+ * 因此主机上必须把整块内存映射到 4GB 以下，再在其中做首次适配分配。
+ */
+
+#define _GNU_SOURCE
+#include <rtthread.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include "mpp_mem.h"
+#include "demo_bench.h"
+#include "host.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+/* 模拟区基址：选一个通常空闲的低地址 */
+#define ARENA_BASE  0x20000000UL
+#define ARENA_ALIGN 64
+
+/* 块头紧贴在用户区之前，按地址顺序串成链表 */
+struct arena_blk
+{
+    struct arena_blk *next;
+    size_t            size; /* 含块头 */
+    int               used;
+};
+
+#define BLK_HDR ((sizeof(struct arena_blk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static pthread_mutex_t   g_lock  = PTHREAD_MUTEX_INITIALIZER;
+static struct arena_blk *g_head  = NULL;
+static size_t            g_used  = 0;
+static size_t            g_peak  = 0;
+
+int host_mem_init(size_t size)
+{
+    void *base = mmap((void *)ARENA_BASE, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (base == MAP_FAILED || (unsigned long)base + size > 0xFFFFFFFFUL)
+    {
+        rt_kprintf("Host Error: CMA arena mmap at 0x%lx failed.\n", ARENA_BASE);
+        return -1;
+    }
+
+    g_head       = (struct arena_blk *)base;
+    g_head->next = NULL;
+    g_head->size = size;
+    g_head->used = 0;
+    return 0;
+}
+
+void host_mem_stats(size_t *used, size_t *peak)
+{
+    pthread_mutex_lock(&g_lock);
+    if (used)
+        *used = g_used;
+    if (peak)
+        *peak = g_peak;
+    pthread_mutex_unlock(&g_lock);
+}
+
+void host_mem_reset_peak(void)
+{
+    pthread_mutex_lock(&g_lock);
+    g_peak = g_used;
+    pthread_mutex_unlock(&g_lock);
+}
+
+unsigned int mpp_phy_alloc(size_t size)
+{
+    size_t need = BLK_HDR + ((size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1));
+
+    pthread_mutex_lock(&g_lock);
+    for (struct arena_blk *b = g_head; b; b = b->next)
+    {
+        if (b->used || b->size < need)
+            continue;
+
+        /* 剩余空间足够再切出一块时才分裂 */
+        if (b->size - need > BLK_HDR + ARENA_ALIGN)
+        {
+            struct arena_blk *rest = (struct arena_blk *)((uint8_t *)b + need);
+            rest->next             = b->next;
+            rest->size             = b->size - need;
+            rest->used             = 0;
+            b->next                = rest;
+            b->size                = need;
+        }
+        b->used = 1;
+        g_used += b->size;
+        if (g_used > g_peak)
+            g_peak = g_used;
+        pthread_mutex_unlock(&g_lock);
+        return (unsigned int)((unsigned long)b + BLK_HDR);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return 0;
+}
+
+void mpp_phy_free(unsigned int addr)
+{
+    if (!addr)
+        return;
+
+    pthread_mutex_lock(&g_lock);
+    struct arena_blk *prev = NULL;
+    for (struct arena_blk *b = g_head; b; prev = b, b = b->next)
+    {
+        if ((unsigned long)b + BLK_HDR != addr)
+            continue;
+
+        b->used = 0;
+        g_used -= b->size;
+
+        /* 与前后空闲块合并 */
+        if (b->next && !b->next->used)
+        {
+            b->size += b->next->size;
+            b->next = b->next->next;
+        }
+        if (prev && !prev->used)
+        {
+            prev->size += b->size;
+            prev->next = b->next;
+        }
+        break;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+void *mpp_alloc(size_t size)
+{
+    return malloc(size);
+}
+
+void mpp_free(void *ptr)
+{
+    free(ptr);
+}
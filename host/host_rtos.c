@@ -0,0 +1,256 @@
+/*
+ * Filename: host/host_rtos.c
+ * THE HOLLOW KERNEL
+ * 空心的内核
+ *
+ * 以 pthread 与 libc 实现 RT-Thread 内核接口子集：线程、信号量、节拍、堆内存统计。
+ */
+
+#define _GNU_SOURCE
+#include <rtthread.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "host.h"
+
+struct rt_thread
+{
+    pthread_t   tid;
+    const char *name;
+    void (*entry)(void *parameter);
+    void *parameter;
+};
+
+/* --- 线程 --- */
+
+static void *thread_trampoline(void *arg)
+{
+    struct rt_thread *t = (struct rt_thread *)arg;
+    t->entry(t->parameter);
+    return NULL;
+}
+
+rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter, rt_uint32_t stack_size,
+                             rt_uint8_t priority, rt_uint32_t tick)
+{
+    /* 主机栈空间充裕，忽略 stack_size / priority / tick */
+    (void)stack_size;
+    (void)priority;
+    (void)tick;
+
+    struct rt_thread *t = calloc(1, sizeof(*t));
+    if (!t)
+        return RT_NULL;
+    t->name      = name;
+    t->entry     = entry;
+    t->parameter = parameter;
+    return t;
+}
+
+rt_err_t rt_thread_startup(rt_thread_t thread)
+{
+    if (pthread_create(&thread->tid, NULL, thread_trampoline, thread) != 0)
+        return -RT_ERROR;
+    pthread_detach(thread->tid);
+    return RT_EOK;
+}
+
+rt_err_t rt_thread_mdelay(rt_int32_t ms)
+{
+    if (ms > 0)
+        usleep((useconds_t)ms * 1000);
+    return RT_EOK;
+}
+
+/* --- 信号量 --- */
+
+struct rt_semaphore
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    rt_uint32_t     value;
+};
+
+rt_sem_t rt_sem_create(const char *name, rt_uint32_t value, rt_uint8_t flag)
+{
+    (void)name;
+    (void)flag;
+
+    struct rt_semaphore *sem = calloc(1, sizeof(*sem));
+    if (!sem)
+        return RT_NULL;
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->value = value;
+    return sem;
+}
+
+rt_err_t rt_sem_delete(rt_sem_t sem)
+{
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout)
+{
+    rt_err_t ret = RT_EOK;
+
+    pthread_mutex_lock(&sem->lock);
+    if (timeout == RT_WAITING_FOREVER)
+    {
+        while (sem->value == 0)
+            pthread_cond_wait(&sem->cond, &sem->lock);
+    }
+    else if (sem->value == 0 && timeout > 0)
+    {
+        /* timeout 以节拍计 (1 tick = 1ms) */
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec  += timeout / 1000;
+        ts.tv_nsec += (long)(timeout % 1000) * 1000000L;
+        if (ts.tv_nsec >= 1000000000L)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        while (sem->value == 0)
+        {
+            if (pthread_cond_timedwait(&sem->cond, &sem->lock, &ts) != 0)
+                break;
+        }
+    }
+
+    if (sem->value > 0)
+        sem->value--;
+    else
+        ret = -RT_ETIMEOUT;
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+rt_err_t rt_sem_release(rt_sem_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    sem->value++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return RT_EOK;
+}
+
+/* --- 互斥量 (仅支持永久等待) --- */
+
+struct rt_mutex
+{
+    pthread_mutex_t lock;
+};
+
+rt_mutex_t rt_mutex_create(const char *name, rt_uint8_t flag)
+{
+    (void)name;
+    (void)flag;
+
+    struct rt_mutex *mutex = calloc(1, sizeof(*mutex));
+    if (!mutex)
+        return RT_NULL;
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return mutex;
+}
+
+rt_err_t rt_mutex_delete(rt_mutex_t mutex)
+{
+    pthread_mutex_destroy(&mutex->lock);
+    free(mutex);
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout)
+{
+    (void)timeout;
+    pthread_mutex_lock(&mutex->lock);
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_release(rt_mutex_t mutex)
+{
+    pthread_mutex_unlock(&mutex->lock);
+    return RT_EOK;
+}
+
+/* --- 时钟 --- */
+
+static int                g_tick_virtual = 0;
+static volatile rt_tick_t g_tick_now     = 0;
+
+void host_tick_set_virtual(int virtual)
+{
+    g_tick_virtual = virtual;
+}
+
+void host_tick_advance(rt_tick_t ticks)
+{
+    g_tick_now += ticks;
+}
+
+rt_tick_t rt_tick_get(void)
+{
+    if (g_tick_virtual)
+        return g_tick_now;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (rt_tick_t)(ts.tv_sec * RT_TICK_PER_SECOND + ts.tv_nsec / (1000000000L / RT_TICK_PER_SECOND));
+}
+
+/* --- 堆内存：头部记录块大小，用于 rt_memory_info 统计 --- */
+
+#define HEAP_HDR 16
+
+static pthread_mutex_t g_heap_lock = PTHREAD_MUTEX_INITIALIZER;
+static rt_size_t       g_heap_used = 0;
+static rt_size_t       g_heap_peak = 0;
+
+void *rt_malloc(rt_size_t size)
+{
+    uint8_t *p = malloc(size + HEAP_HDR);
+    if (!p)
+        return RT_NULL;
+    *(rt_size_t *)p = size;
+
+    pthread_mutex_lock(&g_heap_lock);
+    g_heap_used += size;
+    if (g_heap_used > g_heap_peak)
+        g_heap_peak = g_heap_used;
+    pthread_mutex_unlock(&g_heap_lock);
+    return p + HEAP_HDR;
+}
+
+void rt_free(void *ptr)
+{
+    if (!ptr)
+        return;
+    uint8_t *p = (uint8_t *)ptr - HEAP_HDR;
+
+    pthread_mutex_lock(&g_heap_lock);
+    g_heap_used -= *(rt_size_t *)p;
+    pthread_mutex_unlock(&g_heap_lock);
+    free(p);
+}
+
+void rt_memory_info(rt_size_t *total, rt_size_t *used, rt_size_t *max_used)
+{
+    pthread_mutex_lock(&g_heap_lock);
+    if (total)
+        *total = 16 * 1024 * 1024; /* 对齐 D13CCS 的 16MB SIP RAM */
+    if (used)
+        *used = g_heap_used;
+    if (max_used)
+        *max_used = g_heap_peak;
+    pthread_mutex_unlock(&g_heap_lock);
+}
@@ -0,0 +1,35 @@
+/*
+ * Filename: host/include/aic_core.h
+ * 主机构建占位：Cache 维护与日志宏。
+ * 主机内存天然一致，Cache 维护为空操作。
+ */
+
+#ifndef _HOST_AIC_CORE_H_
+#define _HOST_AIC_CORE_H_
+
+#include <rtthread.h>
+
+static inline void aicos_dcache_clean_range(void *addr, unsigned long size)
+{
+    (void)addr;
+    (void)size;
+}
+
+static inline void aicos_dcache_invalid_range(void *addr, unsigned long size)
+{
+    (void)addr;
+    (void)size;
+}
+
+static inline void aicos_dcache_clean_invalid_range(void *addr, unsigned long size)
+{
+    (void)addr;
+    (void)size;
+}
+
+#define LOG_E(fmt, ...) rt_kprintf("[E/" DBG_TAG "] " fmt "\n", ##__VA_ARGS__)
+#define LOG_W(fmt, ...) rt_kprintf("[W/" DBG_TAG "] " fmt "\n", ##__VA_ARGS__)
+#define LOG_I(fmt, ...) rt_kprintf("[I/" DBG_TAG "] " fmt "\n", ##__VA_ARGS__)
+#define LOG_D(fmt, ...)
+
+#endif /* _HOST_AIC_CORE_H_ */
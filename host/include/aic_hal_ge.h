@@ -0,0 +1,11 @@
+/*
+ * Filename: host/include/aic_hal_ge.h
+ * 主机构建占位：GE 驱动层头文件，主机上仅转发至 mpp_ge.h。
+ */
+
+#ifndef _HOST_AIC_HAL_GE_H_
+#define _HOST_AIC_HAL_GE_H_
+
+#include "mpp_ge.h"
+
+#endif /* _HOST_AIC_HAL_GE_H_ */
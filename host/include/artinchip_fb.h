@@ -0,0 +1,88 @@
+/*
+ * Filename: host/include/artinchip_fb.h
+ * 主机构建占位：DE 显示引擎 ioctl 命令与配置结构。
+ * 结构体布局与 Luban-Lite v1.2.2 的 artinchip_fb.h 保持一致，由 host_fb.c 以软件实现。
+ */
+
+#ifndef _HOST_ARTINCHIP_FB_H_
+#define _HOST_ARTINCHIP_FB_H_
+
+#include "mpp_types.h"
+
+enum aicfb_layer_type
+{
+    AICFB_LAYER_TYPE_VIDEO = 0,
+    AICFB_LAYER_TYPE_UI    = 1,
+};
+
+struct aicfb_screeninfo
+{
+    enum mpp_pixel_format format;
+    unsigned int          bits_per_pixel;
+    unsigned int          stride;
+    unsigned int          width;
+    unsigned int          height;
+    unsigned char        *framebuffer;
+    unsigned int          smem_len;
+};
+
+struct aicfb_layer_data
+{
+    unsigned int     enable;
+    unsigned int     layer_id;
+    unsigned int     rect_id;
+    struct mpp_size  scale_size;
+    struct mpp_point pos;
+    struct mpp_buf   buf;
+};
+
+struct aicfb_alpha_config
+{
+    unsigned int layer_id;
+    unsigned int enable;
+    unsigned int mode;
+    unsigned int value;
+};
+
+struct aicfb_ck_config
+{
+    unsigned int layer_id;
+    unsigned int enable;
+    unsigned int value;
+};
+
+/* 3x4 颜色矩阵，0x100 = 1.0，[3]/[7]/[11] 为偏移 */
+struct aicfb_ccm_config
+{
+    unsigned int enable;
+    int          ccm_table[12];
+};
+
+/* 每通道 16 节点 Gamma 曲线 */
+struct aicfb_gamma_config
+{
+    unsigned int enable;
+    unsigned int gamma_lut[3][16];
+};
+
+/* 亮度/对比度/饱和度/色调，50 为中性 */
+struct aicfb_disp_prop
+{
+    unsigned int bright;
+    unsigned int contrast;
+    unsigned int saturation;
+    unsigned int hue;
+};
+
+#define AICFB_WAIT_FOR_VSYNC      0x1000
+#define AICFB_GET_SCREENINFO      0x1001
+#define AICFB_PAN_DISPLAY         0x1002
+#define AICFB_GET_LAYER_CONFIG    0x1003
+#define AICFB_UPDATE_LAYER_CONFIG 0x1004
+#define AICFB_UPDATE_ALPHA_CONFIG 0x1005
+#define AICFB_UPDATE_CK_CONFIG    0x1006
+#define AICFB_UPDATE_CCM_CONFIG   0x1007
+#define AICFB_UPDATE_GAMMA_CONFIG 0x1008
+#define AICFB_SET_DISP_PROP       0x1009
+
+#endif /* _HOST_ARTINCHIP_FB_H_ */
@@ -0,0 +1,17 @@
+/*
+ * Filename: host/include/mpp_fb.h
+ * 主机构建占位：帧缓冲设备接口，由 host_fb.c 以软件实现。
+ */
+
+#ifndef _HOST_MPP_FB_H_
+#define _HOST_MPP_FB_H_
+
+#include "artinchip_fb.h"
+
+struct mpp_fb;
+
+struct mpp_fb *mpp_fb_open(void);
+void           mpp_fb_close(struct mpp_fb *fb);
+int            mpp_fb_ioctl(struct mpp_fb *fb, int cmd, void *args);
+
+#endif /* _HOST_MPP_FB_H_ */
@@ -0,0 +1,89 @@
+/*
+ * Filename: host/include/mpp_ge.h
+ * 主机构建占位：GE 2D 加速器接口。
+ * 结构体布局与 Luban-Lite v1.2.2 的 mpp_ge.h 保持一致，由 host_ge.c 以软件实现。
+ */
+
+#ifndef _HOST_MPP_GE_H_
+#define _HOST_MPP_GE_H_
+
+#include "mpp_types.h"
+
+/* Porter-Duff 混合规则 (GE_PD_ADD 即规则 11) */
+enum ge_pd_rules
+{
+    GE_PD_NONE = 0,
+    GE_PD_CLEAR,
+    GE_PD_SRC,
+    GE_PD_SRC_OVER,
+    GE_PD_DST_OVER,
+    GE_PD_SRC_IN,
+    GE_PD_DST_IN,
+    GE_PD_SRC_OUT,
+    GE_PD_DST_OUT,
+    GE_PD_SRC_ATOP,
+    GE_PD_DST_ATOP,
+    GE_PD_ADD,
+    GE_PD_XOR,
+    GE_PD_DST,
+};
+
+enum ge_fillrect_type
+{
+    GE_NO_GRADIENT = 0,
+    GE_H_LINEAR_GRADIENT,
+    GE_V_LINEAR_GRADIENT,
+};
+
+struct ge_ctrl
+{
+    unsigned int     flags;
+    unsigned int     src_alpha_mode;
+    unsigned int     src_global_alpha;
+    unsigned int     dst_alpha_mode;
+    unsigned int     dst_global_alpha;
+    unsigned int     ck_en;
+    unsigned int     ck_value;
+    enum ge_pd_rules alpha_rules;
+    unsigned int     alpha_en; /* 硬件反转极性：0 = 开启混合，1 = 关闭混合 */
+    unsigned int     dither_en;
+};
+
+struct ge_fillrect
+{
+    enum ge_fillrect_type type;
+    unsigned int          start_color;
+    unsigned int          end_color;
+    struct mpp_buf        dst_buf;
+    struct ge_ctrl        ctrl;
+};
+
+struct ge_bitblt
+{
+    struct mpp_buf src_buf;
+    struct mpp_buf dst_buf;
+    struct ge_ctrl ctrl;
+};
+
+struct ge_rotation
+{
+    struct mpp_buf   src_buf;
+    struct mpp_point src_rot_center;
+    struct mpp_buf   dst_buf;
+    struct mpp_point dst_rot_center;
+    int              angle_sin; /* Q12 */
+    int              angle_cos; /* Q12 */
+    struct ge_ctrl   ctrl;
+};
+
+struct mpp_ge;
+
+struct mpp_ge *mpp_ge_open(void);
+void           mpp_ge_close(struct mpp_ge *ge);
+int            mpp_ge_fillrect(struct mpp_ge *ge, struct ge_fillrect *fill);
+int            mpp_ge_bitblt(struct mpp_ge *ge, struct ge_bitblt *blt);
+int            mpp_ge_rotate(struct mpp_ge *ge, struct ge_rotation *rot);
+int            mpp_ge_emit(struct mpp_ge *ge);
+int            mpp_ge_sync(struct mpp_ge *ge);
+
+#endif /* _HOST_MPP_GE_H_ */
@@ -0,0 +1,17 @@
+/*
+ * Filename: host/include/mpp_mem.h
+ * 主机构建占位：CMA 物理内存分配接口。
+ * 主机上由 host_mem.c 在 4GB 以下的固定区间内模拟，保证 "物理地址" 可以装进 unsigned int。
+ */
+
+#ifndef _HOST_MPP_MEM_H_
+#define _HOST_MPP_MEM_H_
+
+#include <stddef.h>
+
+unsigned int mpp_phy_alloc(size_t size);
+void         mpp_phy_free(unsigned int addr);
+void        *mpp_alloc(size_t size);
+void         mpp_free(void *ptr);
+
+#endif /* _HOST_MPP_MEM_H_ */
@@ -0,0 +1,75 @@
+/*
+ * Filename: host/include/mpp_types.h
+ * 主机构建占位：MPP 公共类型 (像素格式 / 缓冲区描述)。
+ * 字段布局与 Luban-Lite v1.2.2 的 mpp_types.h 保持一致。
+ */
+
+#ifndef _HOST_MPP_TYPES_H_
+#define _HOST_MPP_TYPES_H_
+
+#include <stdint.h>
+
+enum mpp_pixel_format
+{
+    MPP_FMT_ARGB_8888 = 0x00,
+    MPP_FMT_ABGR_8888 = 0x01,
+    MPP_FMT_RGBA_8888 = 0x02,
+    MPP_FMT_BGRA_8888 = 0x03,
+    MPP_FMT_XRGB_8888 = 0x04,
+    MPP_FMT_XBGR_8888 = 0x05,
+    MPP_FMT_RGBX_8888 = 0x06,
+    MPP_FMT_BGRX_8888 = 0x07,
+    MPP_FMT_RGB_888   = 0x08,
+    MPP_FMT_BGR_888   = 0x09,
+    MPP_FMT_RGB_565   = 0x0e,
+    MPP_FMT_BGR_565   = 0x0f,
+    MPP_FMT_YUV400    = 0x29,
+};
+
+enum mpp_buffer_type
+{
+    MPP_DMA_BUF_FD = 0,
+    MPP_PHY_ADDR   = 1,
+};
+
+/* 镜像标志 (ge_ctrl.flags) */
+#define MPP_FLIP_H (1 << 0)
+#define MPP_FLIP_V (1 << 1)
+
+struct mpp_size
+{
+    int width;
+    int height;
+};
+
+struct mpp_point
+{
+    int x;
+    int y;
+};
+
+struct mpp_rect
+{
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+struct mpp_buf
+{
+    enum mpp_buffer_type buf_type;
+    union
+    {
+        int          fd[3];
+        unsigned int phy_addr[3];
+    };
+    unsigned int          stride[3];
+    struct mpp_size       size;
+    unsigned int          crop_en;
+    struct mpp_rect       crop;
+    enum mpp_pixel_format format;
+    unsigned int          flags;
+};
+
+#endif /* _HOST_MPP_TYPES_H_ */
@@ -0,0 +1,11 @@
+/*
+ * Filename: host/include/rtdevice.h
+ * 主机构建占位：设备框架接口 (主机上不存在 GPIO 按键)。
+ */
+
+#ifndef _HOST_RTDEVICE_H_
+#define _HOST_RTDEVICE_H_
+
+#include <rtthread.h>
+
+#endif /* _HOST_RTDEVICE_H_ */
@@ -0,0 +1,98 @@
+/*
+ * Filename: host/include/rtthread.h
+ * THE HOLLOW KERNEL
+ * 空心的内核
+ *
+ * 主机 (Linux) 构建专用：以 POSIX 线程与 libc 模拟本项目用到的 RT-Thread 内核接口子集。
+ * 仅覆盖 ge-demos 实际调用的符号，不追求与 RT-Thread 完全一致。
+ */
+
+#ifndef _HOST_RTTHREAD_H_
+#define _HOST_RTTHREAD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* --- 基础类型 --- */
+typedef long          rt_base_t;
+typedef unsigned long rt_ubase_t;
+typedef long          rt_err_t;
+typedef uint32_t      rt_tick_t;
+typedef size_t        rt_size_t;
+typedef int           rt_bool_t;
+typedef int32_t       rt_int32_t;
+typedef uint32_t      rt_uint32_t;
+typedef uint8_t       rt_uint8_t;
+
+#define RT_NULL             NULL
+#define RT_TRUE             1
+#define RT_FALSE            0
+#define RT_EOK              0
+#define RT_ERROR            1
+#define RT_ETIMEOUT         2
+#define RT_TICK_PER_SECOND  1000
+#define RT_WAITING_FOREVER  -1
+#define RT_WAITING_NO       0
+#define RT_IPC_FLAG_FIFO    0x00
+#define RT_IPC_FLAG_PRIO    0x01
+#define RT_WEAK             __attribute__((weak))
+
+/* --- 线程 --- */
+typedef struct rt_thread *rt_thread_t;
+
+rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter, rt_uint32_t stack_size,
+                             rt_uint8_t priority, rt_uint32_t tick);
+rt_err_t    rt_thread_startup(rt_thread_t thread);
+rt_err_t    rt_thread_mdelay(rt_int32_t ms);
+
+/* --- 时钟 --- */
+rt_tick_t rt_tick_get(void);
+
+/* --- 信号量 --- */
+typedef struct rt_semaphore *rt_sem_t;
+
+rt_sem_t rt_sem_create(const char *name, rt_uint32_t value, rt_uint8_t flag);
+rt_err_t rt_sem_delete(rt_sem_t sem);
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout);
+rt_err_t rt_sem_release(rt_sem_t sem);
+
+/* --- 互斥量 (与 RT-Thread 一致，可递归持有) --- */
+typedef struct rt_mutex *rt_mutex_t;
+
+rt_mutex_t rt_mutex_create(const char *name, rt_uint8_t flag);
+rt_err_t   rt_mutex_delete(rt_mutex_t mutex);
+rt_err_t   rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout);
+rt_err_t   rt_mutex_release(rt_mutex_t mutex);
+
+/* --- 内存 --- */
+void *rt_malloc(rt_size_t size);
+void  rt_free(void *ptr);
+void  rt_memory_info(rt_size_t *total, rt_size_t *used, rt_size_t *max_used);
+
+#define rt_memset   memset
+#define rt_memcpy   memcpy
+#define rt_kprintf  printf
+#define rt_snprintf snprintf
+
+/*
+ * --- Shell 命令导出：收集到 HostCmdTab 段，由主机运行器分发 ---
+ * 段中只存放指针 (与 EffectTab 相同)，避免编译器对结构体做对齐填充后无法按数组遍历
+ */
+struct host_cmd
+{
+    const char *name;
+    const char *desc;
+    int (*func)(int argc, char **argv);
+};
+
+#define MSH_CMD_EXPORT_ALIAS(command, alias, desc)                                                                     \
+    static const struct host_cmd _host_cmd_##command = {#alias, #desc, command};                                      \
+    __attribute__((section("HostCmdTab"), used)) static const struct host_cmd *const _host_cmd_ptr_##command =        \
+        &_host_cmd_##command
+#define MSH_CMD_EXPORT(command, desc) MSH_CMD_EXPORT_ALIAS(command, command, desc)
+
+#endif /* _HOST_RTTHREAD_H_ */
@@ -0,0 +1,59 @@
+"""
+生成 demo_math_tables.c：demo_math.h 所声明的只读定点查找表。
+
+正弦表按 float32 逐步模拟特效中原有的 (int)(sinf(i * PI / 512.0f) * Q) 写法
+(截断取整)，使移植到共享表的特效与原先的私有表逐位一致。
+
+用法: python3 tools/gen_math_tables.py > demo_math_tables.c
+"""
+
+import math
+import struct
+
+ANGLE_ONE = 1024  # 一整周
+RECIP_SIZE = 1024
+SQRT_SIZE = 1024
+ATAN_SIZE = 256  # 八分圆内 tan 的分辨率
+
+
+def f32(x):
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+
+PI_F = f32(3.1415926535)
+
+
+def sin_fixed(i, one):
+    # i * PI / 512.0f：乘法结果舍入到 float32，除以 2 的幂无误差
+    x = f32(f32(float(i) * PI_F) / 512.0)
+    return int(f32(math.sin(x)) * one)  # int() 向零截断，与 C 一致
+
+
+def emit(name, ctype, values, per_line=16):
+    print(f"const {ctype} {name}[{len(values)}] = {{")
+    for i in range(0, len(values), per_line):
+        print("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    print("};\n")
+
+
+def main():
+    print("/*")
+    print(" * Filename: demo_math_tables.c")
+    print(" * 由 tools/gen_math_tables.py 生成，请勿手工修改。")
+    print(" */\n")
+    print('#include "demo_math.h"\n')
+
+    emit("demo_sin_q12_tab", "int16_t", [sin_fixed(i, 4096) for i in range(ANGLE_ONE)])
+    emit("demo_sin_q8_tab", "int16_t", [sin_fixed(i, 256) for i in range(ANGLE_ONE)])
+
+    recip = [65536] + [65536 // i for i in range(1, RECIP_SIZE)]
+    emit("demo_recip_q16_tab", "uint32_t", recip, 12)
+
+    emit("demo_sqrt_q4_tab", "uint16_t", [math.isqrt(i * 256) for i in range(SQRT_SIZE)])
+
+    atan = [round(math.atan(i / ATAN_SIZE) * ANGLE_ONE / (2 * math.pi)) for i in range(ATAN_SIZE + 1)]
+    emit("demo_atan_tab", "uint8_t", atan)
+
+
+if __name__ == "__main__":
+    main()